@@ -0,0 +1,70 @@
+/**
+ * @file GLGE_Skinning.cpp
+ * @author DM8AT
+ * @brief implement the skinning of meshes
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the skinning API
+#include "GLGE_Skinning.h"
+//include the batch kernels
+#include "../Kernels/GLGE_KernelTable.hpp"
+//include the threading of the batch functions
+#include "../Kernels/GLGE_Parallel.hpp"
+
+//the amount of vertices per chunk. It is a multiple of the padding of the containers, so every chunk starts at an aligned 
+//address, and large enough that starting a thread costs less than the chunk
+#define GLGE_SKINNING_CHUNK 4096
+
+/**
+ * @brief deform the vertices of a mesh in chunks on multiple threads
+ * 
+ * @tparam F the type of the function that deforms a chunk
+ * @param pos a pointer to the positions of the vertices
+ * @param nrm a pointer to the normals of the vertices or NULL
+ * @param outPos a pointer to the container for the deformed positions
+ * @param outNrm a pointer to the container for the deformed normals, only used if nrm is not NULL
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param deform the function that deforms a chunk given the offset streams and the amount of vertices of the chunk
+ */
+template <typename F> static void skinChunks(const vec3SoA* pos, const vec3SoA* nrm, vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, F deform) {
+    size_t n = pos->size;
+    if (!vec3SoA_resize(outPos, n)) {return;}
+    if (nrm && !vec3SoA_resize(outNrm, n)) {return;}
+    glge::parallel::forChunks(n, GLGE_SKINNING_CHUNK, threads, [&](size_t begin, size_t end) {
+        const float* p[3] = {pos->x + begin, pos->y + begin, pos->z + begin};
+        float* op[3] = {outPos->x + begin, outPos->y + begin, outPos->z + begin};
+        const float* nr[3] = {NULL, NULL, NULL};
+        float* onr[3] = {NULL, NULL, NULL};
+        if (nrm) {
+            for (size_t c = 0; c < 3; ++c) 
+            {nr[c] = nrm->streams[c] + begin; onr[c] = outNrm->streams[c] + begin;}
+        }
+        deform(begin, p, nrm ? nr : NULL, op, onr, end - begin);
+    });
+}
+
+void skinning_linearBlend(const mat4* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                          vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream) {
+    const glge::kernel::KernelTable& table = glge::kernel::table();
+    skinChunks(pos, nrm, outPos, outNrm, threads, [&](size_t i, const float* const* p, const float* const* nr, float* const* op, float* const* onr, size_t n) 
+    {table.lbsSkin((const float*)palette, 16, joints[i].vals, weights[i].vals, p, nr, op, onr, n, stream);});
+}
+
+void skinning_linearBlend3x4(const mat3x4* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                             vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream) {
+    const glge::kernel::KernelTable& table = glge::kernel::table();
+    skinChunks(pos, nrm, outPos, outNrm, threads, [&](size_t i, const float* const* p, const float* const* nr, float* const* op, float* const* onr, size_t n) 
+    {table.lbsSkin((const float*)palette, 12, joints[i].vals, weights[i].vals, p, nr, op, onr, n, stream);});
+}
+
+void skinning_dualQuaternion(const DualQuaternion* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                             vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream) {
+    const glge::kernel::KernelTable& table = glge::kernel::table();
+    skinChunks(pos, nrm, outPos, outNrm, threads, [&](size_t i, const float* const* p, const float* const* nr, float* const* op, float* const* onr, size_t n) 
+    {table.dqSkin((const float*)palette, joints[i].vals, weights[i].vals, p, nr, op, onr, n, stream);});
+}
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * @file GLGE_Skinning.h
+ * @author DM8AT
+ * @brief deform the vertices of skinned meshes by the bones of a skeleton
+ * 
+ * Every vertex is bound to 4 bones by a uivec4 of bone indices and a vec4 of weights. Unused influences have a weight of 0
+ * and the weights of a vertex should add up to 1. The positions and normals are stored in structure of arrays containers,
+ * the output containers may be the input containers to deform the mesh in place.
+ * The vertices are split into chunks that are deformed by multiple threads, inside a chunk multiple vertices are deformed at
+ * once if the CPU supports wide registers. If the deformed vertices are only uploaded to the GPU afterwards, non-temporal
+ * stores keep them from evicting the bones and the remaining input from the cache.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_SKINNING_
+#define _GLGE_SKINNING_
+
+//include the matrices for the bone palettes
+#include "../Matrix/floats/GLGE_mat4.h"
+#include "../Matrix/floats/GLGE_mat3x4.h"
+//include the dual quaternions for the bone palettes
+#include "../Imaginary/Quaternions/DualQuaternion.h"
+//include the structure of arrays containers for the vertices
+#include "../Vector/floats/GLGE_vec3SoA.h"
+//include the vectors for the bone indices and weights
+#include "../Vector/floats/GLGE_vec4.h"
+#include "../Vector/uint32_t/GLGE_uivec4.h"
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief deform the vertices of a mesh by blending the matrices of their bones (linear blend skinning)
+ * 
+ * The normals are transformed by the upper 3x3 part of the blended matrix, so the bones should not be scaled
+ * non-uniformly. The normals are not normalized again.
+ * 
+ * @param palette a pointer to the bone matrices, only the upper 3x4 part is used
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos a pointer to the positions of the vertices
+ * @param nrm a pointer to the normals of the vertices or NULL if only the positions are deformed. It must hold at least as many normals as there are positions
+ * @param outPos a pointer to the container to write the deformed positions to (may be pos), it is resized to the size of pos
+ * @param outNrm a pointer to the container to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+void skinning_linearBlend(const mat4* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                          vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream);
+
+/**
+ * @brief deform the vertices of a mesh by blending the affine 3x4 matrices of their bones (linear blend skinning)
+ * 
+ * A 3x4 matrix stores the upper 3 rows of a 4x4 matrix (12 floats), so the palette takes 25% less memory
+ * 
+ * @param palette a pointer to the affine bone matrices
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos a pointer to the positions of the vertices
+ * @param nrm a pointer to the normals of the vertices or NULL if only the positions are deformed. It must hold at least as many normals as there are positions
+ * @param outPos a pointer to the container to write the deformed positions to (may be pos), it is resized to the size of pos
+ * @param outNrm a pointer to the container to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+void skinning_linearBlend3x4(const mat3x4* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                             vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream);
+
+/**
+ * @brief deform the vertices of a mesh by blending the dual quaternions of their bones (dual quaternion skinning)
+ * 
+ * @param palette a pointer to the normalized dual quaternions of the bones
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos a pointer to the positions of the vertices
+ * @param nrm a pointer to the normals of the vertices or NULL if only the positions are deformed. It must hold at least as many normals as there are positions
+ * @param outPos a pointer to the container to write the deformed positions to (may be pos), it is resized to the size of pos
+ * @param outNrm a pointer to the container to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+void skinning_dualQuaternion(const DualQuaternion* palette, const uivec4* joints, const vec4* weights, const vec3SoA* pos, const vec3SoA* nrm,
+                             vec3SoA* outPos, vec3SoA* outNrm, uint32_t threads, bool stream);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief deform the positions and normals of a mesh in place using linear blend skinning
+ * 
+ * @param palette a pointer to the bone matrices
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param nrm the normals to deform, it must hold at least as many normals as there are positions
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const mat4* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, vec3SoA& nrm, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_linearBlend(palette, joints, weights, &pos, &nrm, &pos, &nrm, threads, stream);}
+
+/**
+ * @brief deform the positions of a mesh in place using linear blend skinning
+ * 
+ * @param palette a pointer to the bone matrices
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const mat4* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_linearBlend(palette, joints, weights, &pos, NULL, &pos, NULL, threads, stream);}
+
+/**
+ * @brief deform the positions and normals of a mesh in place using linear blend skinning with affine 3x4 bone matrices
+ * 
+ * @param palette a pointer to the affine bone matrices
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param nrm the normals to deform, it must hold at least as many normals as there are positions
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const mat3x4* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, vec3SoA& nrm, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_linearBlend3x4(palette, joints, weights, &pos, &nrm, &pos, &nrm, threads, stream);}
+
+/**
+ * @brief deform the positions of a mesh in place using linear blend skinning with affine 3x4 bone matrices
+ * 
+ * @param palette a pointer to the affine bone matrices
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const mat3x4* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_linearBlend3x4(palette, joints, weights, &pos, NULL, &pos, NULL, threads, stream);}
+
+/**
+ * @brief deform the positions and normals of a mesh in place using dual quaternion skinning
+ * 
+ * @param palette a pointer to the normalized dual quaternions of the bones
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param nrm the normals to deform, it must hold at least as many normals as there are positions
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const DualQuaternion* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, vec3SoA& nrm, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_dualQuaternion(palette, joints, weights, &pos, &nrm, &pos, &nrm, threads, stream);}
+
+/**
+ * @brief deform the positions of a mesh in place using dual quaternion skinning
+ * 
+ * @param palette a pointer to the normalized dual quaternions of the bones
+ * @param joints a pointer to the bone indices of every vertex
+ * @param weights a pointer to the weights of every vertex
+ * @param pos the positions to deform
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ */
+inline void skin(const DualQuaternion* palette, const uivec4* joints, const vec4* weights, vec3SoA& pos, uint32_t threads = 0, bool stream = false) noexcept
+{skinning_dualQuaternion(palette, joints, weights, &pos, NULL, &pos, NULL, threads, stream);}
+
+#endif
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * @file GLGE_Benchmark_Mat4.cpp
+ * @author DM8AT
+ * @brief measure the SIMD product of two 4x4 float matrices against the scalar product
+ * 
+ * Every matrix of an array is repeatedly multiplied by a rotation, so each product depends on the previous one and
+ * the values stay in the normal range. The array is small enough to stay in the cache, so only the products are measured.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the clock for the measurements
+#include <chrono>
+//include the output
+#include <cstdio>
+//include the arrays of matrices
+#include <vector>
+
+//the amount of matrices that are multiplied in every round
+#define BENCHMARK_MATRICES 1024
+//the amount of rounds
+#define BENCHMARK_ROUNDS 4000
+
+/**
+ * @brief create a rotation matrix around the z axis followed by a rotation around the x axis
+ * 
+ * @param a the angle around the z axis in radians
+ * @param b the angle around the x axis in radians
+ * @return mat4 the rotation matrix
+ */
+static mat4 rotation(float a, float b) {
+    float ca = std::cos(a), sa = std::sin(a), cb = std::cos(b), sb = std::sin(b);
+    return mat4(
+        vec4(ca, -sa*cb, sa*sb, 0),
+        vec4(sa, ca*cb, -ca*sb, 0),
+        vec4(0, sb, cb, 0),
+        vec4(0, 0, 0, 1)
+    );
+}
+
+/**
+ * @brief multiply all matrices by their rotations for all rounds and measure the time
+ * 
+ * @tparam F the type of the product function
+ * @param mats the matrices to multiply, they are overwritten with the results
+ * @param rots the rotations to multiply the matrices with
+ * @param product the function computing the product of two matrices
+ * @return double the time per product in nanoseconds
+ */
+template <typename F> static double measure(std::vector<mat4>& mats, const std::vector<mat4>& rots, F product) {
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < BENCHMARK_ROUNDS; ++r) {
+        for (size_t i = 0; i < mats.size(); ++i) {mats[i] = product(mats[i], rots[i]);}
+    }
+    std::chrono::duration<double, std::nano> time = std::chrono::steady_clock::now() - start;
+    return time.count() / ((double)BENCHMARK_ROUNDS * mats.size());
+}
+
+int main() {
+    std::vector<mat4> rots(BENCHMARK_MATRICES);
+    std::vector<mat4> start(BENCHMARK_MATRICES);
+    for (size_t i = 0; i < BENCHMARK_MATRICES; ++i) {
+        rots[i] = rotation(0.001f * i, 0.002f * i + 0.5f);
+        start[i] = rotation(0.003f * i + 1.f, 0.0005f * i);
+        start[i].rows[3] = vec4(0.1f * i, 1.f, -2.f, 1.f);
+    }
+
+    //measure both products on the same start values
+    std::vector<mat4> simd = start;
+    std::vector<mat4> scalar = start;
+    double tScalar = measure(scalar, rots, [](const mat4& a, const mat4& b) noexcept {return a.scalarProduct(b);});
+    double tSimd = measure(simd, rots, [](const mat4& a, const mat4& b) noexcept {return a * b;});
+
+    //the products only differ if fused multiply-adds are used
+    float diff = 0.f;
+    for (size_t i = 0; i < BENCHMARK_MATRICES; ++i) {
+        for (size_t j = 0; j < 16; ++j) {diff = std::fmax(diff, std::fabs(simd[i].m[j] - scalar[i].m[j]));}
+    }
+
+    printf("mat4 * mat4 (%s%s)\n", GLGE_MATH_ALLOW_AVX2 ? "AVX2" : "SSE", GLGE_MATH_ALLOW_FMA ? ", FMA" : "");
+    printf("  scalar : %6.2f ns per product\n", tScalar);
+    printf("  SIMD   : %6.2f ns per product (%.2fx)\n", tSimd, tScalar / tSimd);
+    printf("  largest difference after %d products : %g\n", BENCHMARK_ROUNDS, diff);
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+/**
+ * @file GLGE_Benchmark_Skinning.cpp
+ * @author DM8AT
+ * @brief measure the throughput of the skinning functions with 1, 4 and 16 threads
+ * 
+ * A mesh of 1M vertices with 4 bones per vertex is deformed by a palette of 64 bones. The positions and normals are
+ * written to separate containers, so every round reads and writes the same amount of memory.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the clock for the measurements
+#include <chrono>
+//include the output
+#include <cstdio>
+//include the arrays of bones and vertices
+#include <vector>
+//include the hardware thread count
+#include <thread>
+
+//the amount of vertices of the mesh
+#define BENCHMARK_VERTICES (1 << 20)
+//the amount of bones of the palette
+#define BENCHMARK_BONES 64
+//the amount of rounds every measurement is repeated
+#define BENCHMARK_ROUNDS 50
+
+/**
+ * @brief deform the mesh for all rounds and measure the throughput
+ * 
+ * @tparam F the type of the skinning function
+ * @param skin the function that deforms the mesh with a given amount of threads
+ * @param threads the amount of threads
+ * @return double the deformed vertices per second
+ */
+template <typename F> static double measure(F skin, uint32_t threads) {
+    //deform the mesh once so the output containers are allocated and the threads are warmed up
+    skin(threads);
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < BENCHMARK_ROUNDS; ++r) {skin(threads);}
+    std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+    return (double)BENCHMARK_VERTICES * BENCHMARK_ROUNDS / time.count();
+}
+
+/**
+ * @brief measure a skinning function with 1, 4 and 16 threads and print the results
+ * 
+ * @tparam F the type of the skinning function
+ * @param name the name of the skinning method
+ * @param skin the function that deforms the mesh with a given amount of threads
+ */
+template <typename F> static void report(const char* name, F skin) {
+    printf("%s\n", name);
+    const uint32_t threads[] = {1, 4, 16};
+    double single = 0.0;
+    for (uint32_t t : threads) {
+        double rate = measure(skin, t);
+        if (t == 1) {single = rate;}
+        printf("  %2u threads : %8.1f M vertices/s (%.2fx)\n", t, rate * 1e-6, rate / single);
+    }
+}
+
+int main() {
+    //create the bones from rotations and translations
+    std::vector<mat4> mats(BENCHMARK_BONES);
+    std::vector<mat3x4> affine(BENCHMARK_BONES);
+    std::vector<DualQuaternion> dquats(BENCHMARK_BONES);
+    for (size_t b = 0; b < BENCHMARK_BONES; ++b) {
+        Quaternion rot(vec3(0.1f * b, 0.05f * b - 1.f, 0.02f * b + 0.5f));
+        vec3 move(0.5f * b, -0.25f * b, 1.f);
+        dquats[b] = DualQuaternion(rot, move);
+        mats[b] = dquats[b].toMat4();
+        affine[b] = mat3x4(mats[b]);
+    }
+
+    //create the mesh, every vertex uses 4 different bones with weights that sum up to 1
+    std::vector<uivec4> joints(BENCHMARK_VERTICES);
+    std::vector<vec4> weights(BENCHMARK_VERTICES);
+    vec3SoA pos(BENCHMARK_VERTICES);
+    vec3SoA nrm(BENCHMARK_VERTICES);
+    for (size_t i = 0; i < BENCHMARK_VERTICES; ++i) {
+        uint32_t b = (uint32_t)(i * 7) % BENCHMARK_BONES;
+        joints[i] = uivec4(b, (b + 1) % BENCHMARK_BONES, (b + 5) % BENCHMARK_BONES, (b + 11) % BENCHMARK_BONES);
+        float w = (float)(i % 17) / 64.f;
+        weights[i] = vec4(0.4f + w, 0.3f, 0.2f, 0.1f) * (1.f / (1.f + w));
+        pos.set(i, vec3((float)(i % 1000), (float)(i / 1000), 1.f));
+        nrm.set(i, vec3(0.f, 0.f, 1.f));
+    }
+    vec3SoA outPos, outNrm;
+
+    printf("skinning %d vertices with %d bones (%u hardware threads)\n", BENCHMARK_VERTICES, BENCHMARK_BONES, std::thread::hardware_concurrency());
+    report("linear blend skinning (mat4)", [&](uint32_t t) {
+        skinning_linearBlend(mats.data(), joints.data(), weights.data(), &pos, &nrm, &outPos, &outNrm, t, false);
+    });
+    report("linear blend skinning (mat3x4)", [&](uint32_t t) {
+        skinning_linearBlend3x4(affine.data(), joints.data(), weights.data(), &pos, &nrm, &outPos, &outNrm, t, false);
+    });
+    report("dual quaternion skinning", [&](uint32_t t) {
+        skinning_dualQuaternion(dquats.data(), joints.data(), weights.data(), &pos, &nrm, &outPos, &outNrm, t, false);
+    });
+    return 0;
+}
\ No newline at end of file
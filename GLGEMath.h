@@ -27,7 +27,23 @@
 #include "Matrix/doubles/GLGEMatDoubles.h"
 //include integer casts
 #include "Vector/VectorCast.hpp"
+//include the wide types for AoSoA programming
+#include "Vector/floats/GLGE_vec3x8.hpp"
+#include "Vector/floats/GLGE_vec4x8.hpp"
+#include "Matrix/floats/GLGE_mat4x8.hpp"
 //include the imaginary stuff
 #include "Imaginary/Imaginary.h"
+//include the skinning of meshes
+#include "Animation/GLGE_Skinning.h"
+//include the transforms of scene objects
+#include "Scene/GLGE_Transform.h"
+//include the hierarchies of scene objects
+#include "Scene/GLGE_Hierarchy.h"
+//include the frustums for culling
+#include "Scene/GLGE_Frustum.h"
+//include the geometric primitives and their intersection tests
+#include "Geometry/GLGE_Primitives.h"
+//include the selection of the instruction set for the batch functions
+#include "GLGE_Dispatch.h"
 
 #endif
\ No newline at end of file
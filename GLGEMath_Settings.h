@@ -15,10 +15,75 @@
 
 //include specific sized integers
 #include <stdint.h>
+//include the size type for array functions
+#include <stddef.h>
+//include booleans for C
+#include <stdbool.h>
 
 //define if SIMD is allowed
 #define GLGE_MATH_USE_SIMD 1
-//if SIMD is allowed, specify wether the AVX2 extension can be used
+//if SIMD is allowed, specify wether the AVX2 extension can be used by the inline functions of the headers
+//the CMake target exports it (1 only for GLGE_MATH_NATIVE_AVX2), without CMake it is 1 if the including code is compiled for
+//AVX2 and FMA3 (for example using -mavx2 -mfma or /arch:AVX2). The batch functions select their instruction set at runtime 
+//independent of this setting (see GLGE_Dispatch.h)
+#ifndef GLGE_MATH_ALLOW_AVX2
+#if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
 #define GLGE_MATH_ALLOW_AVX2 1
+#else
+#define GLGE_MATH_ALLOW_AVX2 0
+#endif
+#endif
+
+//if SIMD is allowed, specify wether fused multiply-adds (FMA3) can be used by the inline functions of the headers
+//a fused result is only rounded once, so it may differ in the last bit from the unfused result. The inline functions are
+//compiled into the library and into the code using it, so both must agree on this setting. The CMake target exports it 
+//together with GLGE_MATH_ALLOW_AVX2 (1 only for GLGE_MATH_NATIVE_AVX2). Without CMake it has to be defined the same way for
+//all code, if it is missing it is derived from the flags of the including code
+#ifndef GLGE_MATH_ALLOW_FMA
+#if GLGE_MATH_USE_SIMD && (defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#define GLGE_MATH_ALLOW_FMA 1
+#else
+#define GLGE_MATH_ALLOW_FMA 0
+#endif
+#endif
+
+//the fused multiply-adds need FMA3 instructions, so code that is not compiled for FMA3 can't use a library that allows them
+#if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_FMA && !(defined(__FMA__) || (defined(_MSC_VER) && defined(__AVX2__)))
+#error "GLGE_MATH_ALLOW_FMA is 1, but the code is not compiled for FMA3 (use -mfma or /arch:AVX2)"
+#endif
+
+//check if the compiler can tell if a function is evaluated at compile time. Intrinsics can't be evaluated at compile time,
+//so the inline functions that use them are only constexpr if they can switch to their scalar code during constant evaluation
+#if __cplusplus
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define GLGE_MATH_HAS_CONSTANT_EVALUATION 1
+#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+#define GLGE_MATH_HAS_CONSTANT_EVALUATION 1
+#endif
+#endif
+#ifdef GLGE_MATH_HAS_CONSTANT_EVALUATION
+#define GLGE_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#define GLGE_MATH_SIMD_CONSTEXPR constexpr
+#else
+#define GLGE_MATH_HAS_CONSTANT_EVALUATION 0
+#define GLGE_MATH_IS_CONSTANT_EVALUATED() false
+#define GLGE_MATH_SIMD_CONSTEXPR
+#endif
+
+//specify the precision length() and normalize() of the float vectors use if no precision is requested explicitly
+//0 : the exact square root and division are used | 1 : the approximate reciprocal square root is used (see glge::Precision)
+#ifndef GLGE_MATH_FAST_NORMALIZE
+#define GLGE_MATH_FAST_NORMALIZE 0
+#endif
+
+//the size in bytes an output array of a batch function must reach before it is written using non-temporal (streaming) stores
+//streamed data bypasses the cache, this only pays off if the output would evict the cache anyways
+#define GLGE_MATH_STREAMING_THRESHOLD (4 << 20)
+
+//the alignment in bytes of the element streams of the structure of arrays containers
+//a cache line, the capacity of the streams is padded to a multiple of this as well so the kernels never need a scalar tail
+#define GLGE_MATH_SOA_ALIGNMENT 64
 
 #endif
\ No newline at end of file
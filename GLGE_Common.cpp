@@ -11,5 +11,163 @@
 
 //include the common function definitions
 #include "GLGE_Common.h"
+//include the C standard library for memory management
+#include <stdlib.h>
+//include the polynomial approximations of the transcendental functions
+#include "Kernels/GLGE_MathKernels.hpp"
+//include the batch kernels
+#include "Kernels/GLGE_KernelTable.hpp"
 
-float glge_sqrt(float value) {return glge::sqrt(value);}
\ No newline at end of file
+//the single values are computed in the first lane of a pack of the instruction set the library is compiled for, so they 
+//are identical to the batch kernels of that instruction set
+
+void glge::sincos(float x, float& s, float& c) noexcept(true) {
+    kernel::Pack ps, pc;
+    kernel::sincos(kernel::set1(x), ps, pc);
+    s = kernel::first(ps);
+    c = kernel::first(pc);
+}
+
+void glge::sincos(double x, double& s, double& c) noexcept(true) {
+    kernel::DPack ps, pc;
+    kernel::sincos(kernel::set1(x), ps, pc);
+    s = kernel::first(ps);
+    c = kernel::first(pc);
+}
+
+float glge::sin(float x) noexcept(true) {return kernel::first(kernel::sin(kernel::set1(x)));}
+
+double glge::sin(double x) noexcept(true) {return kernel::first(kernel::sin(kernel::set1(x)));}
+
+float glge::cos(float x) noexcept(true) {return kernel::first(kernel::cos(kernel::set1(x)));}
+
+double glge::cos(double x) noexcept(true) {return kernel::first(kernel::cos(kernel::set1(x)));}
+
+float glge::tan(float x) noexcept(true) {return kernel::first(kernel::tan(kernel::set1(x)));}
+
+double glge::tan(double x) noexcept(true) {return kernel::first(kernel::tan(kernel::set1(x)));}
+
+float glge::atan2(float y, float x) noexcept(true) {return kernel::first(kernel::atan2(kernel::set1(y), kernel::set1(x)));}
+
+double glge::atan2(double y, double x) noexcept(true) {return kernel::first(kernel::atan2(kernel::set1(y), kernel::set1(x)));}
+
+float glge::exp(float x) noexcept(true) {return kernel::first(kernel::exp(kernel::set1(x)));}
+
+double glge::exp(double x) noexcept(true) {return kernel::first(kernel::exp(kernel::set1(x)));}
+
+float glge::log(float x) noexcept(true) {return kernel::first(kernel::log(kernel::set1(x)));}
+
+double glge::log(double x) noexcept(true) {return kernel::first(kernel::log(kernel::set1(x)));}
+
+float glge::pow(float x, float y) noexcept(true) {return kernel::first(kernel::pow(kernel::set1(x), kernel::set1(y)));}
+
+double glge::pow(double x, double y) noexcept(true) {return kernel::first(kernel::pow(kernel::set1(x), kernel::set1(y)));}
+
+float glge_sqrt(float value) {return glge::sqrt(value);}
+
+double glge_dsqrt(double value) {return glge::sqrt(value);}
+
+void glge_sqrtArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Sqrt, in, NULL, out, n);}
+
+void glge_dsqrtArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Sqrt, in, NULL, out, n);}
+
+void glge_sincos(float x, float* s, float* c) {glge::sincos(x, *s, *c);}
+
+float glge_sin(float x) {return glge::sin(x);}
+
+float glge_cos(float x) {return glge::cos(x);}
+
+float glge_tan(float x) {return glge::tan(x);}
+
+float glge_atan2(float y, float x) {return glge::atan2(y, x);}
+
+float glge_exp(float x) {return glge::exp(x);}
+
+float glge_log(float x) {return glge::log(x);}
+
+float glge_pow(float x, float y) {return glge::pow(x, y);}
+
+void glge_dsincos(double x, double* s, double* c) {glge::sincos(x, *s, *c);}
+
+double glge_dsin(double x) {return glge::sin(x);}
+
+double glge_dcos(double x) {return glge::cos(x);}
+
+double glge_dtan(double x) {return glge::tan(x);}
+
+double glge_datan2(double y, double x) {return glge::atan2(y, x);}
+
+double glge_dexp(double x) {return glge::exp(x);}
+
+double glge_dlog(double x) {return glge::log(x);}
+
+double glge_dpow(double x, double y) {return glge::pow(x, y);}
+
+void glge_sincosArray(const float* in, float* s, float* c, size_t n) 
+{glge::kernel::table().mathSinCos(in, s, c, n);}
+
+void glge_sinArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Sin, in, NULL, out, n);}
+
+void glge_cosArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Cos, in, NULL, out, n);}
+
+void glge_tanArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Tan, in, NULL, out, n);}
+
+void glge_expArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Exp, in, NULL, out, n);}
+
+void glge_logArray(const float* in, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Log, in, NULL, out, n);}
+
+void glge_atan2Array(const float* y, const float* x, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Atan2, y, x, out, n);}
+
+void glge_powArray(const float* x, const float* y, float* out, size_t n) 
+{glge::kernel::table().mathFloat(glge::kernel::MathFunction::Pow, x, y, out, n);}
+
+void glge_dsincosArray(const double* in, double* s, double* c, size_t n) 
+{glge::kernel::table().mathDSinCos(in, s, c, n);}
+
+void glge_dsinArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Sin, in, NULL, out, n);}
+
+void glge_dcosArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Cos, in, NULL, out, n);}
+
+void glge_dtanArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Tan, in, NULL, out, n);}
+
+void glge_dexpArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Exp, in, NULL, out, n);}
+
+void glge_dlogArray(const double* in, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Log, in, NULL, out, n);}
+
+void glge_datan2Array(const double* y, const double* x, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Atan2, y, x, out, n);}
+
+void glge_dpowArray(const double* x, const double* y, double* out, size_t n) 
+{glge::kernel::table().mathDouble(glge::kernel::MathFunction::Pow, x, y, out, n);}
+
+void* glge_alignedAlloc(size_t size, size_t alignment) {
+    #if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+    #else
+    //posix_memalign requires the alignment to be at least the size of a pointer
+    void* ptr = NULL;
+    if (alignment < sizeof(void*)) {alignment = sizeof(void*);}
+    return (posix_memalign(&ptr, alignment, size) == 0) ? ptr : NULL;
+    #endif
+}
+
+void glge_alignedFree(void* ptr) {
+    #if defined(_WIN32)
+    _aligned_free(ptr);
+    #else
+    free(ptr);
+    #endif
+}
\ No newline at end of file
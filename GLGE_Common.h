@@ -16,11 +16,22 @@
 //include the settings
 #include "GLGEMath_Settings.h"
 
+//fused multiply-adds and the AVX square roots need the FMA3 and AVX intrinsics
+#if GLGE_MATH_ALLOW_FMA || GLGE_MATH_ALLOW_AVX2
+#include <immintrin.h>
+#endif
+//the fast reciprocal square root and the SIMD square roots need the SSE2 intrinsics
+#if GLGE_MATH_USE_SIMD
+#include <emmintrin.h>
+#endif
+
 //define a constexpression collection for C++
 #if __cplusplus
 
 //include the C Math library for functions
 #include <cmath>
+//include the limits for the smallest normal float
+#include <cfloat>
 
 /**
  * @brief use the GLGE namespace as the names used are quite common
@@ -36,6 +47,261 @@ namespace glge
      */
     inline float sqrt(float value) noexcept(true) {return sqrtf(value);} 
 
+    /**
+     * @brief compute the squareroot of a value without narrowing it to a float
+     * 
+     * @param value the value to compute the squareroot of
+     * @return double the squareroot of the inputted value
+     */
+    inline double sqrt(double value) noexcept(true) {return std::sqrt(value);}
+
+    //the SIMD versions are only available if SIMD is enabled
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief compute the squareroots of 4 floats at once
+     * 
+     * @param value the values to compute the squareroots of
+     * @return __m128 the squareroots of the values
+     */
+    inline __m128 sqrt(__m128 value) noexcept(true) {return _mm_sqrt_ps(value);}
+
+    /**
+     * @brief compute the squareroots of 2 doubles at once
+     * 
+     * @param value the values to compute the squareroots of
+     * @return __m128d the squareroots of the values
+     */
+    inline __m128d sqrt(__m128d value) noexcept(true) {return _mm_sqrt_pd(value);}
+
+    //the 256 bit versions need AVX
+    #if GLGE_MATH_ALLOW_AVX2
+
+    /**
+     * @brief compute the squareroots of 8 floats at once
+     * 
+     * @param value the values to compute the squareroots of
+     * @return __m256 the squareroots of the values
+     */
+    inline __m256 sqrt(__m256 value) noexcept(true) {return _mm256_sqrt_ps(value);}
+
+    /**
+     * @brief compute the squareroots of 4 doubles at once
+     * 
+     * @param value the values to compute the squareroots of
+     * @return __m256d the squareroots of the values
+     */
+    inline __m256d sqrt(__m256d value) noexcept(true) {return _mm256_sqrt_pd(value);}
+
+    #endif
+
+    #endif
+
+    /**
+     * @brief select how exact length() and normalize() of the float vectors are
+     * 
+     * Fast uses the approximate reciprocal square root of SSE (relative error at most 1.5 * 2^-12) refined by a single 
+     * Newton-Raphson step. For squared lengths of at least FLT_MIN (lengths of at least about 1.1e-19) the relative error of the 
+     * reciprocal square root is below 3e-7 (about 2.5 * FLT_EPSILON). The length also includes the rounding of the squared length 
+     * and of the final product, so its relative error is below 4.5e-7, normalized vectors have a length within 
+     * 5e-7 of 1. A vector of length 0 has a fast length of 0 and stays (0, 0, 0) when it is 
+     * normalized fast (the exact version results in NaN), smaller squared lengths are treated like FLT_MIN. 
+     * Without SIMD Fast is computed exactly. 
+     */
+    enum class Precision {
+        //use the square root and a division
+        Exact,
+        //use the refined approximation of the reciprocal square root and a multiplication
+        Fast
+    };
+
+    /**
+     * @brief the precision that is used if no precision is requested explicitly (see GLGE_MATH_FAST_NORMALIZE)
+     */
+    constexpr Precision DefaultPrecision = GLGE_MATH_FAST_NORMALIZE ? Precision::Fast : Precision::Exact;
+
+    /**
+     * @brief compute an approximation of the reciprocal square root of a value
+     * 
+     * See Precision::Fast for the error bound
+     * 
+     * @param value the value to compute the reciprocal square root of
+     * @return float approximately 1 / sqrt(value)
+     */
+    inline float rsqrtFast(float value) noexcept(true) {
+        //values below the smallest normal float would result in infinity
+        value = (value > FLT_MIN) ? value : FLT_MIN;
+        #if GLGE_MATH_USE_SIMD
+        float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+        //one Newton-Raphson step: y * (3 - value * y * y) / 2
+        return y * (1.5f - (0.5f * value) * (y * y));
+        #else
+        return 1.f / sqrtf(value);
+        #endif
+    }
+
+    //the SIMD version is only available if SIMD is enabled
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief compute an approximation of the reciprocal square root of 4 values at once
+     * 
+     * Same steps as rsqrtFast(float), so the results are identical
+     * 
+     * @param value the values to compute the reciprocal square root of
+     * @return __m128 approximately 1 / sqrt(value)
+     */
+    inline __m128 rsqrtFast(__m128 value) noexcept(true) {
+        value = _mm_max_ps(value, _mm_set1_ps(FLT_MIN));
+        __m128 y = _mm_rsqrt_ps(value);
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), value), _mm_mul_ps(y, y))));
+    }
+
+    #endif
+
+    /**
+     * @brief compute a * b + c
+     * 
+     * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h). 
+     * Else they are rounded on their own, so the fallback is as fast as the plain expression instead of emulating the fused rounding. 
+     * 
+     * @param a the first factor
+     * @param b the second factor
+     * @param c the value to add to the product
+     * @return float the sum of the product and c
+     */
+    inline float fma(float a, float b, float c) noexcept(true) {
+        #if GLGE_MATH_ALLOW_FMA
+        return std::fma(a, b, c);
+        #else
+        return a * b + c;
+        #endif
+    }
+
+    /**
+     * @brief compute a * b + c
+     * 
+     * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h). 
+     * Else they are rounded on their own, so the fallback is as fast as the plain expression instead of emulating the fused rounding. 
+     * 
+     * @param a the first factor
+     * @param b the second factor
+     * @param c the value to add to the product
+     * @return double the sum of the product and c
+     */
+    inline double fma(double a, double b, double c) noexcept(true) {
+        #if GLGE_MATH_ALLOW_FMA
+        return std::fma(a, b, c);
+        #else
+        return a * b + c;
+        #endif
+    }
+
+    /**
+     * @brief compute the sine and the cosine of an angle at once
+     * 
+     * The transcendental functions of the library evaluate polynomial approximations with SIMD instead of calling the C math 
+     * library. The arguments of sin, cos and tan are reduced by multiples of pi/2 in four steps whose products are exact with 
+     * and without FMA3, so the bounds are the same for all instruction sets. The float pow raises the floats to the power in 
+     * double precision. The maximum errors measured against a long double reference with all instruction sets: 
+     * 
+     * | function | float                     | double                            |
+     * |----------|---------------------------|-----------------------------------|
+     * | sin, cos | 1.6 ulp for abs(x) <= 100 | 2.5 ulp for abs(x) <= 1e5         |
+     * | tan      | 3.5 ulp for abs(x) <= 100 | 3.4 ulp for abs(x) <= 100         |
+     * | atan2    | 3.2 ulp                   | 1.7 ulp                           |
+     * | exp      | 1.1 ulp                   | 1.0 ulp                           |
+     * | log      | 0.9 ulp                   | 0.9 ulp                           |
+     * | pow      | 0.6 ulp                   | 300 ulp for abs(y * log(x)) < 210 |
+     * 
+     * For larger arguments sin and cos are still exact to an absolute error of 7.5e-8 (floats, abs(x) <= 1e4) and 1.6e-16 
+     * (doubles, abs(x) <= 1e5). The reduction is not exact beyond that, so larger angles and infinities are passed to std::sin 
+     * and std::cos one by one. Their results are as exact as the C math library and the same for all instruction sets. exp 
+     * flushes results below the smallest normal value to 0 and overflows to infinity, log returns -infinity for 0 and NaN for 
+     * negative values. pow(x, y) is computed as exp(y * log(x)), so negative bases result in NaN and the error of the double 
+     * version grows with abs(y * log(x)). sin and tan keep the sign of a zero angle. atan2 ignores the sign of x if x is 0 and 
+     * returns +-pi/4 or +-3pi/4 if x and y are infinite. NaNs are passed through by all functions. 
+     * 
+     * @param x the angle in radians
+     * @param s a reference to write the sine to
+     * @param c a reference to write the cosine to
+     */
+    void sincos(float x, float& s, float& c) noexcept(true);
+
+    /**
+     * @brief compute the sine and the cosine of an angle at once (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the angle in radians
+     * @param s a reference to write the sine to
+     * @param c a reference to write the cosine to
+     */
+    void sincos(double x, double& s, double& c) noexcept(true);
+
+    /**
+     * @brief compute the sine of an angle (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the angle in radians
+     * @return float the sine of the angle
+     */
+    float sin(float x) noexcept(true);
+    double sin(double x) noexcept(true);
+
+    /**
+     * @brief compute the cosine of an angle (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the angle in radians
+     * @return float the cosine of the angle
+     */
+    float cos(float x) noexcept(true);
+    double cos(double x) noexcept(true);
+
+    /**
+     * @brief compute the tangent of an angle (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the angle in radians
+     * @return float the tangent of the angle
+     */
+    float tan(float x) noexcept(true);
+    double tan(double x) noexcept(true);
+
+    /**
+     * @brief compute the angle between the positive x axis and a point (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param y the y coordinate of the point
+     * @param x the x coordinate of the point
+     * @return float the angle in radians in the range [-pi, pi]
+     */
+    float atan2(float y, float x) noexcept(true);
+    double atan2(double y, double x) noexcept(true);
+
+    /**
+     * @brief compute e to the power of a value (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the exponent
+     * @return float e^x
+     */
+    float exp(float x) noexcept(true);
+    double exp(double x) noexcept(true);
+
+    /**
+     * @brief compute the natural logarithm of a value (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the value to compute the logarithm of
+     * @return float the natural logarithm of x
+     */
+    float log(float x) noexcept(true);
+    double log(double x) noexcept(true);
+
+    /**
+     * @brief compute a value to the power of another (see sincos(float, float&, float&) for the accuracy)
+     * 
+     * @param x the base (must not be negative)
+     * @param y the exponent
+     * @return float x^y
+     */
+    float pow(float x, float y) noexcept(true);
+    double pow(double x, double y) noexcept(true);
+
 };
 
 #endif
@@ -53,9 +319,261 @@ extern "C" {
  */
 float glge_sqrt(float value);
 
+/**
+ * @brief compute the squareroot of a double without narrowing it to a float
+ * 
+ * @param value the value to compute the squareroot of
+ * @return double the squareroot of the inputted value
+ */
+double glge_dsqrt(double value);
+
+/**
+ * @brief compute the squareroots of an array of floats
+ * 
+ * The array is processed with the widest instruction set of the CPU (see GLGE_Dispatch.h), the results are identical to glge_sqrt
+ * 
+ * @param in a pointer to the values
+ * @param out a pointer to write the squareroots to (may be in)
+ * @param n the amount of values
+ */
+void glge_sqrtArray(const float* in, float* out, size_t n);
+
+/**
+ * @brief compute the squareroots of an array of doubles
+ * 
+ * The array is processed with the widest instruction set of the CPU (see GLGE_Dispatch.h), the results are identical to glge_dsqrt
+ * 
+ * @param in a pointer to the values
+ * @param out a pointer to write the squareroots to (may be in)
+ * @param n the amount of values
+ */
+void glge_dsqrtArray(const double* in, double* out, size_t n);
+
+/**
+ * @brief compute the sine and the cosine of an angle at once (see glge::sincos for the accuracy)
+ * 
+ * @param x the angle in radians
+ * @param s a pointer to write the sine to
+ * @param c a pointer to write the cosine to
+ */
+void glge_sincos(float x, float* s, float* c);
+
+/**
+ * @brief compute the sine of an angle (see glge::sincos for the accuracy)
+ * 
+ * @param x the angle in radians
+ * @return float the sine of the angle
+ */
+float glge_sin(float x);
+
+/**
+ * @brief compute the cosine of an angle (see glge::sincos for the accuracy)
+ * 
+ * @param x the angle in radians
+ * @return float the cosine of the angle
+ */
+float glge_cos(float x);
+
+/**
+ * @brief compute the tangent of an angle (see glge::sincos for the accuracy)
+ * 
+ * @param x the angle in radians
+ * @return float the tangent of the angle
+ */
+float glge_tan(float x);
+
+/**
+ * @brief compute the angle between the positive x axis and a point (see glge::sincos for the accuracy)
+ * 
+ * @param y the y coordinate of the point
+ * @param x the x coordinate of the point
+ * @return float the angle in radians in the range [-pi, pi]
+ */
+float glge_atan2(float y, float x);
+
+/**
+ * @brief compute e to the power of a value (see glge::sincos for the accuracy)
+ * 
+ * @param x the exponent
+ * @return float e^x
+ */
+float glge_exp(float x);
+
+/**
+ * @brief compute the natural logarithm of a value (see glge::sincos for the accuracy)
+ * 
+ * @param x the value to compute the logarithm of
+ * @return float the natural logarithm of x
+ */
+float glge_log(float x);
+
+/**
+ * @brief compute a value to the power of another (see glge::sincos for the accuracy)
+ * 
+ * @param x the base (must not be negative)
+ * @param y the exponent
+ * @return float x^y
+ */
+float glge_pow(float x, float y);
+
+//the same functions for doubles
+void glge_dsincos(double x, double* s, double* c);
+double glge_dsin(double x);
+double glge_dcos(double x);
+double glge_dtan(double x);
+double glge_datan2(double y, double x);
+double glge_dexp(double x);
+double glge_dlog(double x);
+double glge_dpow(double x, double y);
+
+/**
+ * @brief compute the sines and cosines of an array of angles
+ * 
+ * The arrays are processed with the widest instruction set of the CPU (see GLGE_Dispatch.h), the accuracy is the same as the one of glge_sincos
+ * 
+ * @param in a pointer to the angles in radians
+ * @param s a pointer to write the sines to (may be in)
+ * @param c a pointer to write the cosines to (may be in, but not s)
+ * @param n the amount of angles
+ */
+void glge_sincosArray(const float* in, float* s, float* c, size_t n);
+
+/**
+ * @brief apply a function to every element of an array
+ * 
+ * The arrays are processed with the widest instruction set of the CPU (see GLGE_Dispatch.h), the accuracy is the same as the 
+ * one of the single value functions
+ * 
+ * @param in a pointer to the arguments
+ * @param out a pointer to write the results to (may be in)
+ * @param n the amount of elements
+ */
+void glge_sinArray(const float* in, float* out, size_t n);
+void glge_cosArray(const float* in, float* out, size_t n);
+void glge_tanArray(const float* in, float* out, size_t n);
+void glge_expArray(const float* in, float* out, size_t n);
+void glge_logArray(const float* in, float* out, size_t n);
+
+/**
+ * @brief compute atan2 for every pair of elements of two arrays
+ * 
+ * @param y a pointer to the y coordinates
+ * @param x a pointer to the x coordinates
+ * @param out a pointer to write the angles to (may be x or y)
+ * @param n the amount of elements
+ */
+void glge_atan2Array(const float* y, const float* x, float* out, size_t n);
+
+/**
+ * @brief raise every element of an array to the power of the element of a second array
+ * 
+ * @param x a pointer to the bases
+ * @param y a pointer to the exponents
+ * @param out a pointer to write the powers to (may be x or y)
+ * @param n the amount of elements
+ */
+void glge_powArray(const float* x, const float* y, float* out, size_t n);
+
+//the same array functions for doubles
+void glge_dsincosArray(const double* in, double* s, double* c, size_t n);
+void glge_dsinArray(const double* in, double* out, size_t n);
+void glge_dcosArray(const double* in, double* out, size_t n);
+void glge_dtanArray(const double* in, double* out, size_t n);
+void glge_dexpArray(const double* in, double* out, size_t n);
+void glge_dlogArray(const double* in, double* out, size_t n);
+void glge_datan2Array(const double* y, const double* x, double* out, size_t n);
+void glge_dpowArray(const double* x, const double* y, double* out, size_t n);
+
+/**
+ * @brief allocate a block of memory with a specific alignment
+ * 
+ * @param size the size of the memory block in bytes
+ * @param alignment the alignment of the memory block in bytes (must be a power of two)
+ * @return void* a pointer to the memory block or NULL if the allocation failed. Must be freed using glge_alignedFree
+ */
+void* glge_alignedAlloc(size_t size, size_t alignment);
+
+/**
+ * @brief free a block of memory that was allocated using glge_alignedAlloc
+ * 
+ * @param ptr a pointer to the memory block to free (NULL is ignored)
+ */
+void glge_alignedFree(void* ptr);
+
 //end the C section
 #if __cplusplus
 }
 #endif
 
+//the array overloads for C++
+#if __cplusplus
+
+namespace glge
+{
+
+    /**
+     * @brief compute the squareroots of an array (see glge_sqrtArray)
+     * 
+     * @param in a pointer to the values
+     * @param out a pointer to write the squareroots to (may be in)
+     * @param count the amount of values
+     */
+    inline void sqrt(const float* in, float* out, size_t count) noexcept {glge_sqrtArray(in, out, count);}
+    inline void sqrt(const double* in, double* out, size_t count) noexcept {glge_dsqrtArray(in, out, count);}
+
+    /**
+     * @brief compute the sines and cosines of an array of angles (see glge_sincosArray)
+     * 
+     * @param in a pointer to the angles in radians
+     * @param s a pointer to write the sines to (may be in)
+     * @param c a pointer to write the cosines to (may be in, but not s)
+     * @param count the amount of angles
+     */
+    inline void sincos(const float* in, float* s, float* c, size_t count) noexcept {glge_sincosArray(in, s, c, count);}
+    inline void sincos(const double* in, double* s, double* c, size_t count) noexcept {glge_dsincosArray(in, s, c, count);}
+
+    /**
+     * @brief apply a function to every element of an array (see glge_sinArray)
+     * 
+     * @param in a pointer to the arguments
+     * @param out a pointer to write the results to (may be in)
+     * @param count the amount of elements
+     */
+    inline void sin(const float* in, float* out, size_t count) noexcept {glge_sinArray(in, out, count);}
+    inline void sin(const double* in, double* out, size_t count) noexcept {glge_dsinArray(in, out, count);}
+    inline void cos(const float* in, float* out, size_t count) noexcept {glge_cosArray(in, out, count);}
+    inline void cos(const double* in, double* out, size_t count) noexcept {glge_dcosArray(in, out, count);}
+    inline void tan(const float* in, float* out, size_t count) noexcept {glge_tanArray(in, out, count);}
+    inline void tan(const double* in, double* out, size_t count) noexcept {glge_dtanArray(in, out, count);}
+    inline void exp(const float* in, float* out, size_t count) noexcept {glge_expArray(in, out, count);}
+    inline void exp(const double* in, double* out, size_t count) noexcept {glge_dexpArray(in, out, count);}
+    inline void log(const float* in, float* out, size_t count) noexcept {glge_logArray(in, out, count);}
+    inline void log(const double* in, double* out, size_t count) noexcept {glge_dlogArray(in, out, count);}
+
+    /**
+     * @brief compute atan2 for every pair of elements of two arrays (see glge_atan2Array)
+     * 
+     * @param y a pointer to the y coordinates
+     * @param x a pointer to the x coordinates
+     * @param out a pointer to write the angles to (may be x or y)
+     * @param count the amount of elements
+     */
+    inline void atan2(const float* y, const float* x, float* out, size_t count) noexcept {glge_atan2Array(y, x, out, count);}
+    inline void atan2(const double* y, const double* x, double* out, size_t count) noexcept {glge_datan2Array(y, x, out, count);}
+
+    /**
+     * @brief raise every element of an array to the power of the element of a second array (see glge_powArray)
+     * 
+     * @param x a pointer to the bases
+     * @param y a pointer to the exponents
+     * @param out a pointer to write the powers to (may be x or y)
+     * @param count the amount of elements
+     */
+    inline void pow(const float* x, const float* y, float* out, size_t count) noexcept {glge_powArray(x, y, out, count);}
+    inline void pow(const double* x, const double* y, double* out, size_t count) noexcept {glge_dpowArray(x, y, out, count);}
+
+};
+
+#endif
+
 #endif
\ No newline at end of file
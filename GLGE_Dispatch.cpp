@@ -0,0 +1,150 @@
+/**
+ * @file GLGE_Dispatch.cpp
+ * @author DM8AT
+ * @brief implement the runtime selection of the instruction set for the batch functions
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the dispatch API
+#include "GLGE_Dispatch.h"
+//include the kernel tables
+#include "Kernels/GLGE_KernelTable.hpp"
+//the selected table is shared between all threads
+#include <atomic>
+
+//include the CPU identification for the used compiler
+#if GLGE_MATH_USE_SIMD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/**
+ * @brief get the table for an instruction set
+ * 
+ * @param level the instruction set
+ * @return const glge::kernel::KernelTable* the table or NULL if the instruction set was not compiled into the library
+ */
+static const glge::kernel::KernelTable* getTable(SIMDLevel level) noexcept {
+    switch (level) {
+    case GLGE_SIMD_LEVEL_SCALAR: return glge::kernel::getTableScalar();
+    #if GLGE_MATH_USE_SIMD
+    case GLGE_SIMD_LEVEL_SSE2: return glge::kernel::getTableSSE2();
+    #if defined(GLGE_MATH_KERNELS_SSE41)
+    case GLGE_SIMD_LEVEL_SSE41: return glge::kernel::getTableSSE41();
+    #endif
+    #if defined(GLGE_MATH_KERNELS_AVX2)
+    case GLGE_SIMD_LEVEL_AVX2: return glge::kernel::getTableAVX2();
+    #endif
+    #if defined(GLGE_MATH_KERNELS_AVX512)
+    case GLGE_SIMD_LEVEL_AVX512: return glge::kernel::getTableAVX512();
+    #endif
+    #endif
+    default: return NULL;
+    }
+}
+
+/**
+ * @brief detect the best instruction set the CPU and the operating system support
+ * 
+ * @return SIMDLevel the best instruction set of the CPU
+ */
+static SIMDLevel detectCPULevel() noexcept {
+    #if GLGE_MATH_USE_SIMD && (defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86))
+    //read the feature flags (eax, ebx, ecx, edx)
+    unsigned int regs[4] = {0, 0, 0, 0};
+    auto cpuid = [&regs](unsigned int leaf) noexcept -> bool {
+        #if defined(_MSC_VER)
+        int r[4];
+        __cpuid(r, 0);
+        if ((unsigned int)r[0] < leaf) {return false;}
+        __cpuidex(r, (int)leaf, 0);
+        for (int i = 0; i < 4; ++i) {regs[i] = (unsigned int)r[i];}
+        return true;
+        #else
+        return __get_cpuid_count(leaf, 0, &regs[0], &regs[1], &regs[2], &regs[3]) != 0;
+        #endif
+    };
+
+    if (!cpuid(1) || !(regs[3] & (1u << 26))) {return GLGE_SIMD_LEVEL_SCALAR;}
+    if (!(regs[2] & (1u << 19))) {return GLGE_SIMD_LEVEL_SSE2;}
+    //AVX needs support of the operating system to save the registers (OSXSAVE), the kernels also need FMA3
+    bool avx = (regs[2] & (1u << 27)) && (regs[2] & (1u << 28)) && (regs[2] & (1u << 12));
+    if (!avx) {return GLGE_SIMD_LEVEL_SSE41;}
+
+    //check which registers the operating system saves
+    #if defined(_MSC_VER)
+    unsigned long long xcr0 = _xgetbv(0);
+    #else
+    unsigned int xlo, xhi;
+    __asm__ volatile ("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+    unsigned long long xcr0 = ((unsigned long long)xhi << 32) | xlo;
+    #endif
+    //the XMM and YMM registers must be saved
+    if ((xcr0 & 0x6) != 0x6 || !cpuid(7) || !(regs[1] & (1u << 5))) {return GLGE_SIMD_LEVEL_SSE41;}
+    //AVX-512F additionally needs the opmask and ZMM registers to be saved
+    if ((xcr0 & 0xE6) != 0xE6 || !(regs[1] & (1u << 16))) {return GLGE_SIMD_LEVEL_AVX2;}
+    return GLGE_SIMD_LEVEL_AVX512;
+    #else
+    return GLGE_SIMD_LEVEL_SCALAR;
+    #endif
+}
+
+SIMDLevel glge_getSupportedSIMDLevel(void) {
+    //the CPU can't change while the program is running
+    static const SIMDLevel supported = []() noexcept -> SIMDLevel {
+        //use the best instruction set that was also compiled into the library
+        int level = (int)detectCPULevel();
+        while (level > 0 && !getTable((SIMDLevel)level)) {--level;}
+        return (SIMDLevel)level;
+    }();
+    return supported;
+}
+
+//the currently used instruction set, -1 until it is selected
+static std::atomic<int> s_level(-1);
+//the table of the currently used instruction set
+static std::atomic<const glge::kernel::KernelTable*> s_table(NULL);
+
+SIMDLevel glge_getSIMDLevel(void) {
+    int level = s_level.load(std::memory_order_acquire);
+    return (level < 0) ? glge_getSupportedSIMDLevel() : (SIMDLevel)level;
+}
+
+bool glge_setSIMDLevel(SIMDLevel level) {
+    if ((int)level < 0 || level > glge_getSupportedSIMDLevel()) {return false;}
+    s_table.store(getTable(level), std::memory_order_release);
+    s_level.store((int)level, std::memory_order_release);
+    return true;
+}
+
+void glge_resetSIMDLevel(void) {glge_setSIMDLevel(glge_getSupportedSIMDLevel());}
+
+const char* glge_getSIMDLevelName(SIMDLevel level) {
+    switch (level) {
+    case GLGE_SIMD_LEVEL_SCALAR: return "Scalar";
+    case GLGE_SIMD_LEVEL_SSE2: return "SSE2";
+    case GLGE_SIMD_LEVEL_SSE41: return "SSE4.1";
+    case GLGE_SIMD_LEVEL_AVX2: return "AVX2";
+    case GLGE_SIMD_LEVEL_AVX512: return "AVX-512";
+    default: return "Unknown";
+    }
+}
+
+const glge::kernel::KernelTable& glge::kernel::table() noexcept {
+    const KernelTable* t = s_table.load(std::memory_order_acquire);
+    //select the best instruction set the first time a kernel is used
+    if (!t) {
+        const KernelTable* best = getTable(glge_getSupportedSIMDLevel());
+        //if another thread selected an instruction set in the meantime, its selection is kept
+        if (!s_table.compare_exchange_strong(t, best, std::memory_order_acq_rel)) {return *t;}
+        t = best;
+    }
+    return *t;
+}
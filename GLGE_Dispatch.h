@@ -0,0 +1,86 @@
+/**
+ * @file GLGE_Dispatch.h
+ * @author DM8AT
+ * @brief query and override the instruction set that is used by the batch functions
+ * 
+ * The batch functions (for example mat4_applyArray or the structure of arrays containers) are compiled for multiple
+ * instruction sets. The best one that is supported by the CPU is selected the first time a batch function is called.
+ * The inline functions of the headers are not affected, they use the instruction sets the including code is compiled for.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_DISPATCH_
+#define _GLGE_DISPATCH_
+
+//include the settings
+#include "GLGEMath_Settings.h"
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief the instruction sets the batch functions can use
+ */
+typedef enum e_SIMDLevel {
+    //don't use any SIMD instructions
+    GLGE_SIMD_LEVEL_SCALAR = 0,
+    //use SSE2 (128 bit registers)
+    GLGE_SIMD_LEVEL_SSE2 = 1,
+    //use SSE4.1 (128 bit registers)
+    GLGE_SIMD_LEVEL_SSE41 = 2,
+    //use AVX2 and FMA3 (256 bit registers)
+    GLGE_SIMD_LEVEL_AVX2 = 3,
+    //use AVX-512 (512 bit registers)
+    GLGE_SIMD_LEVEL_AVX512 = 4
+} SIMDLevel;
+
+/**
+ * @brief get the instruction set that is currently used by the batch functions
+ * 
+ * @return SIMDLevel the used instruction set
+ */
+SIMDLevel glge_getSIMDLevel(void);
+
+/**
+ * @brief get the best instruction set that is supported by the CPU, the operating system and the library build
+ * 
+ * @return SIMDLevel the best supported instruction set
+ */
+SIMDLevel glge_getSupportedSIMDLevel(void);
+
+/**
+ * @brief override the instruction set that is used by the batch functions, for example for benchmarking
+ * 
+ * @param level the instruction set to use
+ * @return true : the instruction set is used from now on
+ * @return false : the instruction set is not supported, nothing was changed
+ */
+bool glge_setSIMDLevel(SIMDLevel level);
+
+/**
+ * @brief use the best supported instruction set again after it was overridden
+ */
+void glge_resetSIMDLevel(void);
+
+/**
+ * @brief get a readable name for an instruction set
+ * 
+ * @param level the instruction set to get the name of
+ * @return const char* the name of the instruction set (for example "AVX2")
+ */
+const char* glge_getSIMDLevelName(SIMDLevel level);
+
+//end the C section
+#if __cplusplus
+}
+#endif
+
+#endif
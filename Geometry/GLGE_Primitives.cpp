@@ -0,0 +1,57 @@
+/**
+ * @file GLGE_Primitives.cpp
+ * @author DM8AT
+ * @brief implement the C function binding and the batch functions for the geometric primitives
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the primitives
+#include "GLGE_Primitives.h"
+//include the batch kernels
+#include "../Kernels/GLGE_KernelTable.hpp"
+
+bool aabb3_overlaps(const aabb3* a, const aabb3* b) {return a->overlaps(*b);}
+
+bool aabb3_contains(const aabb3* b, const vec3* p) {return b->contains(*p);}
+
+aabb3 aabb3_transform(const aabb3* b, const mat4* m) {return b->transform(*m);}
+
+size_t aabb3_overlapArray(const aabb3* box, const aabb3* boxes, size_t n, uint32_t* hits)
+{return glge::kernel::table().aabbOverlaps((const float*)box, (const float*)boxes, n, hits, true);}
+
+size_t aabb3_overlapArrayMask(const aabb3* box, const aabb3* boxes, size_t n, uint32_t* mask)
+{return glge::kernel::table().aabbOverlaps((const float*)box, (const float*)boxes, n, mask, false);}
+
+void aabb3_transformArray(const mat4* m, const aabb3* in, aabb3* out, size_t n)
+{glge::kernel::table().aabbTransform(m->m, (const float*)in, (float*)out, n);}
+
+bool sphere_overlaps(const sphere* a, const sphere* b) {return a->overlaps(*b);}
+
+bool sphere_overlapsAABB(const sphere* s, const aabb3* b) {return s->overlaps(*b);}
+
+float plane_distance(const plane* p, const vec3* point) {return p->distanceTo(*point);}
+
+bool ray3_intersectAABB(const ray3* r, const aabb3* b, float tMax, float* t) {return r->intersect(*b, tMax, t);}
+
+bool ray3_intersectSphere(const ray3* r, const sphere* s, float tMax, float* t) {return r->intersect(*s, tMax, t);}
+
+bool ray3_intersectPlane(const ray3* r, const plane* p, float tMax, float* t) {return r->intersect(*p, tMax, t);}
+
+size_t ray3_intersectAABBs(const ray3* r, const aabb3* boxes, size_t n, float tMax, float* t) {
+    //the inverse direction is computed once for all boxes, the same way as in ray3::intersect
+    const vec3& o = r->origin;
+    const vec3& d = r->direction;
+    float ray[7] = {o.x, o.y, o.z, 1.f / d.x, 1.f / d.y, 1.f / d.z, tMax};
+    return glge::kernel::table().rayAABBs(ray, (const float*)boxes, n, t);
+}
+
+size_t ray3_intersectSpheres(const ray3* r, const sphere* spheres, size_t n, float tMax, float* t) {
+    const vec3& o = r->origin;
+    const vec3& d = r->direction;
+    float ray[8] = {o.x, o.y, o.z, d.x, d.y, d.z, (d.x * d.x + d.y * d.y) + d.z * d.z, tMax};
+    return glge::kernel::table().raySpheres(ray, (const float*)spheres, n, t);
+}
\ No newline at end of file
@@ -0,0 +1,652 @@
+/**
+ * @file GLGE_Primitives.h
+ * @author DM8AT
+ * @brief define the geometric primitives axis aligned boxes, spheres, planes and rays and the tests between them
+ * 
+ * The primitives are plain structures of vec3s and floats, so arrays of them can be passed to the batch functions
+ * directly. The batch functions split multiple primitives into one register per element if the CPU supports wide
+ * registers and test all of them against a single ray or box at once, this is used for picking and for the broad
+ * phase of collision detection.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_PRIMITIVES_
+#define _GLGE_PRIMITIVES_
+
+//include the vectors the primitives are made of
+#include "../Vector/floats/GLGE_vec3.h"
+//include the 4x4 matrices for transforming boxes
+#include "../Matrix/floats/GLGE_mat4.h"
+//include the fixed size integers for the indices and the bitmasks
+#include <stdint.h>
+//include the size type
+#include <stddef.h>
+//include the square root and infinity
+#include <math.h>
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store an axis aligned box by its minimal and maximal corner
+ */
+typedef struct s_aabb3 {
+
+    //the corner with the smallest coordinates
+    vec3 min;
+    //the corner with the largest coordinates
+    vec3 max;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new aabb3
+     * 
+     * Both corners are at the origin
+     */
+    inline constexpr s_aabb3() noexcept
+     : min(), max()
+    {}
+
+    /**
+     * @brief Construct a new aabb3
+     * 
+     * @param _min the corner with the smallest coordinates
+     * @param _max the corner with the largest coordinates
+     */
+    inline constexpr s_aabb3(const vec3& _min, const vec3& _max) noexcept
+     : min(_min), max(_max)
+    {}
+
+    /**
+     * @brief get the center of the box
+     * 
+     * @return vec3 the point in the middle of both corners
+     */
+    inline vec3 center() const noexcept {return vec3((min.x + max.x) * 0.5f, (min.y + max.y) * 0.5f, (min.z + max.z) * 0.5f);}
+
+    /**
+     * @brief get the half size of the box
+     * 
+     * @return vec3 the distance from the center to the maximal corner
+     */
+    inline vec3 extents() const noexcept {return vec3((max.x - min.x) * 0.5f, (max.y - min.y) * 0.5f, (max.z - min.z) * 0.5f);}
+
+    /**
+     * @brief check if a point is inside of the box or on its surface
+     * 
+     * @param p the point to check
+     * @return true : the point is inside of the box
+     * @return false : the point is outside of the box
+     */
+    inline bool contains(const vec3& p) const noexcept
+    {return (p.x >= min.x) && (p.x <= max.x) && (p.y >= min.y) && (p.y <= max.y) && (p.z >= min.z) && (p.z <= max.z);}
+
+    /**
+     * @brief check if the box overlaps another box, touching boxes overlap
+     * 
+     * @param b the other box
+     * @return true : the boxes overlap
+     * @return false : the boxes are separated along at least one axis
+     */
+    inline bool overlaps(const s_aabb3& b) const noexcept {
+        for (size_t k = 0; k < 3; ++k)
+        {if ((b.max.vals[k] < min.vals[k]) || (max.vals[k] < b.min.vals[k])) {return false;}}
+        return true;
+    }
+
+    /**
+     * @brief transform the box by a matrix and compute the box around the result (Arvo's method)
+     * 
+     * @param m the matrix to transform the box with, only the upper 3x4 part is used
+     * @return s_aabb3 the smallest axis aligned box that contains the transformed box
+     */
+    inline s_aabb3 transform(const mat4& m) const noexcept {
+        s_aabb3 r;
+        for (size_t row = 0; row < 3; ++row) {
+            float lo = m.m[row*4 + 3];
+            float hi = lo;
+            for (size_t col = 0; col < 3; ++col) {
+                float a = m.m[row*4 + col] * min.vals[col];
+                float b = m.m[row*4 + col] * max.vals[col];
+                lo = lo + ((a < b) ? a : b);
+                hi = hi + ((a > b) ? a : b);
+            }
+            r.min.vals[row] = lo;
+            r.max.vals[row] = hi;
+        }
+        return r;
+    }
+
+    #endif
+
+} aabb3;
+
+/**
+ * @brief store a sphere by its center and its radius
+ * 
+ * A sphere takes 4 floats, so an array of spheres can also be used as an array of vec4 (center and radius)
+ */
+typedef struct s_sphere {
+
+    //the center of the sphere
+    vec3 center;
+    //the radius of the sphere
+    float radius;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new sphere
+     * 
+     * The sphere is a point at the origin
+     */
+    inline constexpr s_sphere() noexcept
+     : center(), radius(0)
+    {}
+
+    /**
+     * @brief Construct a new sphere
+     * 
+     * @param _center the center of the sphere
+     * @param _radius the radius of the sphere
+     */
+    inline constexpr s_sphere(const vec3& _center, float _radius) noexcept
+     : center(_center), radius(_radius)
+    {}
+
+    /**
+     * @brief check if a point is inside of the sphere or on its surface
+     * 
+     * @param p the point to check
+     * @return true : the point is inside of the sphere
+     * @return false : the point is outside of the sphere
+     */
+    inline bool contains(const vec3& p) const noexcept {
+        vec3 d = p - center;
+        return ((d.x * d.x + d.y * d.y) + d.z * d.z) <= radius * radius;
+    }
+
+    /**
+     * @brief check if the sphere overlaps another sphere, touching spheres overlap
+     * 
+     * @param s the other sphere
+     * @return true : the spheres overlap
+     * @return false : the spheres are separated
+     */
+    inline bool overlaps(const s_sphere& s) const noexcept {
+        vec3 d = s.center - center;
+        float r = radius + s.radius;
+        return ((d.x * d.x + d.y * d.y) + d.z * d.z) <= r * r;
+    }
+
+    /**
+     * @brief check if the sphere overlaps an axis aligned box
+     * 
+     * The point of the box that is closest to the center is compared against the radius
+     * 
+     * @param b the box
+     * @return true : the sphere and the box overlap
+     * @return false : the sphere and the box are separated
+     */
+    inline bool overlaps(const aabb3& b) const noexcept {
+        float d2 = 0.f;
+        for (size_t k = 0; k < 3; ++k) {
+            float c = center.vals[k];
+            float d = (c < b.min.vals[k]) ? (b.min.vals[k] - c) : ((c > b.max.vals[k]) ? (c - b.max.vals[k]) : 0.f);
+            d2 = d2 + d * d;
+        }
+        return d2 <= radius * radius;
+    }
+
+    #endif
+
+} sphere;
+
+/**
+ * @brief store a plane by its normal and its distance
+ * 
+ * A point p is on the plane if dot(normal, p) + distance is 0. If the normal is normalized that value is the signed
+ * distance of p to the plane, points in front of the plane have a positive distance. The layout is the same as the
+ * planes of a Frustum.
+ */
+typedef struct s_plane {
+
+    //the normal of the plane
+    vec3 normal;
+    //the negated distance of the plane to the origin along the normal
+    float distance;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new plane
+     * 
+     * The plane is the xz plane through the origin
+     */
+    inline constexpr s_plane() noexcept
+     : normal(0, 1, 0), distance(0)
+    {}
+
+    /**
+     * @brief Construct a new plane
+     * 
+     * @param _normal the normal of the plane
+     * @param _distance the value that is added to dot(normal, p)
+     */
+    inline constexpr s_plane(const vec3& _normal, float _distance) noexcept
+     : normal(_normal), distance(_distance)
+    {}
+
+    /**
+     * @brief Construct a new plane through a point
+     * 
+     * @param _normal the normal of the plane
+     * @param point a point on the plane
+     */
+    inline constexpr s_plane(const vec3& _normal, const vec3& point) noexcept
+     : normal(_normal), distance(-((_normal.x * point.x + _normal.y * point.y) + _normal.z * point.z))
+    {}
+
+    /**
+     * @brief compute the signed distance of a point to the plane
+     * 
+     * @param p the point
+     * @return float the distance, scaled by the length of the normal if it is not normalized
+     */
+    inline float distanceTo(const vec3& p) const noexcept {return ((normal.x * p.x + normal.y * p.y) + normal.z * p.z) + distance;}
+
+    #endif
+
+} plane;
+
+/**
+ * @brief store a ray by its origin and its direction
+ */
+typedef struct s_ray3 {
+
+    //the point the ray starts at
+    vec3 origin;
+    //the direction of the ray, the distances of the intersections are measured in multiples of it
+    vec3 direction;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new ray3
+     * 
+     * The ray starts at the origin and points along the negative z axis
+     */
+    inline constexpr s_ray3() noexcept
+     : origin(), direction(0, 0, -1)
+    {}
+
+    /**
+     * @brief Construct a new ray3
+     * 
+     * @param _origin the point the ray starts at
+     * @param _direction the direction of the ray
+     */
+    inline constexpr s_ray3(const vec3& _origin, const vec3& _direction) noexcept
+     : origin(_origin), direction(_direction)
+    {}
+
+    /**
+     * @brief get a point on the ray
+     * 
+     * @param t the distance along the ray in multiples of the direction
+     * @return vec3 the point origin + direction * t
+     */
+    inline vec3 at(float t) const noexcept
+    {return vec3(origin.x + direction.x * t, origin.y + direction.y * t, origin.z + direction.z * t);}
+
+    /**
+     * @brief intersect the ray with an axis aligned box using the slab test
+     * 
+     * The distances where the ray enters and leaves the slab of every axis are intersected, the ray hits the box if
+     * the resulting range is not empty. If the origin is inside of the box the distance is 0. The box is closed, so a ray
+     * that starts on a face and runs along it hits the box as well.
+     * 
+     * @param b the box
+     * @param tMax the maximal distance along the ray
+     * @param t a pointer to write the distance where the ray enters the box to or NULL
+     * @return true : the ray hits the box between 0 and tMax
+     * @return false : the ray misses the box
+     */
+    inline bool intersect(const aabb3& b, float tMax, float* t) const noexcept {
+        float tNear = 0.f;
+        float tFar = tMax;
+        for (size_t k = 0; k < 3; ++k) {
+            //the ray enters the slab at the bound it points away from, -0 has an inverse of -infinity and counts as negative
+            float inv = 1.f / direction.vals[k];
+            bool negative = inv < 0.f;
+            float tEnter = ((negative ? b.max.vals[k] : b.min.vals[k]) - origin.vals[k]) * inv;
+            float tExit = ((negative ? b.min.vals[k] : b.max.vals[k]) - origin.vals[k]) * inv;
+            //a distance is NaN (0 * infinity) if the ray is parallel to the slab and starts on one of its bounds. The
+            //compares are false for NaN, so the new distance comes first and a NaN never replaces the range
+            tNear = (tEnter > tNear) ? tEnter : tNear;
+            tFar = (tExit < tFar) ? tExit : tFar;
+        }
+        if (tFar < tNear) {return false;}
+        if (t) {*t = tNear;}
+        return true;
+    }
+
+    /**
+     * @brief intersect the ray with a sphere
+     * 
+     * @param s the sphere
+     * @param tMax the maximal distance along the ray
+     * @param t a pointer to write the distance of the first intersection in front of the origin to or NULL
+     * @return true : the ray hits the sphere between 0 and tMax
+     * @return false : the ray misses the sphere
+     */
+    inline bool intersect(const sphere& s, float tMax, float* t) const noexcept {
+        vec3 oc = origin - s.center;
+        float a = (direction.x * direction.x + direction.y * direction.y) + direction.z * direction.z;
+        float b = (oc.x * direction.x + oc.y * direction.y) + oc.z * direction.z;
+        float c = ((oc.x * oc.x + oc.y * oc.y) + oc.z * oc.z) - s.radius * s.radius;
+        float disc = b * b - a * c;
+        if (disc < 0.f) {return false;}
+        float root = sqrtf(disc);
+        float hit = (-b - root) / a;
+        //if the origin is inside of the sphere the ray leaves it at the second intersection
+        if (hit < 0.f) {hit = (-b + root) / a;}
+        if ((hit < 0.f) || (tMax < hit)) {return false;}
+        if (t) {*t = hit;}
+        return true;
+    }
+
+    /**
+     * @brief intersect the ray with a plane
+     * 
+     * @param p the plane
+     * @param tMax the maximal distance along the ray
+     * @param t a pointer to write the distance of the intersection to or NULL
+     * @return true : the ray hits the plane between 0 and tMax
+     * @return false : the ray is parallel to the plane or hits it outside of the range
+     */
+    inline bool intersect(const plane& p, float tMax, float* t) const noexcept {
+        float denom = (p.normal.x * direction.x + p.normal.y * direction.y) + p.normal.z * direction.z;
+        if (denom == 0.f) {return false;}
+        float hit = -p.distanceTo(origin) / denom;
+        if ((hit < 0.f) || (tMax < hit)) {return false;}
+        if (t) {*t = hit;}
+        return true;
+    }
+
+    #endif
+
+} ray3;
+
+/**
+ * @brief check if two axis aligned boxes overlap
+ * 
+ * @param a a pointer to the first box
+ * @param b a pointer to the second box
+ * @return true : the boxes overlap
+ * @return false : the boxes are separated
+ */
+bool aabb3_overlaps(const aabb3* a, const aabb3* b);
+
+/**
+ * @brief check if a point is inside of an axis aligned box
+ * 
+ * @param b a pointer to the box
+ * @param p a pointer to the point
+ * @return true : the point is inside of the box
+ * @return false : the point is outside of the box
+ */
+bool aabb3_contains(const aabb3* b, const vec3* p);
+
+/**
+ * @brief transform an axis aligned box by a matrix and compute the box around the result
+ * 
+ * @param b a pointer to the box
+ * @param m a pointer to the matrix, only the upper 3x4 part is used
+ * @return aabb3 the smallest axis aligned box that contains the transformed box
+ */
+aabb3 aabb3_transform(const aabb3* b, const mat4* m);
+
+/**
+ * @brief find all boxes of an array that overlap a box
+ * 
+ * @param box a pointer to the box to test against
+ * @param boxes a pointer to the boxes to test
+ * @param n the amount of boxes to test
+ * @param hits a pointer to write the indices of the overlapping boxes to in ascending order, it must have room for n indices
+ * @return size_t the amount of overlapping boxes
+ */
+size_t aabb3_overlapArray(const aabb3* box, const aabb3* boxes, size_t n, uint32_t* hits);
+
+/**
+ * @brief mark all boxes of an array that overlap a box
+ * 
+ * @param box a pointer to the box to test against
+ * @param boxes a pointer to the boxes to test
+ * @param n the amount of boxes to test
+ * @param mask a pointer to (n + 31) / 32 words, bit i % 32 of word i / 32 is set if box i overlaps. Unused bits are cleared
+ * @return size_t the amount of overlapping boxes
+ */
+size_t aabb3_overlapArrayMask(const aabb3* box, const aabb3* boxes, size_t n, uint32_t* mask);
+
+/**
+ * @brief transform an array of axis aligned boxes by a matrix
+ * 
+ * @param m a pointer to the matrix, only the upper 3x4 part is used
+ * @param in a pointer to the boxes to transform
+ * @param out a pointer to write the boxes around the transformed boxes to (may be in)
+ * @param n the amount of boxes
+ */
+void aabb3_transformArray(const mat4* m, const aabb3* in, aabb3* out, size_t n);
+
+/**
+ * @brief check if two spheres overlap
+ * 
+ * @param a a pointer to the first sphere
+ * @param b a pointer to the second sphere
+ * @return true : the spheres overlap
+ * @return false : the spheres are separated
+ */
+bool sphere_overlaps(const sphere* a, const sphere* b);
+
+/**
+ * @brief check if a sphere overlaps an axis aligned box
+ * 
+ * @param s a pointer to the sphere
+ * @param b a pointer to the box
+ * @return true : the sphere and the box overlap
+ * @return false : the sphere and the box are separated
+ */
+bool sphere_overlapsAABB(const sphere* s, const aabb3* b);
+
+/**
+ * @brief compute the signed distance of a point to a plane
+ * 
+ * @param p a pointer to the plane
+ * @param point a pointer to the point
+ * @return float the distance, scaled by the length of the normal if it is not normalized
+ */
+float plane_distance(const plane* p, const vec3* point);
+
+/**
+ * @brief intersect a ray with an axis aligned box
+ * 
+ * @param r a pointer to the ray
+ * @param b a pointer to the box
+ * @param tMax the maximal distance along the ray
+ * @param t a pointer to write the distance where the ray enters the box to or NULL
+ * @return true : the ray hits the box
+ * @return false : the ray misses the box
+ */
+bool ray3_intersectAABB(const ray3* r, const aabb3* b, float tMax, float* t);
+
+/**
+ * @brief intersect a ray with a sphere
+ * 
+ * @param r a pointer to the ray
+ * @param s a pointer to the sphere
+ * @param tMax the maximal distance along the ray
+ * @param t a pointer to write the distance of the first intersection in front of the origin to or NULL
+ * @return true : the ray hits the sphere
+ * @return false : the ray misses the sphere
+ */
+bool ray3_intersectSphere(const ray3* r, const sphere* s, float tMax, float* t);
+
+/**
+ * @brief intersect a ray with a plane
+ * 
+ * @param r a pointer to the ray
+ * @param p a pointer to the plane
+ * @param tMax the maximal distance along the ray
+ * @param t a pointer to write the distance of the intersection to or NULL
+ * @return true : the ray hits the plane
+ * @return false : the ray misses the plane
+ */
+bool ray3_intersectPlane(const ray3* r, const plane* p, float tMax, float* t);
+
+/**
+ * @brief intersect a ray with an array of axis aligned boxes
+ * 
+ * @param r a pointer to the ray
+ * @param boxes a pointer to the boxes
+ * @param n the amount of boxes
+ * @param tMax the maximal distance along the ray
+ * @param t a pointer to write the distance where the ray enters every box to, INFINITY if the box is missed
+ * @return size_t the amount of boxes that are hit
+ */
+size_t ray3_intersectAABBs(const ray3* r, const aabb3* boxes, size_t n, float tMax, float* t);
+
+/**
+ * @brief intersect a ray with an array of spheres
+ * 
+ * @param r a pointer to the ray
+ * @param spheres a pointer to the spheres
+ * @param n the amount of spheres
+ * @param tMax the maximal distance along the ray
+ * @param t a pointer to write the distance of the first intersection with every sphere to, INFINITY if the sphere is missed
+ * @return size_t the amount of spheres that are hit
+ */
+size_t ray3_intersectSpheres(const ray3* r, const sphere* spheres, size_t n, float tMax, float* t);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief intersect a ray with an array of axis aligned boxes
+ * 
+ * @param r the ray
+ * @param boxes a pointer to the boxes
+ * @param count the amount of boxes
+ * @param t a pointer to write the distance where the ray enters every box to, INFINITY if the box is missed
+ * @param tMax the maximal distance along the ray
+ * @return size_t the amount of boxes that are hit
+ */
+inline size_t intersect(const ray3& r, const aabb3* boxes, size_t count, float* t, float tMax = INFINITY) noexcept
+{return ray3_intersectAABBs(&r, boxes, count, tMax, t);}
+
+/**
+ * @brief intersect a ray with an array of spheres
+ * 
+ * @param r the ray
+ * @param spheres a pointer to the spheres
+ * @param count the amount of spheres
+ * @param t a pointer to write the distance of the first intersection with every sphere to, INFINITY if the sphere is missed
+ * @param tMax the maximal distance along the ray
+ * @return size_t the amount of spheres that are hit
+ */
+inline size_t intersect(const ray3& r, const sphere* spheres, size_t count, float* t, float tMax = INFINITY) noexcept
+{return ray3_intersectSpheres(&r, spheres, count, tMax, t);}
+
+/**
+ * @brief find all boxes of an array that overlap a box
+ * 
+ * @param box the box to test against
+ * @param boxes a pointer to the boxes to test
+ * @param count the amount of boxes to test
+ * @param hits a pointer to write the indices of the overlapping boxes to, it must have room for count indices
+ * @return size_t the amount of overlapping boxes
+ */
+inline size_t overlaps(const aabb3& box, const aabb3* boxes, size_t count, uint32_t* hits) noexcept
+{return aabb3_overlapArray(&box, boxes, count, hits);}
+
+/**
+ * @brief transform an array of axis aligned boxes by a matrix
+ * 
+ * @param m the matrix, only the upper 3x4 part is used
+ * @param in a pointer to the boxes to transform
+ * @param out a pointer to write the transformed boxes to (may be in)
+ * @param count the amount of boxes
+ */
+inline void transform(const mat4& m, const aabb3* in, aabb3* out, size_t count) noexcept
+{aabb3_transformArray(&m, in, out, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief intersect a ray with a span of axis aligned boxes
+ * 
+ * @param r the ray
+ * @param boxes the boxes
+ * @param t the span to write the distance where the ray enters every box to, it must be at least as large as boxes
+ * @param tMax the maximal distance along the ray
+ * @return size_t the amount of boxes that are hit
+ */
+inline size_t intersect(const ray3& r, std::span<const aabb3> boxes, std::span<float> t, float tMax = INFINITY) noexcept
+{return ray3_intersectAABBs(&r, boxes.data(), boxes.size(), tMax, t.data());}
+
+/**
+ * @brief intersect a ray with a span of spheres
+ * 
+ * @param r the ray
+ * @param spheres the spheres
+ * @param t the span to write the distance of the first intersection with every sphere to, it must be at least as large as spheres
+ * @param tMax the maximal distance along the ray
+ * @return size_t the amount of spheres that are hit
+ */
+inline size_t intersect(const ray3& r, std::span<const sphere> spheres, std::span<float> t, float tMax = INFINITY) noexcept
+{return ray3_intersectSpheres(&r, spheres.data(), spheres.size(), tMax, t.data());}
+
+/**
+ * @brief find all boxes of a span that overlap a box
+ * 
+ * @param box the box to test against
+ * @param boxes the boxes to test
+ * @param hits the span to write the indices of the overlapping boxes to, it must be at least as large as boxes
+ * @return size_t the amount of overlapping boxes
+ */
+inline size_t overlaps(const aabb3& box, std::span<const aabb3> boxes, std::span<uint32_t> hits) noexcept
+{return aabb3_overlapArray(&box, boxes.data(), boxes.size(), hits.data());}
+
+/**
+ * @brief transform a span of axis aligned boxes by a matrix
+ * 
+ * @param m the matrix, only the upper 3x4 part is used
+ * @param in the boxes to transform
+ * @param out the span to write the transformed boxes to, it must be at least as large as in
+ */
+inline void transform(const mat4& m, std::span<const aabb3> in, std::span<aabb3> out) noexcept
+{aabb3_transformArray(&m, in.data(), out.data(), in.size());}
+
+#endif
+
+#endif
+
+#endif
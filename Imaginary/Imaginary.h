@@ -15,5 +15,9 @@
 
 //include quaternions
 #include "Quaternions/Quaternion.h"
+//include double precision quaternions
+#include "Quaternions/dQuaternion.h"
+//include dual quaternions
+#include "Quaternions/DualQuaternion.h"
 
 #endif
\ No newline at end of file
@@ -0,0 +1,38 @@
+/**
+ * @file DualQuaternion.cpp
+ * @author DM8AT
+ * @brief implement the C linkage for the dual quaternion structure
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the dual quaternion structure
+#include "DualQuaternion.h"
+
+DualQuaternion dualQuaternion_fromRotationTranslation(const Quaternion* rotation, const vec3* translation) 
+{return DualQuaternion(*rotation, *translation);}
+
+DualQuaternion dualQuaternion_fromMat4(const mat4* mat) {return DualQuaternion(*mat);}
+
+mat4 dualQuaternion_toMat4(const DualQuaternion* q) {return q->toMat4();}
+
+DualQuaternion dualQuaternion_add(const DualQuaternion* q, const DualQuaternion* p) {return *q + *p;}
+
+DualQuaternion dualQuaternion_scale(const DualQuaternion* q, float s) {return *q * s;}
+
+DualQuaternion dualQuaternion_multiply(const DualQuaternion* q, const DualQuaternion* p) {return *q * *p;}
+
+DualQuaternion dualQuaternion_conjugate(const DualQuaternion* q) {return q->conjugate();}
+
+DualQuaternion dualQuaternion_normalize(const DualQuaternion* q) {return q->normalize();}
+
+Quaternion dualQuaternion_getRotation(const DualQuaternion* q) {return q->getRotation();}
+
+vec3 dualQuaternion_getTranslation(const DualQuaternion* q) {return q->getTranslation();}
+
+vec3 dualQuaternion_transformPoint(const DualQuaternion* q, const vec3* p) {return q->transformPoint(*p);}
+
+vec3 dualQuaternion_transformDirection(const DualQuaternion* q, const vec3* d) {return q->transformDirection(*d);}
\ No newline at end of file
@@ -0,0 +1,286 @@
+/**
+ * @file DualQuaternion.h
+ * @author DM8AT
+ * @brief define the dual quaternion structure (a rotation and a translation stored as two quaternions)
+ * 
+ * A normalized dual quaternion describes a rigid transformation with 8 floats instead of the 12 floats of a 3x4 matrix.
+ * Blending dual quaternions keeps the volume of skinned meshes, while blending matrices collapses joints that are twisted
+ * (candy wrapper effect)
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_DUAL_QUATERNION_
+#define _GLGE_DUAL_QUATERNION_
+
+//include quaternions for the real and the dual part
+#include "Quaternion.h"
+
+//create C linkage for everything
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store an instance of a dual quaternion
+ * 
+ * For a rotation r followed by a translation t the real part is r and the dual part is 0.5 * t * r, where t is the pure
+ * quaternion (0, t.x, t.y, t.z)
+ */
+typedef struct s_DualQuaternion {
+
+    //the real part, the rotation
+    Quaternion real;
+    //the dual part, it stores the translation
+    Quaternion dual;
+
+    //check for C++ to implement the C++ interface
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Dual Quaternion
+     * 
+     * Initializes the dual quaternion to the identity transformation
+     */
+    s_DualQuaternion() noexcept : real(), dual(0.f, 0.f, 0.f, 0.f) {}
+
+    /**
+     * @brief Construct a new Dual Quaternion
+     * 
+     * @param _real the real part of the dual quaternion
+     * @param _dual the dual part of the dual quaternion
+     */
+    s_DualQuaternion(const Quaternion& _real, const Quaternion& _dual) noexcept : real(_real), dual(_dual) {}
+
+    /**
+     * @brief Construct a new Dual Quaternion from a rotation and a translation
+     * 
+     * @param rotation the normalized quaternion to rotate with
+     * @param translation the translation that is applied after the rotation
+     */
+    s_DualQuaternion(const Quaternion& rotation, const vec3& translation) noexcept
+     : real(rotation), dual((Quaternion(0.f, translation.x, translation.y, translation.z) * rotation) * 0.5f) {}
+
+    /**
+     * @brief Construct a new Dual Quaternion from a transformation matrix
+     * 
+     * @param mat the matrix, the upper left 3x3 part must be orthonormal. The translation is stored in the last column
+     */
+    explicit s_DualQuaternion(const mat4& mat) noexcept
+     : s_DualQuaternion(Quaternion(mat), vec3(mat.m[3], mat.m[7], mat.m[11])) {}
+
+    /**
+     * @brief add two dual quaternions together
+     * 
+     * @param q the dual quaternion to add to this one
+     * @return DualQuaternion the sum of both dual quaternions
+     */
+    inline s_DualQuaternion operator+(const s_DualQuaternion& q) const noexcept {return s_DualQuaternion(real + q.real, dual + q.dual);}
+
+    /**
+     * @brief scale the dual quaternion by a scalar
+     * 
+     * @param s the scalar to scale both parts with
+     * @return DualQuaternion the scaled dual quaternion
+     */
+    inline s_DualQuaternion operator*(float s) const noexcept {return s_DualQuaternion(real * s, dual * s);}
+
+    /**
+     * @brief compose two transformations
+     * 
+     * The other transformation is applied first, like the product of two matrices
+     * 
+     * @param q the dual quaternion to multiply with
+     * @return DualQuaternion the product of both dual quaternions
+     */
+    inline s_DualQuaternion operator*(const s_DualQuaternion& q) const noexcept
+    {return s_DualQuaternion(real * q.real, (real * q.dual) + (dual * q.real));}
+
+    /**
+     * @brief conjugate both parts of the dual quaternion
+     * 
+     * For a normalized dual quaternion this is the inverse transformation
+     * 
+     * @return DualQuaternion the conjugated dual quaternion
+     */
+    inline s_DualQuaternion conjugate() const noexcept {return s_DualQuaternion(-real, -dual);}
+
+    /**
+     * @brief normalize the dual quaternion
+     * 
+     * Both parts are divided by the length of the real part and the dual part is made orthogonal to the real part again, so
+     * the result is a rigid transformation even after blending or many compositions
+     * 
+     * @return DualQuaternion the normalized dual quaternion
+     */
+    inline s_DualQuaternion normalize() const noexcept {
+        float inv = 1.f / glge::sqrt(dot(real.vec, real.vec));
+        Quaternion r = real * inv;
+        Quaternion d = dual * inv;
+        return s_DualQuaternion(r, d - r * dot(r.vec, d.vec));
+    }
+
+    /**
+     * @brief get the rotation of the transformation
+     * 
+     * @return Quaternion the rotation, it is normalized if the dual quaternion is normalized
+     */
+    inline Quaternion getRotation() const noexcept {return real;}
+
+    /**
+     * @brief get the translation of the transformation
+     * 
+     * @return vec3 the translation, which is the vector part of 2 * dual * conjugate(real)
+     */
+    inline vec3 getTranslation() const noexcept {
+        Quaternion t = dual * (-real);
+        return vec3(2.f * t.x, 2.f * t.y, 2.f * t.z);
+    }
+
+    /**
+     * @brief apply the transformation to a point
+     * 
+     * @param p the point to transform
+     * @return vec3 the rotated and translated point
+     */
+    inline vec3 transformPoint(const vec3& p) const noexcept {return real.rotate(p) + getTranslation();}
+
+    /**
+     * @brief apply the rotation of the transformation to a direction
+     * 
+     * @param d the direction to rotate
+     * @return vec3 the rotated direction
+     */
+    inline vec3 transformDirection(const vec3& d) const noexcept {return real.rotate(d);}
+
+    /**
+     * @brief compute the transformation matrix of this dual quaternion
+     * 
+     * The dual quaternion must be normalized
+     * 
+     * @return mat4 the matrix with the rotation in the upper left 3x3 part and the translation in the last column
+     */
+    inline mat4 toMat4() const noexcept {
+        mat4 m = real.toMat4();
+        vec3 t = getTranslation();
+        m.m[3] = t.x; m.m[7] = t.y; m.m[11] = t.z;
+        return m;
+    }
+
+    #endif
+
+} DualQuaternion;
+
+/**
+ * @brief create a dual quaternion from a rotation and a translation
+ * 
+ * @param rotation a pointer to the normalized quaternion to rotate with
+ * @param translation a pointer to the translation that is applied after the rotation
+ * @return DualQuaternion the dual quaternion that describes the transformation
+ */
+DualQuaternion dualQuaternion_fromRotationTranslation(const Quaternion* rotation, const vec3* translation);
+
+/**
+ * @brief create a dual quaternion from a transformation matrix
+ * 
+ * @param mat a pointer to the matrix, the upper left 3x3 part must be orthonormal
+ * @return DualQuaternion the dual quaternion that describes the transformation
+ */
+DualQuaternion dualQuaternion_fromMat4(const mat4* mat);
+
+/**
+ * @brief compute the transformation matrix of a normalized dual quaternion
+ * 
+ * @param q a pointer to the dual quaternion
+ * @return mat4 the transformation matrix
+ */
+mat4 dualQuaternion_toMat4(const DualQuaternion* q);
+
+/**
+ * @brief add two dual quaternions together
+ * 
+ * @param q a pointer to the first dual quaternion
+ * @param p a pointer to the second dual quaternion
+ * @return DualQuaternion the sum of both dual quaternions
+ */
+DualQuaternion dualQuaternion_add(const DualQuaternion* q, const DualQuaternion* p);
+
+/**
+ * @brief scale a dual quaternion by a scalar
+ * 
+ * @param q a pointer to the dual quaternion
+ * @param s the scalar to scale with
+ * @return DualQuaternion the scaled dual quaternion
+ */
+DualQuaternion dualQuaternion_scale(const DualQuaternion* q, float s);
+
+/**
+ * @brief compose two transformations, p is applied first
+ * 
+ * @param q a pointer to the transformation that is applied last
+ * @param p a pointer to the transformation that is applied first
+ * @return DualQuaternion the product of both dual quaternions
+ */
+DualQuaternion dualQuaternion_multiply(const DualQuaternion* q, const DualQuaternion* p);
+
+/**
+ * @brief conjugate both parts of a dual quaternion (the inverse of a normalized dual quaternion)
+ * 
+ * @param q a pointer to the dual quaternion
+ * @return DualQuaternion the conjugated dual quaternion
+ */
+DualQuaternion dualQuaternion_conjugate(const DualQuaternion* q);
+
+/**
+ * @brief normalize a dual quaternion
+ * 
+ * @param q a pointer to the dual quaternion
+ * @return DualQuaternion the normalized dual quaternion
+ */
+DualQuaternion dualQuaternion_normalize(const DualQuaternion* q);
+
+/**
+ * @brief get the rotation of a dual quaternion
+ * 
+ * @param q a pointer to the dual quaternion
+ * @return Quaternion the rotation
+ */
+Quaternion dualQuaternion_getRotation(const DualQuaternion* q);
+
+/**
+ * @brief get the translation of a dual quaternion
+ * 
+ * @param q a pointer to the dual quaternion
+ * @return vec3 the translation
+ */
+vec3 dualQuaternion_getTranslation(const DualQuaternion* q);
+
+/**
+ * @brief apply the transformation of a dual quaternion to a point
+ * 
+ * @param q a pointer to the normalized dual quaternion
+ * @param p a pointer to the point to transform
+ * @return vec3 the transformed point
+ */
+vec3 dualQuaternion_transformPoint(const DualQuaternion* q, const vec3* p);
+
+/**
+ * @brief apply the rotation of a dual quaternion to a direction
+ * 
+ * @param q a pointer to the normalized dual quaternion
+ * @param d a pointer to the direction to rotate
+ * @return vec3 the rotated direction
+ */
+vec3 dualQuaternion_transformDirection(const DualQuaternion* q, const vec3* d);
+
+//end a potential C-Section
+#if __cplusplus
+}
+#endif
+
+#endif
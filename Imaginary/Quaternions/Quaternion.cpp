@@ -11,6 +11,35 @@
 
 //include the quaternion structure
 #include "Quaternion.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+//include the quaternion kernels for the blends of single quaternions
+#include "../../Kernels/GLGE_QuatKernels.hpp"
+
+//the single quaternions are blended in the first lane of a pack of the instruction set the library is compiled for, so they 
+//are identical to the batch kernels of that instruction set
+
+/**
+ * @brief blend two quaternions using the batch kernel
+ * 
+ * @tparam Slerp true : spherical linear interpolation | false : normalized linear interpolation
+ * @param a the quaternion to blend from
+ * @param b the quaternion to blend to
+ * @param t the blend weight
+ * @return Quaternion the blended quaternion
+ */
+template <bool Slerp> static inline Quaternion blend(const Quaternion& a, const Quaternion& b, float t) noexcept {
+    using namespace glge::kernel;
+    Pack pa[4], pb[4], r[4];
+    for (size_t k = 0; k < 4; ++k) 
+    {pa[k] = set1(a.vals[k]); pb[k] = set1(b.vals[k]);}
+    quatBlend<Slerp>(pa, pb, set1(t), r);
+    return Quaternion(first(r[0]), first(r[1]), first(r[2]), first(r[3]));
+}
+
+Quaternion Quaternion::nlerp(const Quaternion& other, float t) const noexcept {return blend<false>(*this, other, t);}
+
+Quaternion Quaternion::slerp(const Quaternion& other, float t) const noexcept {return blend<true>(*this, other, t);}
 
 Quaternion quaternion_fromEuler(const vec3* euler) {return Quaternion(*euler);}
 
@@ -28,6 +57,38 @@ Quaternion quaternion_scale(Quaternion* q, float s) {return *q * s;}
 
 Quaternion quaternion_divide(Quaternion* q, float s) {return *q / s;}
 
-Quaternion quaternion_rotate(const Quaternion* q, const Quaternion* other) {q->rotate(*other);}
+Quaternion quaternion_rotate(const Quaternion* q, const Quaternion* other) {return q->rotate(*other);}
+
+void quaternion_rotateThis(Quaternion* q, const Quaternion* other) {q->rotateThis(*other);}
+
+vec3 quaternion_rotateVec3(const Quaternion* q, const vec3* v) {return q->rotate(*v);}
+
+mat3 quaternion_toMat3(const Quaternion* q) {return q->toMat3();}
+
+mat4 quaternion_toMat4(const Quaternion* q) {return q->toMat4();}
+
+Quaternion quaternion_fromMat3(const mat3* mat) {return Quaternion(*mat);}
+
+Quaternion quaternion_fromMat4(const mat4* mat) {return Quaternion(*mat);}
+
+void quaternion_toMat4Array(const Quaternion* in, mat4* out, size_t n) 
+{glge::kernel::table().quatToMat((const float*)in, (float*)out, n, 16);}
+
+void quaternion_toMat3x4Array(const Quaternion* in, float* out, size_t n) 
+{glge::kernel::table().quatToMat((const float*)in, out, n, 12);}
+
+void quaternion_fromMat4Array(const mat4* in, Quaternion* out, size_t n) 
+{glge::kernel::table().quatFromMat((const float*)in, (float*)out, n, 16);}
+
+void quaternion_fromMat3x4Array(const float* in, Quaternion* out, size_t n) 
+{glge::kernel::table().quatFromMat(in, (float*)out, n, 12);}
+
+Quaternion quaternion_nlerp(const Quaternion* a, const Quaternion* b, float t) {return a->nlerp(*b, t);}
+
+Quaternion quaternion_slerp(const Quaternion* a, const Quaternion* b, float t) {return a->slerp(*b, t);}
+
+void quaternion_nlerpArray(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t n) 
+{glge::kernel::table().quatBlend((const float*)a, (const float*)b, t, (float*)out, n, false);}
 
-void quaternion_rotateThis(Quaternion* q, const Quaternion* other) {q->rotateThis(*other);}
\ No newline at end of file
+void quaternion_slerpArray(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t n) 
+{glge::kernel::table().quatBlend((const float*)a, (const float*)b, t, (float*)out, n, true);}
\ No newline at end of file
@@ -17,6 +17,9 @@
 #include "../../Vector/floats/GLGE_vec4.h"
 //include 3D vectors to use add rotation / constructors using 3D vectors
 #include "../../Vector/floats/GLGE_vec3.h"
+//include the matrices to convert rotations from and to
+#include "../../Matrix/floats/GLGE_mat3.h"
+#include "../../Matrix/floats/GLGE_mat4.h"
 
 //create C linkage for everything
 #if __cplusplus
@@ -89,21 +92,40 @@ typedef struct s_Quaternion {
     /**
      * @brief Construct a new Quaternion from an euler angle
      * 
+     * The rotations are applied in the order roll, pitch, yaw (q = yaw * pitch * roll)
+     * 
      * @param euler the euler angle (x : rotation around the x axis (roll), y : rotation around the y axis (pitch), z : rotation around the z axis (yaw))
      */
     s_Quaternion(const vec3& euler) noexcept {
-        //compute the half angles
-        vec3 h_a = euler * 0.5f;
-        //pre-compute the trigonometric therms
-        vec3 sins = vec3(sin(h_a.x), sin(h_a.y), sin(h_a.z));
-        vec3 coss = vec3(cos(h_a.x), cos(h_a.y), cos(h_a.z));
+        //compute the sines and cosines of all three half angles at once
+        vec4 sins, coss;
+        #if GLGE_MATH_USE_SIMD
+        //assemble the half angles in a register, a vector stored element by element would stall the load of the kernel
+        sincos(vec4(_mm_mul_ps(_mm_setr_ps(euler.x, euler.y, euler.z, 0.f), _mm_set1_ps(0.5f))), sins, coss);
+        #else
+        sincos(vec4(euler * 0.5f, 0.f), sins, coss);
+        #endif
         //combine to the quaternion
         w = coss.x*coss.y*coss.z + sins.x*sins.y*sins.z;
-        i = sins.x*coss.y*coss.z + coss.x*sins.y*sins.z;
+        i = sins.x*coss.y*coss.z - coss.x*sins.y*sins.z;
         j = coss.x*sins.y*coss.z + sins.x*coss.y*sins.z;
-        k = coss.x*coss.y*sins.z + sins.x*sins.y*coss.z;
+        k = coss.x*coss.y*sins.z - sins.x*sins.y*coss.z;
     }
 
+    /**
+     * @brief Construct a new Quaternion from a rotation matrix
+     * 
+     * @param mat the rotation matrix, it must be orthonormal
+     */
+    explicit s_Quaternion(const mat3& mat) noexcept : vec(fromRotation(mat.m, 3).vec) {}
+
+    /**
+     * @brief Construct a new Quaternion from the rotation part of a matrix
+     * 
+     * @param mat the matrix, the upper left 3x3 part must be orthonormal. The translation is ignored
+     */
+    explicit s_Quaternion(const mat4& mat) noexcept : vec(fromRotation(mat.m, 4).vec) {}
+
     /**
      * @brief Destroy the Quaternion
      */
@@ -130,7 +152,14 @@ typedef struct s_Quaternion {
      * 
      * @return Quaternion the conjugated quaternion
      */
-    inline s_Quaternion operator-(void) const noexcept {return s_Quaternion(w, -i, -j, -k);}
+    inline s_Quaternion operator-(void) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        //flip the sign bits of the imaginary parts
+        return vec4(_mm_xor_ps(vec.simd, _mm_setr_ps(0.f, -0.f, -0.f, -0.f)));
+        #else
+        return s_Quaternion(w, -i, -j, -k);
+        #endif
+    }
 
     /**
      * @brief get the inverse (conjugation) of this quaternion
@@ -146,12 +175,42 @@ typedef struct s_Quaternion {
      * @return Quaternion the product of both quaternions
      */
     inline s_Quaternion operator*(const s_Quaternion& q) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        //the lanes hold (w, i, j, k). Every element of this quaternion is multiplied by a permutation of q with the signs 
+        //of the Hamilton product, starting with w * (q.w, q.i, q.j, q.k)
+        __m128 r = _mm_mul_ps(_mm_shuffle_ps(vec.simd, vec.simd, _MM_SHUFFLE(0,0,0,0)), q.vec.simd);
+        //i * (-q.i, q.w, -q.k, q.j)
+        __m128 p = _mm_xor_ps(_mm_shuffle_ps(q.vec.simd, q.vec.simd, _MM_SHUFFLE(2,3,0,1)), _mm_setr_ps(-0.f, 0.f, -0.f, 0.f));
+        __m128 s = _mm_shuffle_ps(vec.simd, vec.simd, _MM_SHUFFLE(1,1,1,1));
+        #if GLGE_MATH_ALLOW_FMA
+        r = _mm_fmadd_ps(s, p, r);
+        #else
+        r = _mm_add_ps(r, _mm_mul_ps(s, p));
+        #endif
+        //j * (-q.j, q.k, q.w, -q.i)
+        p = _mm_xor_ps(_mm_shuffle_ps(q.vec.simd, q.vec.simd, _MM_SHUFFLE(1,0,3,2)), _mm_setr_ps(-0.f, 0.f, 0.f, -0.f));
+        s = _mm_shuffle_ps(vec.simd, vec.simd, _MM_SHUFFLE(2,2,2,2));
+        #if GLGE_MATH_ALLOW_FMA
+        r = _mm_fmadd_ps(s, p, r);
+        #else
+        r = _mm_add_ps(r, _mm_mul_ps(s, p));
+        #endif
+        //k * (-q.k, -q.j, q.i, q.w)
+        p = _mm_xor_ps(_mm_shuffle_ps(q.vec.simd, q.vec.simd, _MM_SHUFFLE(0,1,2,3)), _mm_setr_ps(-0.f, -0.f, 0.f, 0.f));
+        s = _mm_shuffle_ps(vec.simd, vec.simd, _MM_SHUFFLE(3,3,3,3));
+        #if GLGE_MATH_ALLOW_FMA
+        return vec4(_mm_fmadd_ps(s, p, r));
+        #else
+        return vec4(_mm_add_ps(r, _mm_mul_ps(s, p)));
+        #endif
+        #else
         return s_Quaternion(
             (w*q.w) - (i*q.i) - (j*q.j) - (k*q.k),
             (i*q.w) + (w*q.i) + (j*q.k) - (k*q.j),
             (j*q.w) + (w*q.j) + (k*q.i) - (i*q.k),
             (k*q.w) + (w*q.k) + (i*q.j) - (j*q.i)
         );
+        #endif
     }
 
     /**
@@ -194,6 +253,132 @@ typedef struct s_Quaternion {
     inline s_Quaternion rotate(const s_Quaternion& other) const noexcept
     {return normalize((*this * other).vec);}
 
+    /**
+     * @brief rotate a 3D vector by this quaternion
+     * 
+     * Computes v + 2w(q x v) + 2q x (q x v) with the imaginary part q, which is the same as q * v * q^-1 without building 
+     * two quaternion products. The quaternion must be normalized
+     * 
+     * @param v the vector to rotate
+     * @return vec3 the rotated vector
+     */
+    inline vec3 rotate(const vec3& v) const noexcept {
+        //t = 2 (q x v)
+        float tx = 2.f * (y*v.z - z*v.y);
+        float ty = 2.f * (z*v.x - x*v.z);
+        float tz = 2.f * (x*v.y - y*v.x);
+        //v + w t + q x t
+        return vec3(
+            v.x + w*tx + (y*tz - z*ty),
+            v.y + w*ty + (z*tx - x*tz),
+            v.z + w*tz + (x*ty - y*tx)
+        );
+    }
+
+    /**
+     * @brief blend from this quaternion to another one using normalized linear interpolation
+     * 
+     * The other quaternion is negated if it lies in the opposite half space, so the blend takes the shortest path. The angular 
+     * velocity is not constant, but the result is cheap and always normalized
+     * 
+     * @param other the normalized quaternion to blend to
+     * @param t the blend weight (0 : this quaternion, 1 : the other quaternion)
+     * @return Quaternion the normalized blended quaternion
+     */
+    s_Quaternion nlerp(const s_Quaternion& other, float t) const noexcept;
+
+    /**
+     * @brief blend from this quaternion to another one using spherical linear interpolation
+     * 
+     * The blend takes the shortest path with a constant angular velocity. The weights sin((1 - t) a) / sin(a) and 
+     * sin(t a) / sin(a) are computed with a polynomial in cos(a) instead of acos and sin. The parts of the result differ from 
+     * the exact slerp by less than 3e-7
+     * 
+     * @param other the normalized quaternion to blend to
+     * @param t the blend weight (0 : this quaternion, 1 : the other quaternion)
+     * @return Quaternion the blended quaternion
+     */
+    s_Quaternion slerp(const s_Quaternion& other, float t) const noexcept;
+
+    /**
+     * @brief compute the rotation matrix of this quaternion
+     * 
+     * The quaternion must be normalized. The matrix rotates a vector the same way as rotate(const vec3&)
+     * 
+     * @return mat3 the rotation matrix
+     */
+    inline mat3 toMat3() const noexcept {
+        float x2 = x + x, y2 = y + y, z2 = z + z;
+        float xx = x * x2, yy = y * y2, zz = z * z2;
+        float xy = x * y2, xz = x * z2, yz = y * z2;
+        float wx = w * x2, wy = w * y2, wz = w * z2;
+        return mat3(
+            1.f - (yy + zz), xy - wz,         xz + wy,
+            xy + wz,         1.f - (xx + zz), yz - wx,
+            xz - wy,         yz + wx,         1.f - (xx + yy)
+        );
+    }
+
+    /**
+     * @brief compute the rotation matrix of this quaternion as a 4x4 matrix without translation
+     * 
+     * @return mat4 the rotation matrix
+     */
+    inline mat4 toMat4() const noexcept {
+        mat3 r = toMat3();
+        return mat4(vec4(r.rows[0], 0.f), vec4(r.rows[1], 0.f), vec4(r.rows[2], 0.f), vec4(0.f, 0.f, 0.f, 1.f));
+    }
+
+    /**
+     * @brief convert a rotation matrix to a quaternion using Shepperd's method
+     * 
+     * The part of the quaternion with the largest magnitude is computed from the diagonal and the other parts from the 
+     * off-diagonal elements, so the division never gets close to zero. The result always has a positive real part
+     * 
+     * @param m a pointer to the first row of the matrix
+     * @param stride the amount of floats between the rows of the matrix (3 for a mat3, 4 for a mat4)
+     * @return Quaternion the quaternion that describes the same rotation
+     */
+    static inline s_Quaternion fromRotation(const float* m, size_t stride) noexcept {
+        const float* r0 = m;
+        const float* r1 = m + stride;
+        const float* r2 = m + 2*stride;
+        //select the largest of 4w^2 = 1 + trace, 4x^2 = 1 + 2m00 - trace, ... by comparing the trace to the diagonal
+        float trace = (r0[0] + r1[1]) + r2[2];
+        int c = 0;
+        float best = trace;
+        if (r0[0] > best) {c = 1; best = r0[0];}
+        if (r1[1] > best) {c = 2; best = r1[1];}
+        if (r2[2] > best) {c = 3;}
+
+        s_Quaternion q;
+        float t, s;
+        switch (c) {
+        case 0:
+            t = 1.f + trace;
+            s = 0.5f / glge::sqrt(t);
+            q = s_Quaternion(t * s, (r2[1] - r1[2]) * s, (r0[2] - r2[0]) * s, (r1[0] - r0[1]) * s);
+            break;
+        case 1:
+            t = (1.f + r0[0]) - (r1[1] + r2[2]);
+            s = 0.5f / glge::sqrt(t);
+            q = s_Quaternion((r2[1] - r1[2]) * s, t * s, (r0[1] + r1[0]) * s, (r0[2] + r2[0]) * s);
+            break;
+        case 2:
+            t = (1.f + r1[1]) - (r0[0] + r2[2]);
+            s = 0.5f / glge::sqrt(t);
+            q = s_Quaternion((r0[2] - r2[0]) * s, (r0[1] + r1[0]) * s, t * s, (r1[2] + r2[1]) * s);
+            break;
+        default:
+            t = (1.f + r2[2]) - (r0[0] + r1[1]);
+            s = 0.5f / glge::sqrt(t);
+            q = s_Quaternion((r1[0] - r0[1]) * s, (r0[2] + r2[0]) * s, (r1[2] + r2[1]) * s, t * s);
+            break;
+        }
+        //q and -q are the same rotation, keep the real part positive
+        return (q.w < 0.f) ? s_Quaternion(-q.w, -q.x, -q.y, -q.z) : q;
+    }
+
     /**
      * @brief apply the rotation of another quaternion to this one
      * 
@@ -295,9 +480,279 @@ Quaternion quaternion_rotate(const Quaternion* q, const Quaternion* other);
  */
 void quaternion_rotateThis(Quaternion* q, const Quaternion* other);
 
-//end a potential C section
+/**
+ * @brief rotate a 3D vector by a quaternion
+ * 
+ * @param q a pointer to the normalized quaternion that describes the rotation
+ * @param v a pointer to the vector to rotate
+ * @return vec3 the rotated vector
+ */
+vec3 quaternion_rotateVec3(const Quaternion* q, const vec3* v);
+
+/**
+ * @brief compute the rotation matrix of a quaternion
+ * 
+ * @param q a pointer to the normalized quaternion
+ * @return mat3 the rotation matrix
+ */
+mat3 quaternion_toMat3(const Quaternion* q);
+
+/**
+ * @brief compute the rotation matrix of a quaternion as a 4x4 matrix without translation
+ * 
+ * @param q a pointer to the normalized quaternion
+ * @return mat4 the rotation matrix
+ */
+mat4 quaternion_toMat4(const Quaternion* q);
+
+/**
+ * @brief convert a rotation matrix to a quaternion using Shepperd's method
+ * 
+ * @param mat a pointer to the orthonormal matrix
+ * @return Quaternion the quaternion with a positive real part that describes the same rotation
+ */
+Quaternion quaternion_fromMat3(const mat3* mat);
+
+/**
+ * @brief convert the rotation part of a 4x4 matrix to a quaternion using Shepperd's method
+ * 
+ * @param mat a pointer to the matrix, the upper left 3x3 part must be orthonormal
+ * @return Quaternion the quaternion with a positive real part that describes the same rotation
+ */
+Quaternion quaternion_fromMat4(const mat4* mat);
+
+/**
+ * @brief compute the rotation matrices of an array of quaternions
+ * 
+ * Multiple quaternions are converted at once if the CPU supports wide registers. The results are bit-identical to quaternion_toMat4. 
+ * 
+ * @param in a constant pointer to the normalized quaternions
+ * @param out a pointer to write the 4x4 matrices to
+ * @param n the amount of quaternions to convert
+ */
+void quaternion_toMat4Array(const Quaternion* in, mat4* out, size_t n);
+
+/**
+ * @brief compute the rotation matrices of an array of quaternions as packed 3x4 matrices
+ * 
+ * Every matrix takes 12 floats, the three upper rows of the 4x4 matrix. The translation column is set to 0. 
+ * 
+ * @param in a constant pointer to the normalized quaternions
+ * @param out a pointer to write the 12 floats of every matrix to
+ * @param n the amount of quaternions to convert
+ */
+void quaternion_toMat3x4Array(const Quaternion* in, float* out, size_t n);
+
+/**
+ * @brief convert the rotation parts of an array of 4x4 matrices to quaternions
+ * 
+ * Multiple matrices are converted at once if the CPU supports wide registers. The results are bit-identical to quaternion_fromMat4. 
+ * 
+ * @param in a constant pointer to the matrices, the upper left 3x3 parts must be orthonormal
+ * @param out a pointer to write the quaternions to
+ * @param n the amount of matrices to convert
+ */
+void quaternion_fromMat4Array(const mat4* in, Quaternion* out, size_t n);
+
+/**
+ * @brief convert the rotation parts of an array of packed 3x4 matrices to quaternions
+ * 
+ * @param in a constant pointer to the 12 floats of every matrix, the left 3x3 parts must be orthonormal
+ * @param out a pointer to write the quaternions to
+ * @param n the amount of matrices to convert
+ */
+void quaternion_fromMat3x4Array(const float* in, Quaternion* out, size_t n);
+
+/**
+ * @brief blend two quaternions along the shortest path using normalized linear interpolation
+ * 
+ * @param a a pointer to the normalized quaternion to blend from
+ * @param b a pointer to the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return Quaternion the normalized blended quaternion
+ */
+Quaternion quaternion_nlerp(const Quaternion* a, const Quaternion* b, float t);
+
+/**
+ * @brief blend two quaternions along the shortest path using spherical linear interpolation
+ * 
+ * @param a a pointer to the normalized quaternion to blend from
+ * @param b a pointer to the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return Quaternion the blended quaternion
+ */
+Quaternion quaternion_slerp(const Quaternion* a, const Quaternion* b, float t);
+
+/**
+ * @brief blend two arrays of quaternions (for example two poses of a skeleton) using normalized linear interpolation
+ * 
+ * Multiple quaternions are blended at once if the CPU supports wide registers. 
+ * 
+ * @param a a constant pointer to the normalized quaternions to blend from
+ * @param b a constant pointer to the normalized quaternions to blend to
+ * @param t a constant pointer to the blend weight of every pair of quaternions
+ * @param out a pointer to write the blended quaternions to (may be the same as a or b)
+ * @param n the amount of quaternions to blend
+ */
+void quaternion_nlerpArray(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t n);
+
+/**
+ * @brief blend two arrays of quaternions (for example two poses of a skeleton) using spherical linear interpolation
+ * 
+ * Multiple quaternions are blended at once if the CPU supports wide registers. 
+ * 
+ * @param a a constant pointer to the normalized quaternions to blend from
+ * @param b a constant pointer to the normalized quaternions to blend to
+ * @param t a constant pointer to the blend weight of every pair of quaternions
+ * @param out a pointer to write the blended quaternions to (may be the same as a or b)
+ * @param n the amount of quaternions to blend
+ */
+void quaternion_slerpArray(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t n);
+
+//end a potential C-Section and add the C++ specific functions
 #if __cplusplus
 }
+
+/**
+ * @brief blend two quaternions along the shortest path using normalized linear interpolation
+ * 
+ * @param a the normalized quaternion to blend from
+ * @param b the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return Quaternion the normalized blended quaternion
+ */
+inline Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) noexcept
+{return a.nlerp(b, t);}
+
+/**
+ * @brief blend two quaternions along the shortest path using spherical linear interpolation
+ * 
+ * @param a the normalized quaternion to blend from
+ * @param b the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return Quaternion the blended quaternion
+ */
+inline Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) noexcept
+{return a.slerp(b, t);}
+
+/**
+ * @brief blend two arrays of quaternions using normalized linear interpolation
+ * 
+ * @param a a constant pointer to the normalized quaternions to blend from
+ * @param b a constant pointer to the normalized quaternions to blend to
+ * @param t a constant pointer to the blend weight of every pair of quaternions
+ * @param out a pointer to write the blended quaternions to (may be the same as a or b)
+ * @param count the amount of quaternions to blend
+ */
+inline void nlerp(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count) noexcept
+{quaternion_nlerpArray(a, b, t, out, count);}
+
+/**
+ * @brief blend two arrays of quaternions using spherical linear interpolation
+ * 
+ * @param a a constant pointer to the normalized quaternions to blend from
+ * @param b a constant pointer to the normalized quaternions to blend to
+ * @param t a constant pointer to the blend weight of every pair of quaternions
+ * @param out a pointer to write the blended quaternions to (may be the same as a or b)
+ * @param count the amount of quaternions to blend
+ */
+inline void slerp(const Quaternion* a, const Quaternion* b, const float* t, Quaternion* out, size_t count) noexcept
+{quaternion_slerpArray(a, b, t, out, count);}
+
+/**
+ * @brief compute the rotation matrices of an array of quaternions
+ * 
+ * @param in a constant pointer to the normalized quaternions
+ * @param out a pointer to write the 4x4 matrices to
+ * @param count the amount of quaternions to convert
+ */
+inline void toMat4(const Quaternion* in, mat4* out, size_t count) noexcept
+{quaternion_toMat4Array(in, out, count);}
+
+/**
+ * @brief compute the rotation matrices of an array of quaternions as packed 3x4 matrices (12 floats per matrix)
+ * 
+ * @param in a constant pointer to the normalized quaternions
+ * @param out a pointer to write the 12 floats of every matrix to
+ * @param count the amount of quaternions to convert
+ */
+inline void toMat3x4(const Quaternion* in, float* out, size_t count) noexcept
+{quaternion_toMat3x4Array(in, out, count);}
+
+/**
+ * @brief convert the rotation parts of an array of 4x4 matrices to quaternions
+ * 
+ * @param in a constant pointer to the matrices
+ * @param out a pointer to write the quaternions to
+ * @param count the amount of matrices to convert
+ */
+inline void fromMat4(const mat4* in, Quaternion* out, size_t count) noexcept
+{quaternion_fromMat4Array(in, out, count);}
+
+/**
+ * @brief convert the rotation parts of an array of packed 3x4 matrices (12 floats per matrix) to quaternions
+ * 
+ * @param in a constant pointer to the 12 floats of every matrix
+ * @param out a pointer to write the quaternions to
+ * @param count the amount of matrices to convert
+ */
+inline void fromMat3x4(const float* in, Quaternion* out, size_t count) noexcept
+{quaternion_fromMat3x4Array(in, out, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief compute the rotation matrices of a span of quaternions
+ * 
+ * @param in the normalized quaternions
+ * @param out the span to write the matrices to, only as many elements as both spans hold are converted
+ */
+inline void toMat4(std::span<const Quaternion> in, std::span<mat4> out) noexcept
+{quaternion_toMat4Array(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief convert the rotation parts of a span of 4x4 matrices to quaternions
+ * 
+ * @param in the matrices
+ * @param out the span to write the quaternions to, only as many elements as both spans hold are converted
+ */
+inline void fromMat4(std::span<const mat4> in, std::span<Quaternion> out) noexcept
+{quaternion_fromMat4Array(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief blend two spans of quaternions using normalized linear interpolation
+ * 
+ * @param a the normalized quaternions to blend from
+ * @param b the normalized quaternions to blend to
+ * @param t the blend weight of every pair of quaternions
+ * @param out the span to write the blended quaternions to, only as many elements as all spans hold are blended
+ */
+inline void nlerp(std::span<const Quaternion> a, std::span<const Quaternion> b, std::span<const float> t, std::span<Quaternion> out) noexcept {
+    size_t n = (a.size() < b.size()) ? a.size() : b.size();
+    n = (n < t.size()) ? n : t.size();
+    quaternion_nlerpArray(a.data(), b.data(), t.data(), out.data(), (n < out.size()) ? n : out.size());
+}
+
+/**
+ * @brief blend two spans of quaternions using spherical linear interpolation
+ * 
+ * @param a the normalized quaternions to blend from
+ * @param b the normalized quaternions to blend to
+ * @param t the blend weight of every pair of quaternions
+ * @param out the span to write the blended quaternions to, only as many elements as all spans hold are blended
+ */
+inline void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b, std::span<const float> t, std::span<Quaternion> out) noexcept {
+    size_t n = (a.size() < b.size()) ? a.size() : b.size();
+    n = (n < t.size()) ? n : t.size();
+    quaternion_slerpArray(a.data(), b.data(), t.data(), out.data(), (n < out.size()) ? n : out.size());
+}
+
+#endif
+
 #endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+/**
+ * @file dQuaternion.cpp
+ * @author DM8AT
+ * @brief implement the C linkage for the double quaternion structure
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the double quaternion structure
+#include "dQuaternion.h"
+
+dquat dquat_fromEuler(const dvec3* euler) {return dquat(*euler);}
+
+dquat dquat_fromQuaternion(const Quaternion* q) {return dquat(*q);}
+
+Quaternion dquat_toQuaternion(const dquat* q) {return q->toQuaternion();}
+
+dquat dquat_add(const dquat* q, const dquat* p) {return *q + *p;}
+
+dquat dquat_subtract(const dquat* q, const dquat* p) {return *q - *p;}
+
+dquat dquat_conjugate(const dquat* q) {return -(*q);}
+
+dquat dquat_multiply(const dquat* q, const dquat* p) {return *q * *p;}
+
+dquat dquat_multiplyWithDVec3(const dquat* q, const dvec3* v) {return *q * *v;}
+
+dquat dquat_scale(const dquat* q, double s) {return *q * s;}
+
+dquat dquat_divide(const dquat* q, double s) {return *q / s;}
+
+dquat dquat_rotate(const dquat* q, const dquat* other) {return q->rotate(*other);}
+
+void dquat_rotateThis(dquat* q, const dquat* other) {q->rotateThis(*other);}
+
+dvec3 dquat_rotateDVec3(const dquat* q, const dvec3* v) {return q->rotate(*v);}
+
+dquat dquat_nlerp(const dquat* a, const dquat* b, double t) {return a->nlerp(*b, t);}
+
+dquat dquat_slerp(const dquat* a, const dquat* b, double t) {return a->slerp(*b, t);}
+
+dmat3 dquat_toDMat3(const dquat* q) {return q->toDMat3();}
+
+dmat4 dquat_toDMat4(const dquat* q) {return q->toDMat4();}
+
+dquat dquat_fromDMat3(const dmat3* mat) {return dquat(*mat);}
+
+dquat dquat_fromDMat4(const dmat4* mat) {return dquat(*mat);}
\ No newline at end of file
@@ -0,0 +1,621 @@
+/**
+ * @file dQuaternion.h
+ * @author DM8AT
+ * @brief define the double precision quaternion structure
+ * 
+ * The API is the same as the one of the float quaternion (see Quaternion.h). The double quaternion is meant for orientations
+ * that are integrated over a long time, where the rounding errors of floats add up to a visible drift
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_DOUBLE_QUATERNION_
+#define _GLGE_DOUBLE_QUATERNION_
+
+//include 4D double vectors to store the quaternion in
+#include "../../Vector/doubles/GLGE_dvec4.h"
+//include 3D double vectors for the rotations and the euler angles
+#include "../../Vector/doubles/GLGE_dvec3.h"
+//include the double matrices to convert rotations from and to
+#include "../../Matrix/doubles/GLGE_dmat3.h"
+#include "../../Matrix/doubles/GLGE_dmat4.h"
+//include float quaternions to convert from and to
+#include "Quaternion.h"
+
+//create C linkage for everything
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store an instance of a double precision quaternion
+ */
+typedef struct s_dquat {
+
+    union {
+        struct {
+            //the real value
+            double w;
+
+            union {
+                //the imaginary values
+                struct {
+                    double x, y, z;
+                };
+                struct {
+                    double i, j, k;
+                };
+            };
+        };
+
+        //store an array of the values
+        double vals[4];
+
+        //store the values as a vector
+        dvec4 vec;
+    };
+
+    //check for C++ to implement the C++ interface
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new double quaternion
+     * 
+     * Initializes the quaternion to 1 (1 in real, imaginary all to 0)
+     */
+    s_dquat() : w(1), i(0), j(0), k(0) {}
+
+    /**
+     * @brief Construct a new double quaternion
+     * 
+     * @param _w the real part of the quaternion
+     * @param _i the first imaginary part for the quaternion
+     * @param _j the second imaginary part for the quaternion
+     * @param _k the third imaginary part for the quaternion
+     */
+    s_dquat(double _w, double _i, double _j, double _k) : w(_w), i(_i), j(_j), k(_k) {}
+
+    /**
+     * @brief Construct a new double quaternion
+     * 
+     * @param angle the angle to rotate around the given axis
+     * @param axis the axis to rotate around
+     */
+    s_dquat(double angle, const dvec3& axis) : w(angle), x(axis.x), y(axis.y), z(axis.z) {}
+
+    /**
+     * @brief Construct a new double quaternion
+     * 
+     * @param _vec a constant reference to a vector to initialize the quaternion from
+     */
+    s_dquat(const dvec4& _vec) : vec(_vec) {}
+
+    /**
+     * @brief Construct a new double quaternion from a float quaternion
+     * 
+     * @param q the float quaternion to convert
+     */
+    explicit s_dquat(const Quaternion& q) : w(q.w), i(q.i), j(q.j), k(q.k) {}
+
+    /**
+     * @brief Construct a new double quaternion from an euler angle
+     * 
+     * The rotations are applied in the order roll, pitch, yaw (q = yaw * pitch * roll)
+     * 
+     * @param euler the euler angle (x : rotation around the x axis (roll), y : rotation around the y axis (pitch), z : rotation around the z axis (yaw))
+     */
+    s_dquat(const dvec3& euler) noexcept {
+        //compute the sines and cosines of all three half angles
+        dvec3 sins, coss;
+        glge::sincos(euler.x * 0.5, sins.x, coss.x);
+        glge::sincos(euler.y * 0.5, sins.y, coss.y);
+        glge::sincos(euler.z * 0.5, sins.z, coss.z);
+        //combine to the quaternion
+        w = coss.x*coss.y*coss.z + sins.x*sins.y*sins.z;
+        i = sins.x*coss.y*coss.z - coss.x*sins.y*sins.z;
+        j = coss.x*sins.y*coss.z + sins.x*coss.y*sins.z;
+        k = coss.x*coss.y*sins.z - sins.x*sins.y*coss.z;
+    }
+
+    /**
+     * @brief Construct a new double quaternion from a rotation matrix
+     * 
+     * @param mat the rotation matrix, it must be orthonormal
+     */
+    explicit s_dquat(const dmat3& mat) noexcept : vec(fromRotation(mat.m, 3).vec) {}
+
+    /**
+     * @brief Construct a new double quaternion from the rotation part of a matrix
+     * 
+     * @param mat the matrix, the upper left 3x3 part must be orthonormal. The translation is ignored
+     */
+    explicit s_dquat(const dmat4& mat) noexcept : vec(fromRotation(mat.m, 4).vec) {}
+
+    /**
+     * @brief Destroy the double quaternion
+     */
+    ~s_dquat() {}
+
+    /**
+     * @brief convert the quaternion to a float quaternion
+     * 
+     * @return Quaternion the rounded float quaternion
+     */
+    inline Quaternion toQuaternion() const noexcept {return Quaternion((float)w, (float)i, (float)j, (float)k);}
+
+    /**
+     * @brief add two quaternions together
+     * 
+     * @param q the quaternion to add to this one
+     * @return dquat the sum of this and the other quaternion
+     */
+    inline s_dquat operator+(const s_dquat& q) const noexcept {return vec + q.vec;}
+
+    /**
+     * @brief subtract a quaternion from this one
+     * 
+     * @param q the quaternion to subtract from this one
+     * @return dquat the difference of the quaternions
+     */
+    inline s_dquat operator-(const s_dquat& q) const noexcept {return vec - q.vec;}
+
+    /**
+     * @brief conjugate this quaternion
+     * 
+     * @return dquat the conjugated quaternion
+     */
+    inline s_dquat operator-(void) const noexcept {
+        #if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_AVX2
+        //flip the sign bits of the imaginary parts
+        return dvec4(_mm256_xor_pd(vec.simd, _mm256_setr_pd(0., -0., -0., -0.)));
+        #else
+        return s_dquat(w, -i, -j, -k);
+        #endif
+    }
+
+    /**
+     * @brief get the inverse (conjugation) of this quaternion
+     * 
+     * @return dquat the conjugated (inversed) quaternion
+     */
+    inline s_dquat conjugate() const noexcept {return -(*this);}
+
+    /**
+     * @brief multiply two quaternions together
+     * 
+     * @param q the quaternion to multiply with
+     * @return dquat the product of both quaternions
+     */
+    inline s_dquat operator*(const s_dquat& q) const noexcept {
+        #if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_AVX2
+        //the lanes hold (w, i, j, k). Every element of this quaternion is multiplied by a permutation of q with the signs
+        //of the Hamilton product, starting with w * (q.w, q.i, q.j, q.k)
+        __m256d r = _mm256_mul_pd(_mm256_permute4x64_pd(vec.simd, _MM_SHUFFLE(0,0,0,0)), q.vec.simd);
+        //i * (-q.i, q.w, -q.k, q.j)
+        __m256d p = _mm256_xor_pd(_mm256_permute4x64_pd(q.vec.simd, _MM_SHUFFLE(2,3,0,1)), _mm256_setr_pd(-0., 0., -0., 0.));
+        __m256d s = _mm256_permute4x64_pd(vec.simd, _MM_SHUFFLE(1,1,1,1));
+        #if GLGE_MATH_ALLOW_FMA
+        r = _mm256_fmadd_pd(s, p, r);
+        #else
+        r = _mm256_add_pd(r, _mm256_mul_pd(s, p));
+        #endif
+        //j * (-q.j, q.k, q.w, -q.i)
+        p = _mm256_xor_pd(_mm256_permute4x64_pd(q.vec.simd, _MM_SHUFFLE(1,0,3,2)), _mm256_setr_pd(-0., 0., 0., -0.));
+        s = _mm256_permute4x64_pd(vec.simd, _MM_SHUFFLE(2,2,2,2));
+        #if GLGE_MATH_ALLOW_FMA
+        r = _mm256_fmadd_pd(s, p, r);
+        #else
+        r = _mm256_add_pd(r, _mm256_mul_pd(s, p));
+        #endif
+        //k * (-q.k, -q.j, q.i, q.w)
+        p = _mm256_xor_pd(_mm256_permute4x64_pd(q.vec.simd, _MM_SHUFFLE(0,1,2,3)), _mm256_setr_pd(-0., -0., 0., 0.));
+        s = _mm256_permute4x64_pd(vec.simd, _MM_SHUFFLE(3,3,3,3));
+        #if GLGE_MATH_ALLOW_FMA
+        return dvec4(_mm256_fmadd_pd(s, p, r));
+        #else
+        return dvec4(_mm256_add_pd(r, _mm256_mul_pd(s, p)));
+        #endif
+        #else
+        return s_dquat(
+            (w*q.w) - (i*q.i) - (j*q.j) - (k*q.k),
+            (i*q.w) + (w*q.i) + (j*q.k) - (k*q.j),
+            (j*q.w) + (w*q.j) + (k*q.i) - (i*q.k),
+            (k*q.w) + (w*q.k) + (i*q.j) - (j*q.i)
+        );
+        #endif
+    }
+
+    /**
+     * @brief multiply the quaternion by a 3D vector
+     * 
+     * @param v the 3D vector to multiply with
+     * @return dquat the result of the quaternion - 3D vector multiplication
+     */
+    inline s_dquat operator*(const dvec3& v) const noexcept {
+        return s_dquat(
+            - (x*v.x) - (y*v.y) - (z*v.z),
+              (w*v.x) + (y*v.z) - (z*v.y),
+              (w*v.y) + (z*v.x) - (x*v.z),
+              (w*v.z) + (x*v.y) - (y*v.x)
+        );
+    }
+
+    /**
+     * @brief scale the quaternion by a scalar
+     * 
+     * @param s the scalar to scale the quaternion with
+     * @return dquat the scaled quaternion
+     */
+    inline s_dquat operator*(double s) const noexcept {return vec * s;}
+
+    /**
+     * @brief scale down the quaternion by a scalar
+     * 
+     * @param s the scalar to divide all elements of the quaternion by
+     * @return dquat the scaled down quaternion
+     */
+    inline s_dquat operator/(double s) const noexcept {return vec / s;}
+
+    /**
+     * @brief rotate this quaternion with another and return the result
+     * 
+     * @param other the quaternion to apply to this one
+     * @return dquat the rotated quaternion
+     */
+    inline s_dquat rotate(const s_dquat& other) const noexcept
+    {return normalize((*this * other).vec);}
+
+    /**
+     * @brief rotate a 3D vector by this quaternion
+     * 
+     * Computes v + 2w(q x v) + 2q x (q x v) with the imaginary part q, which is the same as q * v * q^-1 without building
+     * two quaternion products. The quaternion must be normalized
+     * 
+     * @param v the vector to rotate
+     * @return dvec3 the rotated vector
+     */
+    inline dvec3 rotate(const dvec3& v) const noexcept {
+        //t = 2 (q x v)
+        double tx = 2. * (y*v.z - z*v.y);
+        double ty = 2. * (z*v.x - x*v.z);
+        double tz = 2. * (x*v.y - y*v.x);
+        //v + w t + q x t
+        return dvec3(
+            v.x + w*tx + (y*tz - z*ty),
+            v.y + w*ty + (z*tx - x*tz),
+            v.z + w*tz + (x*ty - y*tx)
+        );
+    }
+
+    /**
+     * @brief apply the rotation of another quaternion to this one
+     * 
+     * @param other the other quaternion to apply to this one
+     */
+    inline void rotateThis(const s_dquat& other) noexcept
+    {*this = rotate(other);}
+
+    /**
+     * @brief blend from this quaternion to another one using normalized linear interpolation
+     * 
+     * The other quaternion is negated if it lies in the opposite half space, so the blend takes the shortest path
+     * 
+     * @param other the normalized quaternion to blend to
+     * @param t the blend weight (0 : this quaternion, 1 : the other quaternion)
+     * @return dquat the normalized blended quaternion
+     */
+    inline s_dquat nlerp(const s_dquat& other, double t) const noexcept {
+        double wb = (dot(vec, other.vec) < 0.) ? -t : t;
+        return normalize(vec * (1. - t) + other.vec * wb);
+    }
+
+    /**
+     * @brief blend from this quaternion to another one using spherical linear interpolation
+     * 
+     * The blend takes the shortest path with a constant angular velocity. The angle is computed with atan2, which stays
+     * accurate for small angles. Nearly identical quaternions are blended linearly
+     * 
+     * @param other the normalized quaternion to blend to
+     * @param t the blend weight (0 : this quaternion, 1 : the other quaternion)
+     * @return dquat the blended quaternion
+     */
+    inline s_dquat slerp(const s_dquat& other, double t) const noexcept {
+        double d = dot(vec, other.vec);
+        double sign = (d < 0.) ? -1. : 1.;
+        d *= sign;
+        //the sine of the angle is the length of the difference to the projection
+        double s = length(other.vec * sign - vec * d);
+        if (s < 1e-12) {return nlerp(other, t);}
+        double a = glge::atan2(s, d);
+        return vec * (glge::sin((1. - t) * a) / s) + other.vec * (sign * glge::sin(t * a) / s);
+    }
+
+    /**
+     * @brief compute the rotation matrix of this quaternion
+     * 
+     * The quaternion must be normalized. The matrix rotates a vector the same way as rotate(const dvec3&)
+     * 
+     * @return dmat3 the rotation matrix
+     */
+    inline dmat3 toDMat3() const noexcept {
+        double x2 = x + x, y2 = y + y, z2 = z + z;
+        double xx = x * x2, yy = y * y2, zz = z * z2;
+        double xy = x * y2, xz = x * z2, yz = y * z2;
+        double wx = w * x2, wy = w * y2, wz = w * z2;
+        return dmat3(
+            1. - (yy + zz), xy - wz,        xz + wy,
+            xy + wz,        1. - (xx + zz), yz - wx,
+            xz - wy,        yz + wx,        1. - (xx + yy)
+        );
+    }
+
+    /**
+     * @brief compute the rotation matrix of this quaternion as a 4x4 matrix without translation
+     * 
+     * @return dmat4 the rotation matrix
+     */
+    inline dmat4 toDMat4() const noexcept {
+        //the rows of a dmat3 are padded with SIMD, so the elements are read from the packed array
+        dmat3 r = toDMat3();
+        return dmat4(
+            r.m[0], r.m[1], r.m[2], 0.,
+            r.m[3], r.m[4], r.m[5], 0.,
+            r.m[6], r.m[7], r.m[8], 0.,
+            0.,     0.,     0.,     1.
+        );
+    }
+
+    /**
+     * @brief convert a rotation matrix to a quaternion using Shepperd's method
+     * 
+     * The part of the quaternion with the largest magnitude is computed from the diagonal and the other parts from the
+     * off-diagonal elements, so the division never gets close to zero. The result always has a positive real part
+     * 
+     * @param m a pointer to the first row of the matrix
+     * @param stride the amount of doubles between the rows of the matrix (3 for a dmat3, 4 for a dmat4)
+     * @return dquat the quaternion that describes the same rotation
+     */
+    static inline s_dquat fromRotation(const double* m, size_t stride) noexcept {
+        const double* r0 = m;
+        const double* r1 = m + stride;
+        const double* r2 = m + 2*stride;
+        //select the largest of 4w^2 = 1 + trace, 4x^2 = 1 + 2m00 - trace, ... by comparing the trace to the diagonal
+        double trace = (r0[0] + r1[1]) + r2[2];
+        int c = 0;
+        double best = trace;
+        if (r0[0] > best) {c = 1; best = r0[0];}
+        if (r1[1] > best) {c = 2; best = r1[1];}
+        if (r2[2] > best) {c = 3;}
+
+        s_dquat q;
+        double t, s;
+        switch (c) {
+        case 0:
+            t = 1. + trace;
+            s = 0.5 / glge::sqrt(t);
+            q = s_dquat(t * s, (r2[1] - r1[2]) * s, (r0[2] - r2[0]) * s, (r1[0] - r0[1]) * s);
+            break;
+        case 1:
+            t = (1. + r0[0]) - (r1[1] + r2[2]);
+            s = 0.5 / glge::sqrt(t);
+            q = s_dquat((r2[1] - r1[2]) * s, t * s, (r0[1] + r1[0]) * s, (r0[2] + r2[0]) * s);
+            break;
+        case 2:
+            t = (1. + r1[1]) - (r0[0] + r2[2]);
+            s = 0.5 / glge::sqrt(t);
+            q = s_dquat((r0[2] - r2[0]) * s, (r0[1] + r1[0]) * s, t * s, (r1[2] + r2[1]) * s);
+            break;
+        default:
+            t = (1. + r2[2]) - (r0[0] + r1[1]);
+            s = 0.5 / glge::sqrt(t);
+            q = s_dquat((r1[0] - r0[1]) * s, (r0[2] + r2[0]) * s, (r1[2] + r2[1]) * s, t * s);
+            break;
+        }
+        //q and -q are the same rotation, keep the real part positive
+        return (q.w < 0.) ? s_dquat(-q.w, -q.x, -q.y, -q.z) : q;
+    }
+
+    #endif
+
+} dquat;
+
+/**
+ * @brief compute a double quaternion from euler angles
+ * 
+ * @param euler the euler angle (x : rotation around the x axis (roll), y : rotation around the y axis (pitch), z : rotation around the z axis (yaw))
+ * @return dquat the quaternion that represents the same rotation
+ */
+dquat dquat_fromEuler(const dvec3* euler);
+
+/**
+ * @brief convert a float quaternion to a double quaternion
+ * 
+ * @param q a pointer to the float quaternion
+ * @return dquat the double quaternion
+ */
+dquat dquat_fromQuaternion(const Quaternion* q);
+
+/**
+ * @brief convert a double quaternion to a float quaternion
+ * 
+ * @param q a pointer to the double quaternion
+ * @return Quaternion the rounded float quaternion
+ */
+Quaternion dquat_toQuaternion(const dquat* q);
+
+/**
+ * @brief add two quaternions together
+ * 
+ * @param q a pointer to the first quaternion
+ * @param p a pointer to the second quaternion
+ * @return dquat the sum of both quaternions
+ */
+dquat dquat_add(const dquat* q, const dquat* p);
+
+/**
+ * @brief subtract two quaternions
+ * 
+ * @param q a pointer to the quaternion to subtract from
+ * @param p a pointer to the quaternion to subtract
+ * @return dquat the difference of the quaternions
+ */
+dquat dquat_subtract(const dquat* q, const dquat* p);
+
+/**
+ * @brief conjugate a quaternion
+ * 
+ * This inverses the imaginary parts and keeps the real part as it is
+ * 
+ * @param q a pointer to the quaternion to conjugate
+ * @return dquat the conjugated quaternion
+ */
+dquat dquat_conjugate(const dquat* q);
+
+/**
+ * @brief multiply two quaternions together
+ * 
+ * @param q a pointer to the first quaternion
+ * @param p a pointer to the second quaternion
+ * @return dquat the product of both quaternions
+ */
+dquat dquat_multiply(const dquat* q, const dquat* p);
+
+/**
+ * @brief multiply a quaternion with a 3D vector
+ * 
+ * @param q a pointer to the quaternion
+ * @param v a pointer to the 3D vector
+ * @return dquat the product
+ */
+dquat dquat_multiplyWithDVec3(const dquat* q, const dvec3* v);
+
+/**
+ * @brief scale a quaternion
+ * 
+ * @param q a pointer to the quaternion to scale
+ * @param s the factor to scale the quaternion with
+ * @return dquat the scaled quaternion
+ */
+dquat dquat_scale(const dquat* q, double s);
+
+/**
+ * @brief divide a quaternion by a scalar
+ * 
+ * @param q a pointer to the quaternion to scale down
+ * @param s the inverse factor to scale down with
+ * @return dquat the scaled quaternion
+ */
+dquat dquat_divide(const dquat* q, double s);
+
+/**
+ * @brief rotate a specific quaternion by another quaternion
+ * 
+ * @param q the first quaternion
+ * @param other the quaternion to apply to the first quaternion
+ * @return dquat the quaternion that holds the combined rotation
+ */
+dquat dquat_rotate(const dquat* q, const dquat* other);
+
+/**
+ * @brief rotate a quaternion by another quaternion
+ * 
+ * @param q the rotation to rotate
+ * @param other the quaternion to apply to the first one
+ */
+void dquat_rotateThis(dquat* q, const dquat* other);
+
+/**
+ * @brief rotate a 3D vector by a quaternion
+ * 
+ * @param q a pointer to the normalized quaternion that describes the rotation
+ * @param v a pointer to the vector to rotate
+ * @return dvec3 the rotated vector
+ */
+dvec3 dquat_rotateDVec3(const dquat* q, const dvec3* v);
+
+/**
+ * @brief blend two quaternions along the shortest path using normalized linear interpolation
+ * 
+ * @param a a pointer to the normalized quaternion to blend from
+ * @param b a pointer to the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return dquat the normalized blended quaternion
+ */
+dquat dquat_nlerp(const dquat* a, const dquat* b, double t);
+
+/**
+ * @brief blend two quaternions along the shortest path using spherical linear interpolation
+ * 
+ * @param a a pointer to the normalized quaternion to blend from
+ * @param b a pointer to the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return dquat the blended quaternion
+ */
+dquat dquat_slerp(const dquat* a, const dquat* b, double t);
+
+/**
+ * @brief compute the rotation matrix of a quaternion
+ * 
+ * @param q a pointer to the normalized quaternion
+ * @return dmat3 the rotation matrix
+ */
+dmat3 dquat_toDMat3(const dquat* q);
+
+/**
+ * @brief compute the rotation matrix of a quaternion as a 4x4 matrix without translation
+ * 
+ * @param q a pointer to the normalized quaternion
+ * @return dmat4 the rotation matrix
+ */
+dmat4 dquat_toDMat4(const dquat* q);
+
+/**
+ * @brief convert a rotation matrix to a quaternion using Shepperd's method
+ * 
+ * @param mat a pointer to the orthonormal matrix
+ * @return dquat the quaternion with a positive real part that describes the same rotation
+ */
+dquat dquat_fromDMat3(const dmat3* mat);
+
+/**
+ * @brief convert the rotation part of a 4x4 matrix to a quaternion using Shepperd's method
+ * 
+ * @param mat a pointer to the matrix, the upper left 3x3 part must be orthonormal
+ * @return dquat the quaternion with a positive real part that describes the same rotation
+ */
+dquat dquat_fromDMat4(const dmat4* mat);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief blend two quaternions along the shortest path using normalized linear interpolation
+ * 
+ * @param a the normalized quaternion to blend from
+ * @param b the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return dquat the normalized blended quaternion
+ */
+inline dquat nlerp(const dquat& a, const dquat& b, double t) noexcept
+{return a.nlerp(b, t);}
+
+/**
+ * @brief blend two quaternions along the shortest path using spherical linear interpolation
+ * 
+ * @param a the normalized quaternion to blend from
+ * @param b the normalized quaternion to blend to
+ * @param t the blend weight (0 : a, 1 : b)
+ * @return dquat the blended quaternion
+ */
+inline dquat slerp(const dquat& a, const dquat& b, double t) noexcept
+{return a.slerp(b, t);}
+
+#endif
+
+#endif
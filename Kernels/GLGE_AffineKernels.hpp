@@ -0,0 +1,221 @@
+/**
+ * @file GLGE_AffineKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for affine 3x4 float matrices
+ * 
+ * Every matrix takes 12 floats (the upper 3 rows of a 4x4 matrix, see mat3x4). The same row of Pack::Width matrices is
+ * loaded and split into one pack per column, so every element of the matrices is a pack and Pack::Width matrices are
+ * processed at once. The kernels use the same steps as the functions of mat3x4.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_AFFINE_KERNELS_
+#define _GLGE_AFFINE_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include the quaternion kernels for loading and storing the rows of matrices
+#include "GLGE_QuatKernels.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief load the 12 elements of Pack::Width 3x4 matrices
+ * 
+ * @param p a pointer to the first matrix
+ * @param m an array of 12 packs to write the elements to (row major)
+ */
+inline void loadAffine(const float* p, Pack* m) noexcept {
+    for (size_t row = 0; row < 3; ++row)
+    {loadRows<12>(p + row*4, m + row*4);}
+}
+
+/**
+ * @brief store the 12 elements of Pack::Width 3x4 matrices
+ * 
+ * @param p a pointer to the first matrix
+ * @param m the 12 elements of the matrices (row major), they are overwritten
+ */
+inline void storeAffine(float* p, Pack* m) noexcept {
+    for (size_t row = 0; row < 3; ++row)
+    {storeRows<12>(p + row*4, m + row*4);}
+}
+
+/**
+ * @brief load the 12 elements of Pack::Width 3x4 matrices that are selected by indices
+ * 
+ * The groups of 4 floats of a pack are loaded for matrices that are 4 apart, so the transpose keeps the order of the 
+ * indices (see loadRows)
+ * 
+ * @param base a pointer to the first matrix the indices refer to
+ * @param indices a pointer to the Pack::Width indices of the matrices to load
+ * @param m an array of 12 packs to write the elements to (row major)
+ */
+inline void gatherAffine(const float* base, const uint32_t* indices, Pack* m) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    const size_t groups = Pack::Width / 4;
+    for (size_t row = 0; row < 3; ++row) {
+        Pack* c = m + row*4;
+        for (size_t r = 0; r < 4; ++r) {
+            const float* p[groups];
+            for (size_t g = 0; g < groups; ++g)
+            {p[g] = base + 12*(size_t)indices[4*g + r] + row*4;}
+            c[r] = gatherQuads(p);
+        }
+        transposeQuads(c);
+    }
+    #else
+    loadAffine(base + 12*(size_t)indices[0], m);
+    #endif
+}
+
+/**
+ * @brief compose Pack::Width pairs of 3x4 matrices
+ * 
+ * Every row of the product is the row of a times b, the implicit bottom row of b adds the w element of the row to the 
+ * translation. The steps are the same as in mat3x4::operator*
+ * 
+ * @param a the 12 elements of the matrices that are applied last
+ * @param b the 12 elements of the matrices that are applied first
+ * @param r an array of 12 packs to write the elements of the products to
+ */
+inline void affineMultiplyPack(const Pack* a, const Pack* b, Pack* r) noexcept {
+    for (size_t row = 0; row < 3; ++row) {
+        const Pack* ar = a + row*4;
+        for (size_t col = 0; col < 4; ++col)
+        {r[row*4 + col] = (ar[0] * b[col] + ar[1] * b[4 + col]) + ar[2] * b[8 + col];}
+        r[row*4 + 3] = r[row*4 + 3] + ar[3];
+    }
+}
+
+/**
+ * @brief compose a range of pairs of 3x4 matrices
+ * 
+ * @param a a pointer to the 12 floats of every matrix that is applied last
+ * @param b a pointer to the 12 floats of every matrix that is applied first
+ * @param out a pointer to write the 12 floats of every product to (may be a or b)
+ * @param n the amount of products to compute
+ */
+inline void affineMultiply(const float* a, const float* b, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack ma[12], mb[12], r[12];
+        loadAffine(a + i*12, ma);
+        loadAffine(b + i*12, mb);
+        affineMultiplyPack(ma, mb, r);
+        storeAffine(out + i*12, r);
+    }
+
+    //the remaining matrices are padded with identity matrices to fill the registers
+    if (i < n) {
+        float tmpA[12 * Pack::Width];
+        float tmpB[12 * Pack::Width];
+        for (size_t j = 0; j < 12 * Pack::Width; ++j)
+        {tmpA[j] = tmpB[j] = ((j % 12) % 5 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < (n - i) * 12; ++j) {
+            tmpA[j] = a[i*12 + j];
+            tmpB[j] = b[i*12 + j];
+        }
+        affineMultiply(tmpA, tmpB, tmpA, Pack::Width);
+        for (size_t j = 0; j < (n - i) * 12; ++j)
+        {out[i*12 + j] = tmpA[j];}
+    }
+}
+
+/**
+ * @brief compose a range of 3x4 matrices with matrices that are selected by indices
+ * 
+ * This propagates the world matrices of a level of a hierarchy, a holds the world matrices of the parents and b the 
+ * local matrices of the nodes
+ * 
+ * @param a a pointer to the 12 floats of every matrix the indices refer to, they are applied last
+ * @param indices a pointer to the index into a for every product
+ * @param b a pointer to the 12 floats of every matrix that is applied first
+ * @param out a pointer to write the 12 floats of every product to (may be b, but not a)
+ * @param n the amount of products to compute
+ */
+inline void affineMultiplyIndexed(const float* a, const uint32_t* indices, const float* b, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack ma[12], mb[12], r[12];
+        gatherAffine(a, indices + i, ma);
+        loadAffine(b + i*12, mb);
+        affineMultiplyPack(ma, mb, r);
+        storeAffine(out + i*12, r);
+    }
+
+    //the remaining products are computed with the padded kernel for contiguous matrices
+    if (i < n) {
+        float tmp[12 * Pack::Width];
+        for (size_t j = 0; j < n - i; ++j) {
+            for (size_t k = 0; k < 12; ++k)
+            {tmp[j*12 + k] = a[12*(size_t)indices[i + j] + k];}
+        }
+        affineMultiply(tmp, b + i*12, out + i*12, n - i);
+    }
+}
+
+/**
+ * @brief invert a range of 3x4 matrices
+ * 
+ * The steps are exactly the same as in mat3x4::inverse()
+ * 
+ * @param in a pointer to the 12 floats of every matrix
+ * @param out a pointer to write the 12 floats of every inverse matrix to (may be in)
+ * @param n the amount of matrices to invert
+ */
+inline void affineInverse(const float* in, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack m[12];
+        loadAffine(in + i*12, m);
+        //the columns of the inverse of the 3x3 part are the cross products of the rows
+        Pack x[3] = {m[5] * m[10] - m[6] * m[9], m[6] * m[8] - m[4] * m[10], m[4] * m[9] - m[5] * m[8]};
+        Pack y[3] = {m[9] * m[2] - m[10] * m[1], m[10] * m[0] - m[8] * m[2], m[8] * m[1] - m[9] * m[0]};
+        Pack z[3] = {m[1] * m[6] - m[2] * m[5], m[2] * m[4] - m[0] * m[6], m[0] * m[5] - m[1] * m[4]};
+        Pack invDet = set1(1.f) / ((m[0] * x[0] + m[1] * x[1]) + m[2] * x[2]);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        Pack r[12];
+        for (size_t k = 0; k < 3; ++k) {
+            Pack t = bitXor((x[k] * m[3] + y[k] * m[7]) + z[k] * m[11], set1(-0.f));
+            r[k*4] = x[k] * invDet;
+            r[k*4 + 1] = y[k] * invDet;
+            r[k*4 + 2] = z[k] * invDet;
+            r[k*4 + 3] = t * invDet;
+        }
+        storeAffine(out + i*12, r);
+    }
+
+    //the remaining matrices are padded with identity matrices to fill the registers
+    if (i < n) {
+        float tmp[12 * Pack::Width];
+        for (size_t j = 0; j < 12 * Pack::Width; ++j)
+        {tmp[j] = ((j % 12) % 5 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < (n - i) * 12; ++j)
+        {tmp[j] = in[i*12 + j];}
+        affineInverse(tmp, tmp, Pack::Width);
+        for (size_t j = 0; j < (n - i) * 12; ++j)
+        {out[i*12 + j] = tmp[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
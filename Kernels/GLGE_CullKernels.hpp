@@ -0,0 +1,177 @@
+/**
+ * @file GLGE_CullKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels that test bounding volumes against the 6 planes of a frustum
+ * 
+ * Pack::Width bounding volumes are loaded and split into one pack per axis, so the distances of Pack::Width volumes
+ * to a plane are computed at once. The results of all planes are combined into one bit per volume, the bits are either
+ * stored as a bitmask or used to write the indices of the visible volumes. The distances are computed with the same
+ * steps as in frustum_testSphere and frustum_testAABB, so both always agree.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_CULL_KERNELS_
+#define _GLGE_CULL_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief test Pack::Width spheres against the 6 planes of a frustum
+ * 
+ * @param planes the 24 plane elements, each broadcasted to a pack
+ * @param spheres a pointer to the center and the radius of Pack::Width spheres (4 floats each)
+ * @return uint32_t bit i is set if the ith sphere is at least partially inside of the frustum
+ */
+inline uint32_t cullSpheresPack(const Pack* planes, const float* spheres) noexcept {
+    Pack s[4];
+    loadVectors<4>(spheres, s);
+    Pack r = -s[3];
+    Pack outside = set1(0.f);
+    for (size_t k = 0; k < 6; ++k) {
+        const Pack* p = planes + k*4;
+        Pack d = ((s[0] * p[0] + s[1] * p[1]) + s[2] * p[2]) + p[3];
+        outside = bitOr(outside, lessThan(d, r));
+    }
+    return ~moveMask(outside) & (uint32_t)((1ull << Pack::Width) - 1);
+}
+
+/**
+ * @brief test Pack::Width axis aligned boxes against the 6 planes of a frustum
+ * 
+ * Only the corner of a box that is furthest along the normal of a plane is tested, the box is outside if that corner
+ * is outside
+ * 
+ * @param planes the 24 plane elements, each broadcasted to a pack
+ * @param positive the 18 flags that are true if the corresponding normal element of a plane is not negative
+ * @param mins a pointer to the minimal corners of Pack::Width boxes (3 floats each)
+ * @param maxs a pointer to the maximal corners of Pack::Width boxes (3 floats each)
+ * @return uint32_t bit i is set if the ith box is at least partially inside of the frustum
+ */
+inline uint32_t cullAABBsPack(const Pack* planes, const bool* positive, const float* mins, const float* maxs) noexcept {
+    Pack lo[3], hi[3];
+    loadVectors<3>(mins, lo);
+    loadVectors<3>(maxs, hi);
+    Pack zero = set1(0.f);
+    Pack outside = zero;
+    for (size_t k = 0; k < 6; ++k) {
+        const Pack* p = planes + k*4;
+        const bool* s = positive + k*3;
+        Pack d = (((s[0] ? hi[0] : lo[0]) * p[0] + (s[1] ? hi[1] : lo[1]) * p[1]) + (s[2] ? hi[2] : lo[2]) * p[2]) + p[3];
+        outside = bitOr(outside, lessThan(d, zero));
+    }
+    return ~moveMask(outside) & (uint32_t)((1ull << Pack::Width) - 1);
+}
+
+/**
+ * @brief write the result of Pack::Width volumes
+ * 
+ * @tparam Compact true : the indices of the visible volumes are written | false : the bits are written to a bitmask
+ * @param bits the bits of the volumes
+ * @param i the index of the first volume, a multiple of Pack::Width
+ * @param count the amount of visible volumes before the first one
+ * @param out a pointer to the indices or the 32 bit words of the bitmask
+ * @param lanes the amount of volumes, the indices are never written past the last volume
+ * @return size_t the amount of visible volumes including the new ones
+ */
+template <bool Compact> inline size_t cullWrite(uint32_t bits, size_t i, size_t count, uint32_t* out, size_t lanes = Pack::Width) noexcept {
+    //Pack::Width divides 32, so the bits of a pack never cross a word of the bitmask
+    if (!Compact) {
+        if ((i & 31) == 0) {out[i / 32] = 0;}
+        out[i / 32] |= bits << (i & 31);
+    }
+    //the index is always written and the counter only advances if the volume is visible, so there is no branch
+    for (size_t l = 0; l < lanes; ++l) {
+        if (Compact) {out[count] = (uint32_t)(i + l);}
+        count += (bits >> l) & 1;
+    }
+    return count;
+}
+
+/**
+ * @brief test a range of spheres against the 6 planes of a frustum
+ * 
+ * @tparam Compact true : the indices of the visible spheres are written | false : one bit per sphere is written
+ * @param planes a pointer to the 24 floats of the normalized planes (normal and distance)
+ * @param spheres a pointer to the center and the radius of every sphere (4 floats each)
+ * @param n the amount of spheres
+ * @param out a pointer to n indices or to (n + 31) / 32 words of the bitmask
+ * @return size_t the amount of visible spheres
+ */
+template <bool Compact> inline size_t cullSpheres(const float* planes, const float* spheres, size_t n, uint32_t* out) noexcept {
+    Pack p[24];
+    for (size_t k = 0; k < 24; ++k) {p[k] = set1(planes[k]);}
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width)
+    {count = cullWrite<Compact>(cullSpheresPack(p, spheres + i*4), i, count, out);}
+
+    //the remaining spheres are padded with empty spheres at the origin and their bits are cleared
+    if (i < n) {
+        float tmp[4 * Pack::Width] = {};
+        for (size_t j = 0; j < (n - i) * 4; ++j) {tmp[j] = spheres[i*4 + j];}
+        uint32_t bits = cullSpheresPack(p, tmp) & (uint32_t)((1ull << (n - i)) - 1);
+        count = cullWrite<Compact>(bits, i, count, out, n - i);
+    }
+    return count;
+}
+
+/**
+ * @brief test a range of axis aligned boxes against the 6 planes of a frustum
+ * 
+ * @tparam Compact true : the indices of the visible boxes are written | false : one bit per box is written
+ * @param planes a pointer to the 24 floats of the normalized planes (normal and distance)
+ * @param mins a pointer to the minimal corner of every box (3 floats each)
+ * @param maxs a pointer to the maximal corner of every box (3 floats each)
+ * @param n the amount of boxes
+ * @param out a pointer to n indices or to (n + 31) / 32 words of the bitmask
+ * @return size_t the amount of visible boxes
+ */
+template <bool Compact> inline size_t cullAABBs(const float* planes, const float* mins, const float* maxs, size_t n, uint32_t* out) noexcept {
+    Pack p[24];
+    bool positive[18];
+    for (size_t k = 0; k < 6; ++k) {
+        for (size_t j = 0; j < 4; ++j) {p[k*4 + j] = set1(planes[k*4 + j]);}
+        for (size_t j = 0; j < 3; ++j) {positive[k*3 + j] = planes[k*4 + j] >= 0.f;}
+    }
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width)
+    {count = cullWrite<Compact>(cullAABBsPack(p, positive, mins + i*3, maxs + i*3), i, count, out);}
+
+    //the remaining boxes are padded with empty boxes at the origin and their bits are cleared
+    if (i < n) {
+        float tmpMin[3 * Pack::Width] = {};
+        float tmpMax[3 * Pack::Width] = {};
+        for (size_t j = 0; j < (n - i) * 3; ++j) {
+            tmpMin[j] = mins[i*3 + j];
+            tmpMax[j] = maxs[i*3 + j];
+        }
+        uint32_t bits = cullAABBsPack(p, positive, tmpMin, tmpMax) & (uint32_t)((1ull << (n - i)) - 1);
+        count = cullWrite<Compact>(bits, i, count, out, n - i);
+    }
+    return count;
+}
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,220 @@
+/**
+ * @file GLGE_DMat4Kernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for 4x4 double matrices
+ * 
+ * The kernels work on plain doubles, the matrix is stored row major (like dmat4::m). Every lane of a pack belongs to a
+ * different matrix or vector, so the kernels use exactly the steps of the scalar functions of dmat4 and only the loads and
+ * stores need to shuffle. With AVX2 the sums of the products are fused into the multiplications like the AVX2 build of dmat4 does,
+ * the inverse never fuses anything and is bit-identical for every instruction set.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_DMAT4_KERNELS_
+#define _GLGE_DMAT4_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief load DPack::Width matrices so every pack holds a single element of all matrices
+ * 
+ * @param in a pointer to the first matrix
+ * @param e an array of 16 packs to write the elements to (row major)
+ */
+inline void loadDMat4s(const double* in, DPack* e) noexcept {
+    for (size_t row = 0; row < 4; ++row)
+    {loadColumns<4>(in + row*4, 16, e + row*4);}
+}
+
+/**
+ * @brief store DPack::Width matrices from packs that hold a single element of all matrices
+ * 
+ * @param out a pointer to write the first matrix to
+ * @param e an array of 16 packs holding the elements (row major)
+ */
+inline void storeDMat4s(double* out, const DPack* e) noexcept {
+    for (size_t row = 0; row < 4; ++row)
+    {storeColumns<4>(out + row*4, 16, e + row*4);}
+}
+
+/**
+ * @brief multiply every matrix of an array with the matching matrix of another array
+ * 
+ * The product is computed row by row like the single matrix product: every element of a row of the left matrix is 
+ * broadcasted and multiplied with the matching row of the right matrix. This needs no shuffles at all, so the rows 
+ * are used directly instead of transposing the matrices into packs.
+ * 
+ * @param a a pointer to the left matrices
+ * @param b a pointer to the right matrices
+ * @param out a pointer to write the products to (may be a or b)
+ * @param n the amount of matrices to multiply
+ */
+inline void dmat4Multiply(const double* a, const double* b, double* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        const double* ma = a + i*16;
+        const double* mb = b + i*16;
+        DQuad b0 = loadDQuad(mb);
+        DQuad b1 = loadDQuad(mb + 4);
+        DQuad b2 = loadDQuad(mb + 8);
+        DQuad b3 = loadDQuad(mb + 12);
+        //compute all rows before storing them, so the output may alias the input
+        DQuad r[4];
+        for (size_t row = 0; row < 4; ++row) {
+            const double* ar = ma + row*4;
+            //same order as the single matrix product: ((a0 * b0 + a1 * b1) + a2 * b2) + a3 * b3
+            r[row] = fma(broadcastDQuad(ar + 3), b3, fma(broadcastDQuad(ar + 2), b2, fma(broadcastDQuad(ar + 1), b1, broadcastDQuad(ar) * b0)));
+        }
+        for (size_t row = 0; row < 4; ++row)
+        {storeDQuad(out + i*16 + row*4, r[row]);}
+    }
+}
+
+/**
+ * @brief transform a range of vectors with N axis (3 or 4) by a 4x4 double matrix
+ * 
+ * @tparam N the amount of axis of the vectors. 3D vectors only use the upper 3x4 part of the matrix
+ * @tparam Points only used for 3D vectors. true : the vectors are points (w = 1) | false : the vectors are directions (w = 0)
+ * @param mat a pointer to the 16 doubles of the matrix
+ * @param in a pointer to the first vector to transform
+ * @param out a pointer to write the transformed vectors to (may be in)
+ * @param n the amount of vectors to transform
+ * @param stride the distance between two vectors in doubles (the SIMD layout of dvec3 is padded to 4 doubles)
+ */
+template <size_t N, bool Points> void dmat4Transform(const double* mat, const double* in, double* out, size_t n, size_t stride) noexcept {
+    //keep the used part of the matrix in registers
+    DPack m[16];
+    for (size_t j = 0; j < 16; ++j)
+    {m[j] = set1(mat[j]);}
+
+    size_t i = 0;
+    for (; i + DPack::Width <= n; i += DPack::Width) {
+        DPack v[4];
+        loadColumns<N>(in + i*stride, stride, v);
+        DPack r[4];
+        for (size_t row = 0; row < N; ++row) {
+            const DPack* mr = m + row*4;
+            r[row] = fma(mr[2], v[2], fma(mr[1], v[1], mr[0] * v[0]));
+            if (N == 4) {r[row] = fma(mr[3], v[3], r[row]);}
+            else if (Points) {r[row] = r[row] + mr[3];}
+        }
+        storeColumns<N>(out + i*stride, stride, r);
+    }
+
+    //transform the remaining vectors in a padded buffer
+    if (i < n) {
+        size_t count = n - i;
+        double tmp[4 * DPack::Width] = {0};
+        for (size_t j = 0; j < count; ++j) {
+            for (size_t k = 0; k < N; ++k) {tmp[j*4 + k] = in[(i + j)*stride + k];}
+        }
+        dmat4Transform<N, Points>(mat, tmp, tmp, DPack::Width, 4);
+        for (size_t j = 0; j < count; ++j) {
+            for (size_t k = 0; k < N; ++k) {out[(i + j)*stride + k] = tmp[j*4 + k];}
+        }
+    }
+}
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * @param in a pointer to the matrices to invert
+ * @param out a pointer to write the inverse matrices to (may be in)
+ * @param n the amount of matrices to invert
+ */
+inline void dmat4Inverse(const double* in, double* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + DPack::Width <= n; i += DPack::Width) {
+        DPack e[16];
+        loadDMat4s(in + i*16, e);
+        //same steps as dmat4::adjugate(), the rows are named a to d
+        const DPack* a = e;
+        const DPack* b = e + 4;
+        const DPack* c = e + 8;
+        const DPack* d = e + 12;
+        //2x2 sub-determinants of the rows c and d, the numbers are the columns of the sub-matrix
+        DPack a01 = c[0] * d[1] - c[1] * d[0];
+        DPack a02 = c[0] * d[2] - c[2] * d[0];
+        DPack a03 = c[0] * d[3] - c[3] * d[0];
+        DPack a12 = c[1] * d[2] - c[2] * d[1];
+        DPack a13 = c[1] * d[3] - c[3] * d[1];
+        DPack a23 = c[2] * d[3] - c[3] * d[2];
+        //2x2 sub-determinants of the rows b and d
+        DPack b01 = b[0] * d[1] - b[1] * d[0];
+        DPack b02 = b[0] * d[2] - b[2] * d[0];
+        DPack b03 = b[0] * d[3] - b[3] * d[0];
+        DPack b12 = b[1] * d[2] - b[2] * d[1];
+        DPack b13 = b[1] * d[3] - b[3] * d[1];
+        DPack b23 = b[2] * d[3] - b[3] * d[2];
+        //2x2 sub-determinants of the rows b and c
+        DPack c01 = b[0] * c[1] - b[1] * c[0];
+        DPack c02 = b[0] * c[2] - b[2] * c[0];
+        DPack c03 = b[0] * c[3] - b[3] * c[0];
+        DPack c12 = b[1] * c[2] - b[2] * c[1];
+        DPack c13 = b[1] * c[3] - b[3] * c[1];
+        DPack c23 = b[2] * c[3] - b[3] * c[2];
+
+        DPack r[16];
+        //row 0 (minors without column 0)
+        r[0]  =  ((b[1] * a23 - b[2] * a13) + b[3] * a12);
+        r[1]  = -((a[1] * a23 - a[2] * a13) + a[3] * a12);
+        r[2]  =  ((a[1] * b23 - a[2] * b13) + a[3] * b12);
+        r[3]  = -((a[1] * c23 - a[2] * c13) + a[3] * c12);
+        //row 1 (minors without column 1)
+        r[4]  = -((b[0] * a23 - b[2] * a03) + b[3] * a02);
+        r[5]  =  ((a[0] * a23 - a[2] * a03) + a[3] * a02);
+        r[6]  = -((a[0] * b23 - a[2] * b03) + a[3] * b02);
+        r[7]  =  ((a[0] * c23 - a[2] * c03) + a[3] * c02);
+        //row 2 (minors without column 2)
+        r[8]  =  ((b[0] * a13 - b[1] * a03) + b[3] * a01);
+        r[9]  = -((a[0] * a13 - a[1] * a03) + a[3] * a01);
+        r[10] =  ((a[0] * b13 - a[1] * b03) + a[3] * b01);
+        r[11] = -((a[0] * c13 - a[1] * c03) + a[3] * c01);
+        //row 3 (minors without column 3)
+        r[12] = -((b[0] * a12 - b[1] * a02) + b[2] * a01);
+        r[13] =  ((a[0] * a12 - a[1] * a02) + a[2] * a01);
+        r[14] = -((a[0] * b12 - a[1] * b02) + a[2] * b01);
+        r[15] =  ((a[0] * c12 - a[1] * c02) + a[2] * c01);
+
+        //the determinant is the dot product of the top row and the first column of the adjugate
+        DPack inv_det = set1(1.) / ((a[0] * r[0] + a[1] * r[4]) + (a[2] * r[8] + a[3] * r[12]));
+        for (size_t j = 0; j < 16; ++j) {r[j] = r[j] * inv_det;}
+        storeDMat4s(out + i*16, r);
+    }
+
+    //invert the remaining matrices in a buffer that is padded with identity matrices
+    if (i < n) {
+        size_t count = n - i;
+        double tmp[16 * DPack::Width] = {0};
+        for (size_t j = 0; j < DPack::Width; ++j) {
+            for (size_t k = 0; k < 16; ++k)
+            {tmp[j*16 + k] = (j < count) ? in[(i + j)*16 + k] : ((k % 5 == 0) ? 1. : 0.);}
+        }
+        dmat4Inverse(tmp, tmp, DPack::Width);
+        for (size_t j = 0; j < count*16; ++j)
+        {out[i*16 + j] = tmp[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,286 @@
+/**
+ * @file GLGE_GeometryKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for the intersection tests and transformations of the geometric primitives
+ * 
+ * Pack::Width primitives are loaded and split into one pack per element (structure of arrays), the single ray or box
+ * they are tested against is broadcasted. The steps are the same as in the functions of aabb3 and ray3, so the batch
+ * functions and the functions for single primitives always agree.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_GEOMETRY_KERNELS_
+#define _GLGE_GEOMETRY_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include the quaternion kernels for loading and storing groups of 4 floats
+#include "GLGE_QuatKernels.hpp"
+//include the culling kernels for writing the indices or bits of the results
+#include "GLGE_CullKernels.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief load Pack::Width axis aligned boxes (6 floats each, the minimum then the maximum)
+ * 
+ * The first and the last 4 floats of every box are loaded as rows, they overlap in 2 floats
+ * 
+ * @param p a pointer to the first box
+ * @param lo an array of 3 packs to write the minima to
+ * @param hi an array of 3 packs to write the maxima to
+ */
+inline void loadAABBs(const float* p, Pack* lo, Pack* hi) noexcept {
+    Pack a[4], b[4];
+    loadRows<6>(p, a);
+    loadRows<6>(p + 2, b);
+    lo[0] = a[0]; lo[1] = a[1]; lo[2] = a[2];
+    hi[0] = a[3]; hi[1] = b[2]; hi[2] = b[3];
+}
+
+/**
+ * @brief store Pack::Width axis aligned boxes (6 floats each, the minimum then the maximum)
+ * 
+ * @param p a pointer to the first box
+ * @param lo the 3 packs of the minima
+ * @param hi the 3 packs of the maxima
+ */
+inline void storeAABBs(float* p, const Pack* lo, const Pack* hi) noexcept {
+    Pack a[4] = {lo[0], lo[1], lo[2], hi[0]};
+    Pack b[4] = {lo[2], hi[0], hi[1], hi[2]};
+    storeRows<6>(p, a);
+    storeRows<6>(p + 2, b);
+}
+
+/**
+ * @brief intersect a ray with Pack::Width axis aligned boxes using the slab test
+ * 
+ * The ray enters the slab of an axis at the bound it points away from. A distance is NaN if the ray is parallel to a slab
+ * and starts on one of its bounds, the new distance is the first operand of min and max so a NaN never replaces the range
+ * 
+ * @param ray the broadcasted origin, inverse direction and maximal distance of the ray (7 packs)
+ * @param negative the 3 flags that are true if the corresponding element of the inverse direction is negative
+ * @param boxes a pointer to the first box
+ * @return Pack the distance along the ray where it enters every box, infinity if the box is missed
+ */
+inline Pack rayAABBsPack(const Pack* ray, const bool* negative, const float* boxes) noexcept {
+    Pack lo[3], hi[3];
+    loadAABBs(boxes, lo, hi);
+    Pack tNear = set1(0.f);
+    Pack tFar = ray[6];
+    for (size_t k = 0; k < 3; ++k) {
+        Pack tEnter = ((negative[k] ? hi[k] : lo[k]) - ray[k]) * ray[3 + k];
+        Pack tExit = ((negative[k] ? lo[k] : hi[k]) - ray[k]) * ray[3 + k];
+        tNear = max(tEnter, tNear);
+        tFar = min(tExit, tFar);
+    }
+    return select(lessThan(tFar, tNear), set1(INFINITY), tNear);
+}
+
+/**
+ * @brief intersect a ray with Pack::Width spheres
+ * 
+ * @param ray the broadcasted origin, direction, squared length of the direction and maximal distance of the ray (8 packs)
+ * @param spheres a pointer to the center and the radius of the first sphere (4 floats each)
+ * @return Pack the distance along the ray of the first intersection in front of the origin, infinity if the sphere is missed
+ */
+inline Pack raySpheresPack(const Pack* ray, const float* spheres) noexcept {
+    Pack s[4];
+    loadVectors<4>(spheres, s);
+    Pack oc[3] = {ray[0] - s[0], ray[1] - s[1], ray[2] - s[2]};
+    Pack b = (oc[0] * ray[3] + oc[1] * ray[4]) + oc[2] * ray[5];
+    Pack c = ((oc[0] * oc[0] + oc[1] * oc[1]) + oc[2] * oc[2]) - s[3] * s[3];
+    Pack disc = b * b - ray[6] * c;
+    Pack root = sqrt(disc);
+    Pack t = (-b - root) / ray[6];
+    //if the origin is inside of the sphere the ray leaves it at the second intersection
+    t = select(lessThan(t, set1(0.f)), (-b + root) / ray[6], t);
+    Pack miss = bitOr(lessThan(disc, set1(0.f)), bitOr(lessThan(t, set1(0.f)), lessThan(ray[7], t)));
+    return select(miss, set1(INFINITY), t);
+}
+
+/**
+ * @brief count the hits of Pack::Width intersection distances
+ * 
+ * @param t the distances, infinity for a miss
+ * @return size_t the amount of distances that are not infinity
+ */
+inline size_t countHits(Pack t) noexcept {
+    uint32_t bits = moveMask(lessThan(t, set1(INFINITY)));
+    size_t count = 0;
+    for (size_t l = 0; l < Pack::Width; ++l) {count += (bits >> l) & 1;}
+    return count;
+}
+
+/**
+ * @brief intersect a ray with a range of axis aligned boxes
+ * 
+ * @param ray a pointer to the origin, the inverse direction and the maximal distance of the ray (7 floats)
+ * @param boxes a pointer to the 6 floats of every box
+ * @param n the amount of boxes
+ * @param t a pointer to write the distance along the ray where it enters every box to, infinity if the box is missed
+ * @return size_t the amount of boxes that are hit
+ */
+inline size_t rayAABBs(const float* ray, const float* boxes, size_t n, float* t) noexcept {
+    Pack r[7];
+    for (size_t k = 0; k < 7; ++k) {r[k] = set1(ray[k]);}
+    bool negative[3] = {ray[3] < 0.f, ray[4] < 0.f, ray[5] < 0.f};
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack d = rayAABBsPack(r, negative, boxes + i*6);
+        storeu(t + i, d);
+        count += countHits(d);
+    }
+
+    //the remaining boxes are padded with empty boxes at the origin, their distances are not written
+    if (i < n) {
+        float tmp[6 * Pack::Width] = {};
+        float dst[Pack::Width];
+        for (size_t j = 0; j < (n - i) * 6; ++j) {tmp[j] = boxes[i*6 + j];}
+        storeu(dst, rayAABBsPack(r, negative, tmp));
+        for (size_t j = 0; j < n - i; ++j) {
+            t[i + j] = dst[j];
+            count += (dst[j] < INFINITY) ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief intersect a ray with a range of spheres
+ * 
+ * @param ray a pointer to the origin, the direction, the squared length of the direction and the maximal distance of the ray (8 floats)
+ * @param spheres a pointer to the center and the radius of every sphere (4 floats each)
+ * @param n the amount of spheres
+ * @param t a pointer to write the distance along the ray of the first intersection with every sphere to, infinity if the sphere is missed
+ * @return size_t the amount of spheres that are hit
+ */
+inline size_t raySpheres(const float* ray, const float* spheres, size_t n, float* t) noexcept {
+    Pack r[8];
+    for (size_t k = 0; k < 8; ++k) {r[k] = set1(ray[k]);}
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack d = raySpheresPack(r, spheres + i*4);
+        storeu(t + i, d);
+        count += countHits(d);
+    }
+
+    //the remaining spheres are padded with empty spheres at the origin, their distances are not written
+    if (i < n) {
+        float tmp[4 * Pack::Width] = {};
+        float dst[Pack::Width];
+        for (size_t j = 0; j < (n - i) * 4; ++j) {tmp[j] = spheres[i*4 + j];}
+        storeu(dst, raySpheresPack(r, tmp));
+        for (size_t j = 0; j < n - i; ++j) {
+            t[i + j] = dst[j];
+            count += (dst[j] < INFINITY) ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+/**
+ * @brief test Pack::Width axis aligned boxes for an overlap with a box
+ * 
+ * @param box the broadcasted minimum and maximum of the box (6 packs)
+ * @param boxes a pointer to the first box
+ * @return uint32_t bit i is set if the ith box overlaps the box
+ */
+inline uint32_t aabbOverlapsPack(const Pack* box, const float* boxes) noexcept {
+    Pack lo[3], hi[3];
+    loadAABBs(boxes, lo, hi);
+    Pack outside = set1(0.f);
+    for (size_t k = 0; k < 3; ++k)
+    {outside = bitOr(outside, bitOr(lessThan(hi[k], box[k]), lessThan(box[3 + k], lo[k])));}
+    return ~moveMask(outside) & (uint32_t)((1ull << Pack::Width) - 1);
+}
+
+/**
+ * @brief find all axis aligned boxes of a range that overlap a box
+ * 
+ * @tparam Compact true : the indices of the overlapping boxes are written | false : one bit per box is written
+ * @param box a pointer to the 6 floats of the box
+ * @param boxes a pointer to the 6 floats of every box to test
+ * @param n the amount of boxes to test
+ * @param out a pointer to n indices or to (n + 31) / 32 words of the bitmask
+ * @return size_t the amount of overlapping boxes
+ */
+template <bool Compact> inline size_t aabbOverlaps(const float* box, const float* boxes, size_t n, uint32_t* out) noexcept {
+    Pack b[6];
+    for (size_t k = 0; k < 6; ++k) {b[k] = set1(box[k]);}
+    size_t count = 0;
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width)
+    {count = cullWrite<Compact>(aabbOverlapsPack(b, boxes + i*6), i, count, out);}
+
+    //the remaining boxes are padded with empty boxes at the origin and their bits are cleared
+    if (i < n) {
+        float tmp[6 * Pack::Width] = {};
+        for (size_t j = 0; j < (n - i) * 6; ++j) {tmp[j] = boxes[i*6 + j];}
+        uint32_t bits = aabbOverlapsPack(b, tmp) & (uint32_t)((1ull << (n - i)) - 1);
+        count = cullWrite<Compact>(bits, i, count, out, n - i);
+    }
+    return count;
+}
+
+/**
+ * @brief transform a range of axis aligned boxes by a matrix and compute the boxes around the results (Arvo's method)
+ * 
+ * Every element of the upper 3x3 part of the matrix scales the minimum and the maximum along an axis, the smaller
+ * product is added to the new minimum and the larger one to the new maximum. The translation is the start of both.
+ * 
+ * @param mat a pointer to the 16 floats of the row major matrix, only the upper 3x4 part is used
+ * @param in a pointer to the 6 floats of every box
+ * @param out a pointer to write the 6 floats of every transformed box to (may be in)
+ * @param n the amount of boxes
+ */
+inline void aabbTransform(const float* mat, const float* in, float* out, size_t n) noexcept {
+    Pack m[12];
+    for (size_t k = 0; k < 12; ++k) {m[k] = set1(mat[k]);}
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack lo[3], hi[3], rlo[3], rhi[3];
+        loadAABBs(in + i*6, lo, hi);
+        for (size_t row = 0; row < 3; ++row) {
+            rlo[row] = rhi[row] = m[row*4 + 3];
+            for (size_t col = 0; col < 3; ++col) {
+                Pack a = m[row*4 + col] * lo[col];
+                Pack b = m[row*4 + col] * hi[col];
+                rlo[row] = rlo[row] + min(a, b);
+                rhi[row] = rhi[row] + max(a, b);
+            }
+        }
+        storeAABBs(out + i*6, rlo, rhi);
+    }
+
+    //the remaining boxes are padded with empty boxes at the origin
+    if (i < n) {
+        float tmp[6 * Pack::Width] = {};
+        for (size_t j = 0; j < (n - i) * 6; ++j) {tmp[j] = in[i*6 + j];}
+        aabbTransform(mat, tmp, tmp, Pack::Width);
+        for (size_t j = 0; j < (n - i) * 6; ++j) {out[i*6 + j] = tmp[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,1123 @@
+/**
+ * @file GLGE_KernelPack.hpp
+ * @author DM8AT
+ * @brief define a register sized pack of floats so the batch kernels only need to be written once for all instruction sets
+ * 
+ * This is an internal header of the library. It is only included by the kernels and the wide types and is not meant to be used directly
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_KERNEL_PACK_
+#define _GLGE_KERNEL_PACK_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the settings
+#include "../GLGEMath_Settings.h"
+
+//the level of the instruction set the packs are written for. The kernel translation units define the level they are
+//compiled for (see GLGE_Dispatch.h for the values), else it is derived from the target of the compiler
+#ifndef GLGE_KERNEL_LEVEL
+#if !GLGE_MATH_USE_SIMD
+#define GLGE_KERNEL_LEVEL 0
+#elif GLGE_MATH_ALLOW_AVX2
+#define GLGE_KERNEL_LEVEL 3
+#elif defined(__SSE4_1__)
+#define GLGE_KERNEL_LEVEL 2
+#else
+#define GLGE_KERNEL_LEVEL 1
+#endif
+#endif
+
+//select a namespace for the level, so the packs of different levels never collide when they are linked together
+#if GLGE_KERNEL_LEVEL >= 4
+#define GLGE_KERNEL_NAMESPACE avx512
+#elif GLGE_KERNEL_LEVEL == 3
+#define GLGE_KERNEL_NAMESPACE avx2
+#elif GLGE_KERNEL_LEVEL == 2
+#define GLGE_KERNEL_NAMESPACE sse41
+#elif GLGE_KERNEL_LEVEL == 1
+#define GLGE_KERNEL_NAMESPACE sse2
+#else
+#define GLGE_KERNEL_NAMESPACE scalar
+#endif
+
+//include the SIMD intrinsics for the level
+#if GLGE_KERNEL_LEVEL >= 3
+#include <immintrin.h>
+#elif GLGE_KERNEL_LEVEL == 2
+#include <smmintrin.h>
+#elif GLGE_KERNEL_LEVEL == 1
+#include <emmintrin.h>
+#endif
+
+//include the C math library for the scalar fallback
+#include <cmath>
+//include memcpy and the fixed size integers to access the bits of the scalar fallback
+#include <cstring>
+#include <stdint.h>
+
+/**
+ * @brief the namespace for the internal batch kernels
+ */
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+//check for AVX-512 to use 16 floats per pack
+#if GLGE_KERNEL_LEVEL >= 4
+
+/**
+ * @brief store 16 floats in an AVX-512 register
+ */
+struct Pack {
+    //the register holding the floats
+    __m512 v;
+    //the amount of floats in a single pack
+    static const size_t Width = 16;
+};
+
+inline Pack load(const float* p) noexcept {return {_mm512_load_ps(p)};}
+inline Pack loadu(const float* p) noexcept {return {_mm512_loadu_ps(p)};}
+inline void store(float* p, Pack a) noexcept {_mm512_store_ps(p, a.v);}
+inline void storeu(float* p, Pack a) noexcept {_mm512_storeu_ps(p, a.v);}
+inline Pack set1(float f) noexcept {return {_mm512_set1_ps(f)};}
+inline Pack operator+(Pack a, Pack b) noexcept {return {_mm512_add_ps(a.v, b.v)};}
+inline Pack operator-(Pack a, Pack b) noexcept {return {_mm512_sub_ps(a.v, b.v)};}
+inline Pack operator*(Pack a, Pack b) noexcept {return {_mm512_mul_ps(a.v, b.v)};}
+inline Pack operator/(Pack a, Pack b) noexcept {return {_mm512_div_ps(a.v, b.v)};}
+inline Pack fma(Pack a, Pack b, Pack c) noexcept {return {_mm512_fmadd_ps(a.v, b.v, c.v)};}
+inline Pack sqrt(Pack a) noexcept {return {_mm512_sqrt_ps(a.v)};}
+//approximate reciprocal square root, the relative error is at most 2^-14
+inline Pack rsqrt(Pack a) noexcept {return {_mm512_rsqrt14_ps(a.v)};}
+inline Pack max(Pack a, Pack b) noexcept {return {_mm512_max_ps(a.v, b.v)};}
+inline Pack min(Pack a, Pack b) noexcept {return {_mm512_min_ps(a.v, b.v)};}
+inline Pack abs(Pack a) noexcept {return {_mm512_abs_ps(a.v)};}
+//round to the nearest integer, ties to even
+inline Pack round(Pack a) noexcept {return {_mm512_roundscale_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};}
+inline float first(Pack a) noexcept {return _mm512_cvtss_f32(a.v);}
+
+//AVX-512F only has bitwise operations for integers
+inline Pack bitAnd(Pack a, Pack b) noexcept {return {_mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.v), _mm512_castps_si512(b.v)))};}
+inline Pack bitOr(Pack a, Pack b) noexcept {return {_mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(a.v), _mm512_castps_si512(b.v)))};}
+inline Pack bitXor(Pack a, Pack b) noexcept {return {_mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.v), _mm512_castps_si512(b.v)))};}
+inline Pack operator-(Pack a) noexcept {return bitXor(a, set1(-0.f));}
+
+//the comparisons result in a pack with all bits set where the comparison is true, so the masks work like the ones of SSE and AVX
+inline Pack maskToPack(__mmask16 m) noexcept {return {_mm512_castsi512_ps(_mm512_maskz_set1_epi32(m, -1))};}
+inline Pack lessThan(Pack a, Pack b) noexcept {return maskToPack(_mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ));}
+inline Pack greaterThan(Pack a, Pack b) noexcept {return maskToPack(_mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ));}
+inline Pack equal(Pack a, Pack b) noexcept {return maskToPack(_mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ));}
+//pick a where the mask is set and b everywhere else
+inline Pack select(Pack mask, Pack a, Pack b) noexcept {
+    __m512i m = _mm512_castps_si512(mask.v);
+    return {_mm512_mask_blend_ps(_mm512_test_epi32_mask(m, m), b.v, a.v)};
+}
+//collect one bit per float of a mask, bit i is set if the mask of the ith float is set
+inline uint32_t moveMask(Pack mask) noexcept {
+    __m512i m = _mm512_castps_si512(mask.v);
+    return (uint32_t)_mm512_test_epi32_mask(m, m);
+}
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal floats (-126 to 127)
+ */
+inline Pack pow2(Pack k) noexcept 
+{return {_mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(_mm512_cvtps_epi32(k.v), _mm512_set1_epi32(127)), 23))};}
+
+/**
+ * @brief split positive normal floats into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the floats to split
+ * @param e the pack to write the exponents to
+ * @return Pack the mantissas
+ */
+inline Pack splitExponent(Pack a, Pack& e) noexcept {
+    __m512i i = _mm512_castps_si512(a.v);
+    e.v = _mm512_cvtepi32_ps(_mm512_sub_epi32(_mm512_srli_epi32(i, 23), _mm512_set1_epi32(127)));
+    return {_mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(i, _mm512_set1_epi32(0x007fffff)), _mm512_set1_epi32(0x3f800000)))};
+}
+
+/**
+ * @brief write a pack using non-temporal stores, the location must be aligned to 16 bytes
+ */
+inline void stream(float* p, Pack a) noexcept {
+    _mm_stream_ps(p,      _mm512_extractf32x4_ps(a.v, 0));
+    _mm_stream_ps(p + 4,  _mm512_extractf32x4_ps(a.v, 1));
+    _mm_stream_ps(p + 8,  _mm512_extractf32x4_ps(a.v, 2));
+    _mm_stream_ps(p + 12, _mm512_extractf32x4_ps(a.v, 3));
+}
+
+/**
+ * @brief pick the floats (a[A], a[B], b[C], b[D]) in every group of 4 floats (128 bit lane)
+ */
+template <int A, int B, int C, int D> inline Pack shuffle(Pack a, Pack b) noexcept 
+{return {_mm512_shuffle_ps(a.v, b.v, _MM_SHUFFLE(D, C, B, A))};}
+inline Pack setQuads(float x, float y, float z, float w) noexcept {return {_mm512_setr4_ps(x, y, z, w)};}
+
+/**
+ * @brief load 4 groups of 4 floats into the 128 bit lanes of a pack
+ * 
+ * @param p a pointer to the first group
+ * @param stride the distance between two groups in floats
+ */
+inline Pack loadQuads(const float* p, size_t stride) noexcept {
+    __m512 r = _mm512_castps128_ps512(_mm_loadu_ps(p));
+    r = _mm512_insertf32x4(r, _mm_loadu_ps(p + stride), 1);
+    r = _mm512_insertf32x4(r, _mm_loadu_ps(p + 2*stride), 2);
+    return {_mm512_insertf32x4(r, _mm_loadu_ps(p + 3*stride), 3)};
+}
+
+/**
+ * @brief store the 128 bit lanes of a pack as 4 groups of 4 floats
+ * 
+ * @param p a pointer to write the first group to
+ * @param stride the distance between two groups in floats
+ * @param a the pack to store
+ */
+inline void storeQuads(float* p, size_t stride, Pack a) noexcept {
+    _mm_storeu_ps(p, _mm512_castps512_ps128(a.v));
+    _mm_storeu_ps(p + stride, _mm512_extractf32x4_ps(a.v, 1));
+    _mm_storeu_ps(p + 2*stride, _mm512_extractf32x4_ps(a.v, 2));
+    _mm_storeu_ps(p + 3*stride, _mm512_extractf32x4_ps(a.v, 3));
+}
+
+/**
+ * @brief load 4 groups of 4 floats from independent locations into the 128 bit lanes of a pack
+ * 
+ * @param p the pointers to the groups, one per lane
+ */
+inline Pack gatherQuads(const float* const* p) noexcept {
+    __m512 r = _mm512_castps128_ps512(_mm_loadu_ps(p[0]));
+    r = _mm512_insertf32x4(r, _mm_loadu_ps(p[1]), 1);
+    r = _mm512_insertf32x4(r, _mm_loadu_ps(p[2]), 2);
+    return {_mm512_insertf32x4(r, _mm_loadu_ps(p[3]), 3)};
+}
+
+/**
+ * @brief pick 16 floats out of up to 4 registers (64 floats)
+ * 
+ * @param src the registers to pick from
+ * @param idx the index of the float for every lane (0 - 63)
+ * @return __m512 the picked floats
+ */
+template <size_t Count> inline __m512 gather(const __m512* src, __m512i idx) noexcept {
+    //the permutation uses the lower 5 bits of the index, so it picks from a pair of registers
+    __m512 r = _mm512_permutex2var_ps(src[0], idx, src[(Count > 1) ? 1 : 0]);
+    if (Count > 2) {
+        __m512 h = _mm512_permutex2var_ps(src[2], idx, src[(Count > 3) ? 3 : 2]);
+        r = _mm512_mask_mov_ps(r, _mm512_cmpge_epi32_mask(idx, _mm512_set1_epi32(32)), h);
+    }
+    return r;
+}
+
+/**
+ * @brief load 16 interleaved vectors with N axis and split them into one pack per axis
+ */
+template <size_t N> inline void loadInterleavedN(const float* p, Pack* out) noexcept {
+    __m512 src[N];
+    for (size_t k = 0; k < N; ++k) {src[k] = _mm512_loadu_ps(p + 16*k);}
+    //lane i of axis c is the float N*i + c
+    __m512i iota = _mm512_setr_epi32(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    __m512i base = _mm512_mullo_epi32(iota, _mm512_set1_epi32((int)N));
+    for (size_t c = 0; c < N; ++c) 
+    {out[c].v = gather<N>(src, _mm512_add_epi32(base, _mm512_set1_epi32((int)c)));}
+}
+
+/**
+ * @brief store one pack per axis as 16 interleaved vectors with N axis
+ */
+template <size_t N> inline void storeInterleavedN(float* p, const Pack* in) noexcept {
+    __m512 src[N];
+    for (size_t k = 0; k < N; ++k) {src[k] = in[k].v;}
+    for (size_t k = 0; k < N; ++k) {
+        //the float f of the output belongs to the vector f / N and the axis f % N
+        alignas(64) int idx[16];
+        for (int j = 0; j < 16; ++j) {
+            int f = (int)(16*k) + j;
+            idx[j] = (f % (int)N) * 16 + f / (int)N;
+        }
+        _mm512_storeu_ps(p + 16*k, gather<N>(src, _mm512_load_si512(idx)));
+    }
+}
+
+inline void loadInterleaved(const float* p, Pack& x, Pack& y) noexcept 
+{Pack r[2]; loadInterleavedN<2>(p, r); x = r[0]; y = r[1];}
+inline void storeInterleaved(float* p, Pack x, Pack y) noexcept 
+{Pack r[2] = {x, y}; storeInterleavedN<2>(p, r);}
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z) noexcept 
+{Pack r[3]; loadInterleavedN<3>(p, r); x = r[0]; y = r[1]; z = r[2];}
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z) noexcept 
+{Pack r[3] = {x, y, z}; storeInterleavedN<3>(p, r);}
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z, Pack& w) noexcept 
+{Pack r[4]; loadInterleavedN<4>(p, r); x = r[0]; y = r[1]; z = r[2]; w = r[3];}
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z, Pack w) noexcept 
+{Pack r[4] = {x, y, z, w}; storeInterleavedN<4>(p, r);}
+
+//else, check for AVX2 to use 8 floats per pack
+#elif GLGE_KERNEL_LEVEL == 3
+
+/**
+ * @brief store 8 floats in an AVX register
+ */
+struct Pack {
+    //the register holding the floats
+    __m256 v;
+    //the amount of floats in a single pack
+    static const size_t Width = 8;
+};
+
+/**
+ * @brief load two groups of 4 floats into the lower and upper 128 bit lane of a register
+ * 
+ * @param lo a pointer to the floats for the lower lane
+ * @param hi a pointer to the floats for the upper lane
+ * @return __m256 the register holding both groups
+ */
+inline __m256 loadLanes(const float* lo, const float* hi) noexcept
+{return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);}
+
+/**
+ * @brief store the lower and upper 128 bit lane of a register to two different locations
+ * 
+ * @param lo a pointer to write the lower lane to
+ * @param hi a pointer to write the upper lane to
+ * @param r the register to store
+ */
+inline void storeLanes(float* lo, float* hi, __m256 r) noexcept {
+    _mm_storeu_ps(lo, _mm256_castps256_ps128(r));
+    _mm_storeu_ps(hi, _mm256_extractf128_ps(r, 1));
+}
+
+inline Pack load(const float* p) noexcept {return {_mm256_load_ps(p)};}
+inline Pack loadu(const float* p) noexcept {return {_mm256_loadu_ps(p)};}
+inline void store(float* p, Pack a) noexcept {_mm256_store_ps(p, a.v);}
+inline void storeu(float* p, Pack a) noexcept {_mm256_storeu_ps(p, a.v);}
+inline Pack set1(float f) noexcept {return {_mm256_set1_ps(f)};}
+inline Pack operator+(Pack a, Pack b) noexcept {return {_mm256_add_ps(a.v, b.v)};}
+inline Pack operator-(Pack a, Pack b) noexcept {return {_mm256_sub_ps(a.v, b.v)};}
+inline Pack operator*(Pack a, Pack b) noexcept {return {_mm256_mul_ps(a.v, b.v)};}
+inline Pack operator/(Pack a, Pack b) noexcept {return {_mm256_div_ps(a.v, b.v)};}
+inline Pack fma(Pack a, Pack b, Pack c) noexcept {return {_mm256_fmadd_ps(a.v, b.v, c.v)};}
+inline Pack sqrt(Pack a) noexcept {return {_mm256_sqrt_ps(a.v)};}
+//approximate reciprocal square root, the relative error is at most 1.5 * 2^-12
+inline Pack rsqrt(Pack a) noexcept {return {_mm256_rsqrt_ps(a.v)};}
+inline Pack max(Pack a, Pack b) noexcept {return {_mm256_max_ps(a.v, b.v)};}
+inline Pack min(Pack a, Pack b) noexcept {return {_mm256_min_ps(a.v, b.v)};}
+inline Pack abs(Pack a) noexcept {return {_mm256_andnot_ps(_mm256_set1_ps(-0.f), a.v)};}
+//round to the nearest integer, ties to even
+inline Pack round(Pack a) noexcept {return {_mm256_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};}
+inline float first(Pack a) noexcept {return _mm256_cvtss_f32(a.v);}
+
+inline Pack bitAnd(Pack a, Pack b) noexcept {return {_mm256_and_ps(a.v, b.v)};}
+inline Pack bitOr(Pack a, Pack b) noexcept {return {_mm256_or_ps(a.v, b.v)};}
+inline Pack bitXor(Pack a, Pack b) noexcept {return {_mm256_xor_ps(a.v, b.v)};}
+inline Pack operator-(Pack a) noexcept {return bitXor(a, set1(-0.f));}
+
+//the comparisons result in a pack with all bits set where the comparison is true
+inline Pack lessThan(Pack a, Pack b) noexcept {return {_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};}
+inline Pack greaterThan(Pack a, Pack b) noexcept {return {_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};}
+inline Pack equal(Pack a, Pack b) noexcept {return {_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)};}
+//pick a where the mask is set and b everywhere else
+inline Pack select(Pack mask, Pack a, Pack b) noexcept {return {_mm256_blendv_ps(b.v, a.v, mask.v)};}
+//collect one bit per float of a mask, bit i is set if the mask of the ith float is set
+inline uint32_t moveMask(Pack mask) noexcept {return (uint32_t)_mm256_movemask_ps(mask.v);}
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal floats (-126 to 127)
+ */
+inline Pack pow2(Pack k) noexcept 
+{return {_mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_cvtps_epi32(k.v), _mm256_set1_epi32(127)), 23))};}
+
+/**
+ * @brief split positive normal floats into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the floats to split
+ * @param e the pack to write the exponents to
+ * @return Pack the mantissas
+ */
+inline Pack splitExponent(Pack a, Pack& e) noexcept {
+    __m256i i = _mm256_castps_si256(a.v);
+    e.v = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(i, 23), _mm256_set1_epi32(127)));
+    return {_mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(i, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000)))};
+}
+
+/**
+ * @brief write a pack using non-temporal stores, the location must be aligned to 16 bytes
+ */
+inline void stream(float* p, Pack a) noexcept {
+    _mm_stream_ps(p, _mm256_castps256_ps128(a.v));
+    _mm_stream_ps(p + 4, _mm256_extractf128_ps(a.v, 1));
+}
+
+/**
+ * @brief pick the floats (a[A], a[B], b[C], b[D]) in every group of 4 floats (128 bit lane)
+ */
+template <int A, int B, int C, int D> inline Pack shuffle(Pack a, Pack b) noexcept 
+{return {_mm256_shuffle_ps(a.v, b.v, _MM_SHUFFLE(D, C, B, A))};}
+inline Pack setQuads(float x, float y, float z, float w) noexcept {return {_mm256_setr_ps(x, y, z, w, x, y, z, w)};}
+//load and store 2 groups of 4 floats that are stride floats apart
+inline Pack loadQuads(const float* p, size_t stride) noexcept {return {loadLanes(p, p + stride)};}
+inline void storeQuads(float* p, size_t stride, Pack a) noexcept {storeLanes(p, p + stride, a.v);}
+//load 2 groups of 4 floats from independent locations, one per lane
+inline Pack gatherQuads(const float* const* p) noexcept {return {loadLanes(p[0], p[1])};}
+
+/**
+ * @brief load 8 interleaved 2D vectors (x0 y0 x1 y1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y) noexcept {
+    //the upper lanes hold the vectors 4 to 7
+    __m256 a = loadLanes(p, p + 8);
+    __m256 b = loadLanes(p + 4, p + 12);
+    x.v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+    y.v = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+}
+
+/**
+ * @brief store one pack per axis as 8 interleaved 2D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y) noexcept {
+    storeLanes(p, p + 8, _mm256_unpacklo_ps(x.v, y.v));
+    storeLanes(p + 4, p + 12, _mm256_unpackhi_ps(x.v, y.v));
+}
+
+/**
+ * @brief load 8 interleaved 3D vectors (x0 y0 z0 x1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z) noexcept {
+    //per lane: a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3, the upper lanes hold the vectors 4 to 7
+    __m256 a = loadLanes(p, p + 12);
+    __m256 b = loadLanes(p + 4, p + 16);
+    __m256 c = loadLanes(p + 8, p + 20);
+    x.v = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1,1,2,2)), _MM_SHUFFLE(2,0,3,0));
+    y.v = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0,0,1,1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2,2,3,3)), _MM_SHUFFLE(2,0,2,0));
+    z.v = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1,1,2,2)), c, _MM_SHUFFLE(3,0,2,0));
+}
+
+/**
+ * @brief store one pack per axis as 8 interleaved 3D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z) noexcept {
+    __m256 a = _mm256_shuffle_ps(_mm256_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0,0,0,0)), _mm256_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1,1,0,0)), _MM_SHUFFLE(2,0,2,0));
+    __m256 b = _mm256_shuffle_ps(_mm256_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1,1,1,1)), _mm256_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2,2,2,2)), _MM_SHUFFLE(2,0,2,0));
+    __m256 c = _mm256_shuffle_ps(_mm256_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3,3,2,2)), _mm256_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(2,0,2,0));
+    storeLanes(p, p + 12, a);
+    storeLanes(p + 4, p + 16, b);
+    storeLanes(p + 8, p + 20, c);
+}
+
+/**
+ * @brief transpose 4x4 floats in both 128 bit lanes
+ */
+inline void transposeLanes(__m256& a, __m256& b, __m256& c, __m256& d) noexcept {
+    __m256 t0 = _mm256_unpacklo_ps(a, b);
+    __m256 t1 = _mm256_unpacklo_ps(c, d);
+    __m256 t2 = _mm256_unpackhi_ps(a, b);
+    __m256 t3 = _mm256_unpackhi_ps(c, d);
+    a = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(1,0,1,0));
+    b = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3,2,3,2));
+    c = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(1,0,1,0));
+    d = _mm256_shuffle_ps(t2, t3, _MM_SHUFFLE(3,2,3,2));
+}
+
+/**
+ * @brief load 8 interleaved 4D vectors (x0 y0 z0 w0 x1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z, Pack& w) noexcept {
+    //the lanes hold the vectors 0 and 4, 1 and 5, 2 and 6 and 3 and 7
+    x.v = loadLanes(p, p + 16);
+    y.v = loadLanes(p + 4, p + 20);
+    z.v = loadLanes(p + 8, p + 24);
+    w.v = loadLanes(p + 12, p + 28);
+    transposeLanes(x.v, y.v, z.v, w.v);
+}
+
+/**
+ * @brief store one pack per axis as 8 interleaved 4D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z, Pack w) noexcept {
+    transposeLanes(x.v, y.v, z.v, w.v);
+    storeLanes(p, p + 16, x.v);
+    storeLanes(p + 4, p + 20, y.v);
+    storeLanes(p + 8, p + 24, z.v);
+    storeLanes(p + 12, p + 28, w.v);
+}
+
+//else, check for SSE to use 4 floats per pack
+#elif GLGE_KERNEL_LEVEL >= 1
+
+/**
+ * @brief store 4 floats in an SSE register
+ */
+struct Pack {
+    //the register holding the floats
+    __m128 v;
+    //the amount of floats in a single pack
+    static const size_t Width = 4;
+};
+
+inline Pack load(const float* p) noexcept {return {_mm_load_ps(p)};}
+inline Pack loadu(const float* p) noexcept {return {_mm_loadu_ps(p)};}
+inline void store(float* p, Pack a) noexcept {_mm_store_ps(p, a.v);}
+inline void storeu(float* p, Pack a) noexcept {_mm_storeu_ps(p, a.v);}
+inline Pack set1(float f) noexcept {return {_mm_set1_ps(f)};}
+inline Pack operator+(Pack a, Pack b) noexcept {return {_mm_add_ps(a.v, b.v)};}
+inline Pack operator-(Pack a, Pack b) noexcept {return {_mm_sub_ps(a.v, b.v)};}
+inline Pack operator*(Pack a, Pack b) noexcept {return {_mm_mul_ps(a.v, b.v)};}
+inline Pack operator/(Pack a, Pack b) noexcept {return {_mm_div_ps(a.v, b.v)};}
+//SSE has no fused multiply-add, so this rounds twice
+inline Pack fma(Pack a, Pack b, Pack c) noexcept {return {_mm_add_ps(_mm_mul_ps(a.v, b.v), c.v)};}
+inline Pack sqrt(Pack a) noexcept {return {_mm_sqrt_ps(a.v)};}
+//approximate reciprocal square root, the relative error is at most 1.5 * 2^-12
+inline Pack rsqrt(Pack a) noexcept {return {_mm_rsqrt_ps(a.v)};}
+inline Pack max(Pack a, Pack b) noexcept {return {_mm_max_ps(a.v, b.v)};}
+inline Pack min(Pack a, Pack b) noexcept {return {_mm_min_ps(a.v, b.v)};}
+inline Pack abs(Pack a) noexcept {return {_mm_andnot_ps(_mm_set1_ps(-0.f), a.v)};}
+inline float first(Pack a) noexcept {return _mm_cvtss_f32(a.v);}
+
+inline Pack bitAnd(Pack a, Pack b) noexcept {return {_mm_and_ps(a.v, b.v)};}
+inline Pack bitOr(Pack a, Pack b) noexcept {return {_mm_or_ps(a.v, b.v)};}
+inline Pack bitXor(Pack a, Pack b) noexcept {return {_mm_xor_ps(a.v, b.v)};}
+inline Pack operator-(Pack a) noexcept {return bitXor(a, set1(-0.f));}
+
+//the comparisons result in a pack with all bits set where the comparison is true
+inline Pack lessThan(Pack a, Pack b) noexcept {return {_mm_cmplt_ps(a.v, b.v)};}
+inline Pack greaterThan(Pack a, Pack b) noexcept {return {_mm_cmpgt_ps(a.v, b.v)};}
+inline Pack equal(Pack a, Pack b) noexcept {return {_mm_cmpeq_ps(a.v, b.v)};}
+//collect one bit per float of a mask, bit i is set if the mask of the ith float is set
+inline uint32_t moveMask(Pack mask) noexcept {return (uint32_t)_mm_movemask_ps(mask.v);}
+
+//SSE4.1 can blend and round directly
+#if GLGE_KERNEL_LEVEL >= 2
+//pick a where the mask is set and b everywhere else
+inline Pack select(Pack mask, Pack a, Pack b) noexcept {return {_mm_blendv_ps(b.v, a.v, mask.v)};}
+//round to the nearest integer, ties to even
+inline Pack round(Pack a) noexcept {return {_mm_round_ps(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};}
+#else
+//pick a where the mask is set and b everywhere else
+inline Pack select(Pack mask, Pack a, Pack b) noexcept {return {_mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v))};}
+//round to the nearest integer, ties to even. Adding and subtracting 2^23 drops the fraction, larger floats are integers already
+inline Pack round(Pack a) noexcept {
+    __m128 sign = _mm_and_ps(a.v, _mm_set1_ps(-0.f));
+    __m128 magic = _mm_or_ps(sign, _mm_set1_ps(8388608.f));
+    //keep the sign for results of 0
+    __m128 r = _mm_or_ps(_mm_sub_ps(_mm_add_ps(a.v, magic), magic), sign);
+    return select(lessThan(abs(a), set1(8388608.f)), {r}, a);
+}
+#endif
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal floats (-126 to 127)
+ */
+inline Pack pow2(Pack k) noexcept 
+{return {_mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_cvtps_epi32(k.v), _mm_set1_epi32(127)), 23))};}
+
+/**
+ * @brief split positive normal floats into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the floats to split
+ * @param e the pack to write the exponents to
+ * @return Pack the mantissas
+ */
+inline Pack splitExponent(Pack a, Pack& e) noexcept {
+    __m128i i = _mm_castps_si128(a.v);
+    e.v = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(i, 23), _mm_set1_epi32(127)));
+    return {_mm_castsi128_ps(_mm_or_si128(_mm_and_si128(i, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)))};
+}
+
+/**
+ * @brief write a pack using a non-temporal store, the location must be aligned to 16 bytes
+ */
+inline void stream(float* p, Pack a) noexcept {_mm_stream_ps(p, a.v);}
+
+/**
+ * @brief pick the floats (a[A], a[B], b[C], b[D])
+ */
+template <int A, int B, int C, int D> inline Pack shuffle(Pack a, Pack b) noexcept 
+{return {_mm_shuffle_ps(a.v, b.v, _MM_SHUFFLE(D, C, B, A))};}
+inline Pack setQuads(float x, float y, float z, float w) noexcept {return {_mm_setr_ps(x, y, z, w)};}
+//a pack is a single group of 4 floats, so the stride is not used
+inline Pack loadQuads(const float* p, size_t) noexcept {return {_mm_loadu_ps(p)};}
+inline void storeQuads(float* p, size_t, Pack a) noexcept {_mm_storeu_ps(p, a.v);}
+inline Pack gatherQuads(const float* const* p) noexcept {return {_mm_loadu_ps(p[0])};}
+
+/**
+ * @brief load 4 interleaved 2D vectors (x0 y0 x1 y1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y) noexcept {
+    __m128 a = _mm_loadu_ps(p);
+    __m128 b = _mm_loadu_ps(p + 4);
+    x.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0));
+    y.v = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1));
+}
+
+/**
+ * @brief store one pack per axis as 4 interleaved 2D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y) noexcept {
+    _mm_storeu_ps(p, _mm_unpacklo_ps(x.v, y.v));
+    _mm_storeu_ps(p + 4, _mm_unpackhi_ps(x.v, y.v));
+}
+
+/**
+ * @brief load 4 interleaved 3D vectors (x0 y0 z0 x1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z) noexcept {
+    //a = x0 y0 z0 x1, b = y1 z1 x2 y2, c = z2 x3 y3 z3
+    __m128 a = _mm_loadu_ps(p);
+    __m128 b = _mm_loadu_ps(p + 4);
+    __m128 c = _mm_loadu_ps(p + 8);
+    x.v = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1,1,2,2)), _MM_SHUFFLE(2,0,3,0));
+    y.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0,0,1,1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2,2,3,3)), _MM_SHUFFLE(2,0,2,0));
+    z.v = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1,1,2,2)), c, _MM_SHUFFLE(3,0,2,0));
+}
+
+/**
+ * @brief store one pack per axis as 4 interleaved 3D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z) noexcept {
+    _mm_storeu_ps(p,     _mm_shuffle_ps(_mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(0,0,0,0)), _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1,1,0,0)), _MM_SHUFFLE(2,0,2,0)));
+    _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1,1,1,1)), _mm_shuffle_ps(x.v, y.v, _MM_SHUFFLE(2,2,2,2)), _MM_SHUFFLE(2,0,2,0)));
+    _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(3,3,2,2)), _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(3,3,3,3)), _MM_SHUFFLE(2,0,2,0)));
+}
+
+/**
+ * @brief load 4 interleaved 4D vectors (x0 y0 z0 w0 x1 ...) and split them into one pack per axis
+ */
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z, Pack& w) noexcept {
+    x.v = _mm_loadu_ps(p);
+    y.v = _mm_loadu_ps(p + 4);
+    z.v = _mm_loadu_ps(p + 8);
+    w.v = _mm_loadu_ps(p + 12);
+    _MM_TRANSPOSE4_PS(x.v, y.v, z.v, w.v);
+}
+
+/**
+ * @brief store one pack per axis as 4 interleaved 4D vectors
+ */
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z, Pack w) noexcept {
+    _MM_TRANSPOSE4_PS(x.v, y.v, z.v, w.v);
+    _mm_storeu_ps(p, x.v);
+    _mm_storeu_ps(p + 4, y.v);
+    _mm_storeu_ps(p + 8, z.v);
+    _mm_storeu_ps(p + 12, w.v);
+}
+
+//else, use a single float per pack
+#else
+
+/**
+ * @brief store a single float, used if SIMD is disabled
+ */
+struct Pack {
+    //the stored float
+    float v;
+    //the amount of floats in a single pack
+    static const size_t Width = 1;
+};
+
+inline Pack load(const float* p) noexcept {return {*p};}
+inline Pack loadu(const float* p) noexcept {return {*p};}
+inline void store(float* p, Pack a) noexcept {*p = a.v;}
+inline void storeu(float* p, Pack a) noexcept {*p = a.v;}
+inline Pack set1(float f) noexcept {return {f};}
+inline Pack operator+(Pack a, Pack b) noexcept {return {a.v + b.v};}
+inline Pack operator-(Pack a, Pack b) noexcept {return {a.v - b.v};}
+inline Pack operator*(Pack a, Pack b) noexcept {return {a.v * b.v};}
+inline Pack operator/(Pack a, Pack b) noexcept {return {a.v / b.v};}
+inline Pack fma(Pack a, Pack b, Pack c) noexcept {return {a.v * b.v + c.v};}
+inline Pack sqrt(Pack a) noexcept {return {sqrtf(a.v)};}
+//there is no approximation without SIMD, so the reciprocal square root is computed exactly
+inline Pack rsqrt(Pack a) noexcept {return {1.f / sqrtf(a.v)};}
+inline Pack max(Pack a, Pack b) noexcept {return {(a.v > b.v) ? a.v : b.v};}
+inline Pack min(Pack a, Pack b) noexcept {return {(a.v < b.v) ? a.v : b.v};}
+inline Pack abs(Pack a) noexcept {return {fabsf(a.v)};}
+//round to the nearest integer, ties to even
+inline Pack round(Pack a) noexcept {return {nearbyintf(a.v)};}
+inline float first(Pack a) noexcept {return a.v;}
+inline Pack operator-(Pack a) noexcept {return {-a.v};}
+
+//access the bits of a float
+inline uint32_t bitsOf(float f) noexcept {uint32_t u; memcpy(&u, &f, sizeof(u)); return u;}
+inline float floatOf(uint32_t u) noexcept {float f; memcpy(&f, &u, sizeof(f)); return f;}
+
+inline Pack bitAnd(Pack a, Pack b) noexcept {return {floatOf(bitsOf(a.v) & bitsOf(b.v))};}
+inline Pack bitOr(Pack a, Pack b) noexcept {return {floatOf(bitsOf(a.v) | bitsOf(b.v))};}
+inline Pack bitXor(Pack a, Pack b) noexcept {return {floatOf(bitsOf(a.v) ^ bitsOf(b.v))};}
+
+//the comparisons result in a float with all bits set if the comparison is true, like the masks of SIMD
+inline Pack lessThan(Pack a, Pack b) noexcept {return {floatOf((a.v < b.v) ? 0xffffffffu : 0u)};}
+inline Pack greaterThan(Pack a, Pack b) noexcept {return {floatOf((a.v > b.v) ? 0xffffffffu : 0u)};}
+inline Pack equal(Pack a, Pack b) noexcept {return {floatOf((a.v == b.v) ? 0xffffffffu : 0u)};}
+//pick a if the mask is set and b else
+inline Pack select(Pack mask, Pack a, Pack b) noexcept {return bitsOf(mask.v) ? a : b;}
+//convert the mask to a single bit
+inline uint32_t moveMask(Pack mask) noexcept {return bitsOf(mask.v) >> 31;}
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal floats (-126 to 127)
+ */
+inline Pack pow2(Pack k) noexcept {return {floatOf((uint32_t)((int32_t)k.v + 127) << 23)};}
+
+/**
+ * @brief split a positive normal float into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the float to split
+ * @param e the pack to write the exponent to
+ * @return Pack the mantissa
+ */
+inline Pack splitExponent(Pack a, Pack& e) noexcept {
+    uint32_t i = bitsOf(a.v);
+    e.v = (float)((int32_t)(i >> 23) - 127);
+    return {floatOf((i & 0x007fffffu) | 0x3f800000u)};
+}
+//without SIMD there are no non-temporal stores
+inline void stream(float* p, Pack a) noexcept {*p = a.v;}
+
+inline void loadInterleaved(const float* p, Pack& x, Pack& y) noexcept {x.v = p[0]; y.v = p[1];}
+inline void storeInterleaved(float* p, Pack x, Pack y) noexcept {p[0] = x.v; p[1] = y.v;}
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z) noexcept {x.v = p[0]; y.v = p[1]; z.v = p[2];}
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z) noexcept {p[0] = x.v; p[1] = y.v; p[2] = z.v;}
+inline void loadInterleaved(const float* p, Pack& x, Pack& y, Pack& z, Pack& w) noexcept {x.v = p[0]; y.v = p[1]; z.v = p[2]; w.v = p[3];}
+inline void storeInterleaved(float* p, Pack x, Pack y, Pack z, Pack w) noexcept {p[0] = x.v; p[1] = y.v; p[2] = z.v; p[3] = w.v;}
+
+/**
+ * @brief store a group of 4 floats for the kernels that shuffle floats within groups of 4, used if SIMD is disabled
+ */
+struct Quad {
+    //the stored floats
+    float v[4];
+    //the amount of floats in a single quad
+    static const size_t Width = 4;
+};
+
+inline Quad operator+(const Quad& a, const Quad& b) noexcept {return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}};}
+inline Quad operator-(const Quad& a, const Quad& b) noexcept {return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}};}
+inline Quad operator*(const Quad& a, const Quad& b) noexcept {return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};}
+inline Quad operator/(const Quad& a, const Quad& b) noexcept {return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}};}
+template <int A, int B, int C, int D> inline Quad shuffle(const Quad& a, const Quad& b) noexcept {return {{a.v[A], a.v[B], b.v[C], b.v[D]}};}
+inline Quad setQuads(float x, float y, float z, float w) noexcept {return {{x, y, z, w}};}
+inline Quad loadQuads(const float* p, size_t) noexcept {return {{p[0], p[1], p[2], p[3]}};}
+inline void storeQuads(float* p, size_t, const Quad& a) noexcept {p[0] = a.v[0]; p[1] = a.v[1]; p[2] = a.v[2]; p[3] = a.v[3];}
+
+#endif
+
+#if GLGE_KERNEL_LEVEL >= 1
+//with SIMD every 128 bit lane of a pack is a group of 4 floats
+typedef Pack Quad;
+#endif
+
+//check for AVX2 to use 4 doubles per pack. A 4x4 double matrix fills exactly one 256 bit register per row, so AVX-512 uses them as well
+#if GLGE_KERNEL_LEVEL >= 3
+
+/**
+ * @brief store 4 doubles in an AVX register
+ */
+struct DPack {
+    //the register holding the doubles
+    __m256d v;
+    //the amount of doubles in a single pack
+    static const size_t Width = 4;
+};
+
+inline DPack set1(double d) noexcept {return {_mm256_set1_pd(d)};}
+inline DPack operator+(DPack a, DPack b) noexcept {return {_mm256_add_pd(a.v, b.v)};}
+inline DPack operator-(DPack a, DPack b) noexcept {return {_mm256_sub_pd(a.v, b.v)};}
+inline DPack operator*(DPack a, DPack b) noexcept {return {_mm256_mul_pd(a.v, b.v)};}
+inline DPack operator/(DPack a, DPack b) noexcept {return {_mm256_div_pd(a.v, b.v)};}
+inline DPack operator-(DPack a) noexcept {return {_mm256_xor_pd(a.v, _mm256_set1_pd(-0.))};}
+inline DPack fma(DPack a, DPack b, DPack c) noexcept {return {_mm256_fmadd_pd(a.v, b.v, c.v)};}
+inline DPack sqrt(DPack a) noexcept {return {_mm256_sqrt_pd(a.v)};}
+inline DPack loadu(const double* p) noexcept {return {_mm256_loadu_pd(p)};}
+inline void storeu(double* p, DPack a) noexcept {_mm256_storeu_pd(p, a.v);}
+inline DPack min(DPack a, DPack b) noexcept {return {_mm256_min_pd(a.v, b.v)};}
+inline DPack max(DPack a, DPack b) noexcept {return {_mm256_max_pd(a.v, b.v)};}
+inline DPack abs(DPack a) noexcept {return {_mm256_andnot_pd(_mm256_set1_pd(-0.), a.v)};}
+//round to the nearest integer, ties to even
+inline DPack round(DPack a) noexcept {return {_mm256_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};}
+inline double first(DPack a) noexcept {return _mm256_cvtsd_f64(a.v);}
+
+inline DPack bitAnd(DPack a, DPack b) noexcept {return {_mm256_and_pd(a.v, b.v)};}
+inline DPack bitOr(DPack a, DPack b) noexcept {return {_mm256_or_pd(a.v, b.v)};}
+inline DPack bitXor(DPack a, DPack b) noexcept {return {_mm256_xor_pd(a.v, b.v)};}
+
+//the comparisons result in a pack with all bits set where the comparison is true
+inline DPack lessThan(DPack a, DPack b) noexcept {return {_mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ)};}
+inline DPack greaterThan(DPack a, DPack b) noexcept {return {_mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ)};}
+inline DPack equal(DPack a, DPack b) noexcept {return {_mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ)};}
+//pick a where the mask is set and b everywhere else
+inline DPack select(DPack mask, DPack a, DPack b) noexcept {return {_mm256_blendv_pd(b.v, a.v, mask.v)};}
+//collect one bit per double of a mask, bit i is set if the mask of the ith double is set
+inline uint32_t moveMask(DPack mask) noexcept {return (uint32_t)_mm256_movemask_pd(mask.v);}
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal doubles (-1022 to 1023)
+ */
+inline DPack pow2(DPack k) noexcept {
+    __m256i i = _mm256_cvtepi32_epi64(_mm256_cvtpd_epi32(k.v));
+    return {_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(i, _mm256_set1_epi64x(1023)), 52))};
+}
+
+/**
+ * @brief split positive normal doubles into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the doubles to split
+ * @param e the pack to write the exponents to
+ * @return DPack the mantissas
+ */
+inline DPack splitExponent(DPack a, DPack& e) noexcept {
+    __m256i i = _mm256_castpd_si256(a.v);
+    //there is no conversion from 64 bit integers, so the biased exponent is placed in the mantissa of 2^52
+    __m256d biased = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(i, 52), _mm256_set1_epi64x(0x4330000000000000ll)));
+    e.v = _mm256_sub_pd(biased, _mm256_set1_pd(4503599627371519.));
+    return {_mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(i, _mm256_set1_epi64x(0x000fffffffffffffll)), _mm256_set1_epi64x(0x3ff0000000000000ll)))};
+}
+
+/**
+ * @brief store a single row of a 4x4 double matrix in an AVX register
+ */
+struct DQuad {
+    //the register holding the row
+    __m256d v;
+};
+
+inline DQuad loadDQuad(const double* p) noexcept {return {_mm256_loadu_pd(p)};}
+inline void storeDQuad(double* p, DQuad a) noexcept {_mm256_storeu_pd(p, a.v);}
+inline DQuad broadcastDQuad(const double* p) noexcept {return {_mm256_broadcast_sd(p)};}
+inline DQuad operator*(DQuad a, DQuad b) noexcept {return {_mm256_mul_pd(a.v, b.v)};}
+inline DQuad fma(DQuad a, DQuad b, DQuad c) noexcept {return {_mm256_fmadd_pd(a.v, b.v, c.v)};}
+
+/**
+ * @brief transpose 4 registers holding 4 doubles each
+ */
+inline void transposeDoubles(__m256d& a, __m256d& b, __m256d& c, __m256d& d) noexcept {
+    __m256d t0 = _mm256_unpacklo_pd(a, b);
+    __m256d t1 = _mm256_unpackhi_pd(a, b);
+    __m256d t2 = _mm256_unpacklo_pd(c, d);
+    __m256d t3 = _mm256_unpackhi_pd(c, d);
+    a = _mm256_permute2f128_pd(t0, t2, 0x20);
+    b = _mm256_permute2f128_pd(t1, t3, 0x20);
+    c = _mm256_permute2f128_pd(t0, t2, 0x31);
+    d = _mm256_permute2f128_pd(t1, t3, 0x31);
+}
+
+/**
+ * @brief load 4 groups of N (3 or 4) doubles and split them into one pack per element
+ * 
+ * @param p a pointer to the first group
+ * @param stride the distance between two groups in doubles
+ * @param out an array of at least N packs, pack k holds the element k of every group
+ */
+template <size_t N> inline void loadColumns(const double* p, size_t stride, DPack* out) noexcept {
+    //masked loads never touch the memory behind a group of 3 doubles
+    __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+    __m256d r[4];
+    for (size_t i = 0; i < 4; ++i) 
+    {r[i] = (N == 4) ? _mm256_loadu_pd(p + i*stride) : _mm256_maskload_pd(p + i*stride, mask);}
+    transposeDoubles(r[0], r[1], r[2], r[3]);
+    for (size_t k = 0; k < N; ++k) {out[k].v = r[k];}
+}
+
+/**
+ * @brief store one pack per element as 4 groups of N (3 or 4) doubles
+ * 
+ * @param p a pointer to write the first group to
+ * @param stride the distance between two groups in doubles
+ * @param in an array of at least N packs, pack k holds the element k of every group
+ */
+template <size_t N> inline void storeColumns(double* p, size_t stride, const DPack* in) noexcept {
+    __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+    __m256d r[4] = {in[0].v, in[1].v, in[2].v, (N == 4) ? in[3].v : _mm256_setzero_pd()};
+    transposeDoubles(r[0], r[1], r[2], r[3]);
+    for (size_t i = 0; i < 4; ++i) {
+        if (N == 4) {_mm256_storeu_pd(p + i*stride, r[i]);}
+        else {_mm256_maskstore_pd(p + i*stride, mask, r[i]);}
+    }
+}
+
+//else, check for SSE to use 2 doubles per pack
+#elif GLGE_KERNEL_LEVEL >= 1
+
+/**
+ * @brief store 2 doubles in an SSE register
+ */
+struct DPack {
+    //the register holding the doubles
+    __m128d v;
+    //the amount of doubles in a single pack
+    static const size_t Width = 2;
+};
+
+inline DPack set1(double d) noexcept {return {_mm_set1_pd(d)};}
+inline DPack operator+(DPack a, DPack b) noexcept {return {_mm_add_pd(a.v, b.v)};}
+inline DPack operator-(DPack a, DPack b) noexcept {return {_mm_sub_pd(a.v, b.v)};}
+inline DPack operator*(DPack a, DPack b) noexcept {return {_mm_mul_pd(a.v, b.v)};}
+inline DPack operator/(DPack a, DPack b) noexcept {return {_mm_div_pd(a.v, b.v)};}
+inline DPack operator-(DPack a) noexcept {return {_mm_xor_pd(a.v, _mm_set1_pd(-0.))};}
+//SSE has no fused multiply add
+inline DPack fma(DPack a, DPack b, DPack c) noexcept {return {_mm_add_pd(_mm_mul_pd(a.v, b.v), c.v)};}
+inline DPack sqrt(DPack a) noexcept {return {_mm_sqrt_pd(a.v)};}
+inline DPack loadu(const double* p) noexcept {return {_mm_loadu_pd(p)};}
+inline void storeu(double* p, DPack a) noexcept {_mm_storeu_pd(p, a.v);}
+inline DPack min(DPack a, DPack b) noexcept {return {_mm_min_pd(a.v, b.v)};}
+inline DPack max(DPack a, DPack b) noexcept {return {_mm_max_pd(a.v, b.v)};}
+inline DPack abs(DPack a) noexcept {return {_mm_andnot_pd(_mm_set1_pd(-0.), a.v)};}
+inline double first(DPack a) noexcept {return _mm_cvtsd_f64(a.v);}
+
+inline DPack bitAnd(DPack a, DPack b) noexcept {return {_mm_and_pd(a.v, b.v)};}
+inline DPack bitOr(DPack a, DPack b) noexcept {return {_mm_or_pd(a.v, b.v)};}
+inline DPack bitXor(DPack a, DPack b) noexcept {return {_mm_xor_pd(a.v, b.v)};}
+
+//the comparisons result in a pack with all bits set where the comparison is true
+inline DPack lessThan(DPack a, DPack b) noexcept {return {_mm_cmplt_pd(a.v, b.v)};}
+inline DPack greaterThan(DPack a, DPack b) noexcept {return {_mm_cmpgt_pd(a.v, b.v)};}
+inline DPack equal(DPack a, DPack b) noexcept {return {_mm_cmpeq_pd(a.v, b.v)};}
+//collect one bit per double of a mask, bit i is set if the mask of the ith double is set
+inline uint32_t moveMask(DPack mask) noexcept {return (uint32_t)_mm_movemask_pd(mask.v);}
+
+//SSE4.1 can blend and round directly
+#if GLGE_KERNEL_LEVEL >= 2
+//pick a where the mask is set and b everywhere else
+inline DPack select(DPack mask, DPack a, DPack b) noexcept {return {_mm_blendv_pd(b.v, a.v, mask.v)};}
+//round to the nearest integer, ties to even
+inline DPack round(DPack a) noexcept {return {_mm_round_pd(a.v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC)};}
+#else
+//pick a where the mask is set and b everywhere else
+inline DPack select(DPack mask, DPack a, DPack b) noexcept {return {_mm_or_pd(_mm_and_pd(mask.v, a.v), _mm_andnot_pd(mask.v, b.v))};}
+//round to the nearest integer, ties to even. Adding and subtracting 2^52 drops the fraction, larger doubles are integers already
+inline DPack round(DPack a) noexcept {
+    __m128d sign = _mm_and_pd(a.v, _mm_set1_pd(-0.));
+    __m128d magic = _mm_or_pd(sign, _mm_set1_pd(4503599627370496.));
+    //keep the sign for results of 0
+    __m128d r = _mm_or_pd(_mm_sub_pd(_mm_add_pd(a.v, magic), magic), sign);
+    return select(lessThan(abs(a), set1(4503599627370496.)), {r}, a);
+}
+#endif
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal doubles (-1022 to 1023)
+ */
+inline DPack pow2(DPack k) noexcept {
+    //the two 32 bit integers are moved to the lower halfs of the 64 bit lanes
+    __m128i i = _mm_add_epi32(_mm_cvtpd_epi32(k.v), _mm_set1_epi32(1023));
+    return {_mm_castsi128_pd(_mm_slli_epi64(_mm_unpacklo_epi32(i, _mm_setzero_si128()), 52))};
+}
+
+/**
+ * @brief split positive normal doubles into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the doubles to split
+ * @param e the pack to write the exponents to
+ * @return DPack the mantissas
+ */
+inline DPack splitExponent(DPack a, DPack& e) noexcept {
+    __m128i i = _mm_castpd_si128(a.v);
+    //there is no conversion from 64 bit integers, so the biased exponent is placed in the mantissa of 2^52
+    __m128d biased = _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(i, 52), _mm_set1_epi64x(0x4330000000000000ll)));
+    e.v = _mm_sub_pd(biased, _mm_set1_pd(4503599627371519.));
+    return {_mm_castsi128_pd(_mm_or_si128(_mm_and_si128(i, _mm_set1_epi64x(0x000fffffffffffffll)), _mm_set1_epi64x(0x3ff0000000000000ll)))};
+}
+
+/**
+ * @brief store a single row of a 4x4 double matrix in two SSE registers
+ */
+struct DQuad {
+    //the lower two doubles of the row
+    __m128d lo;
+    //the upper two doubles of the row
+    __m128d hi;
+};
+
+inline DQuad loadDQuad(const double* p) noexcept {return {_mm_loadu_pd(p), _mm_loadu_pd(p + 2)};}
+inline void storeDQuad(double* p, DQuad a) noexcept {_mm_storeu_pd(p, a.lo); _mm_storeu_pd(p + 2, a.hi);}
+inline DQuad broadcastDQuad(const double* p) noexcept {__m128d v = _mm_load1_pd(p); return {v, v};}
+inline DQuad operator*(DQuad a, DQuad b) noexcept {return {_mm_mul_pd(a.lo, b.lo), _mm_mul_pd(a.hi, b.hi)};}
+inline DQuad fma(DQuad a, DQuad b, DQuad c) noexcept 
+{return {_mm_add_pd(_mm_mul_pd(a.lo, b.lo), c.lo), _mm_add_pd(_mm_mul_pd(a.hi, b.hi), c.hi)};}
+
+/**
+ * @brief load 2 groups of N (3 or 4) doubles and split them into one pack per element
+ * 
+ * @param p a pointer to the first group
+ * @param stride the distance between two groups in doubles
+ * @param out an array of at least N packs, pack k holds the element k of every group
+ */
+template <size_t N> inline void loadColumns(const double* p, size_t stride, DPack* out) noexcept {
+    __m128d a = _mm_loadu_pd(p);
+    __m128d b = _mm_loadu_pd(p + stride);
+    out[0].v = _mm_unpacklo_pd(a, b);
+    out[1].v = _mm_unpackhi_pd(a, b);
+    if (N == 4) {
+        a = _mm_loadu_pd(p + 2);
+        b = _mm_loadu_pd(p + stride + 2);
+        out[2].v = _mm_unpacklo_pd(a, b);
+        out[3].v = _mm_unpackhi_pd(a, b);
+    } else 
+    {out[2].v = _mm_loadh_pd(_mm_load_sd(p + 2), p + stride + 2);}
+}
+
+/**
+ * @brief store one pack per element as 2 groups of N (3 or 4) doubles
+ * 
+ * @param p a pointer to write the first group to
+ * @param stride the distance between two groups in doubles
+ * @param in an array of at least N packs, pack k holds the element k of every group
+ */
+template <size_t N> inline void storeColumns(double* p, size_t stride, const DPack* in) noexcept {
+    _mm_storeu_pd(p, _mm_unpacklo_pd(in[0].v, in[1].v));
+    _mm_storeu_pd(p + stride, _mm_unpackhi_pd(in[0].v, in[1].v));
+    if (N == 4) {
+        _mm_storeu_pd(p + 2, _mm_unpacklo_pd(in[2].v, in[3].v));
+        _mm_storeu_pd(p + stride + 2, _mm_unpackhi_pd(in[2].v, in[3].v));
+    } else {
+        _mm_store_sd(p + 2, in[2].v);
+        _mm_storeh_pd(p + stride + 2, in[2].v);
+    }
+}
+
+//else, use a single double per pack
+#else
+
+/**
+ * @brief store a single double, used if SIMD is disabled
+ */
+struct DPack {
+    //the stored double
+    double v;
+    //the amount of doubles in a single pack
+    static const size_t Width = 1;
+};
+
+inline DPack set1(double d) noexcept {return {d};}
+inline DPack operator+(DPack a, DPack b) noexcept {return {a.v + b.v};}
+inline DPack operator-(DPack a, DPack b) noexcept {return {a.v - b.v};}
+inline DPack operator*(DPack a, DPack b) noexcept {return {a.v * b.v};}
+inline DPack operator/(DPack a, DPack b) noexcept {return {a.v / b.v};}
+inline DPack operator-(DPack a) noexcept {return {-a.v};}
+inline DPack fma(DPack a, DPack b, DPack c) noexcept {return {a.v * b.v + c.v};}
+inline DPack sqrt(DPack a) noexcept {return {std::sqrt(a.v)};}
+inline DPack loadu(const double* p) noexcept {return {*p};}
+inline void storeu(double* p, DPack a) noexcept {*p = a.v;}
+inline DPack min(DPack a, DPack b) noexcept {return {(a.v < b.v) ? a.v : b.v};}
+inline DPack max(DPack a, DPack b) noexcept {return {(a.v > b.v) ? a.v : b.v};}
+inline DPack abs(DPack a) noexcept {return {fabs(a.v)};}
+//round to the nearest integer, ties to even
+inline DPack round(DPack a) noexcept {return {nearbyint(a.v)};}
+inline double first(DPack a) noexcept {return a.v;}
+
+//access the bits of a double
+inline uint64_t bitsOf(double d) noexcept {uint64_t u; memcpy(&u, &d, sizeof(u)); return u;}
+inline double doubleOf(uint64_t u) noexcept {double d; memcpy(&d, &u, sizeof(d)); return d;}
+
+inline DPack bitAnd(DPack a, DPack b) noexcept {return {doubleOf(bitsOf(a.v) & bitsOf(b.v))};}
+inline DPack bitOr(DPack a, DPack b) noexcept {return {doubleOf(bitsOf(a.v) | bitsOf(b.v))};}
+inline DPack bitXor(DPack a, DPack b) noexcept {return {doubleOf(bitsOf(a.v) ^ bitsOf(b.v))};}
+
+//the comparisons result in a double with all bits set if the comparison is true, like the masks of SIMD
+inline DPack lessThan(DPack a, DPack b) noexcept {return {doubleOf((a.v < b.v) ? ~0ull : 0ull)};}
+inline DPack greaterThan(DPack a, DPack b) noexcept {return {doubleOf((a.v > b.v) ? ~0ull : 0ull)};}
+inline DPack equal(DPack a, DPack b) noexcept {return {doubleOf((a.v == b.v) ? ~0ull : 0ull)};}
+//pick a if the mask is set and b else
+inline DPack select(DPack mask, DPack a, DPack b) noexcept {return bitsOf(mask.v) ? a : b;}
+//convert the mask to a single bit
+inline uint32_t moveMask(DPack mask) noexcept {return (uint32_t)(bitsOf(mask.v) >> 63);}
+
+/**
+ * @brief compute 2^k for integer values k in the range of normal doubles (-1022 to 1023)
+ */
+inline DPack pow2(DPack k) noexcept {return {doubleOf((uint64_t)((int64_t)k.v + 1023) << 52)};}
+
+/**
+ * @brief split a positive normal double into a mantissa in [1, 2) and an exponent
+ * 
+ * @param a the double to split
+ * @param e the pack to write the exponent to
+ * @return DPack the mantissa
+ */
+inline DPack splitExponent(DPack a, DPack& e) noexcept {
+    uint64_t i = bitsOf(a.v);
+    e.v = (double)((int64_t)(i >> 52) - 1023);
+    return {doubleOf((i & 0x000fffffffffffffull) | 0x3ff0000000000000ull)};
+}
+
+/**
+ * @brief store a single row of a 4x4 double matrix, used if SIMD is disabled
+ */
+struct DQuad {
+    //the elements of the row
+    double v[4];
+};
+
+inline DQuad loadDQuad(const double* p) noexcept {return {{p[0], p[1], p[2], p[3]}};}
+inline void storeDQuad(double* p, DQuad a) noexcept {for (size_t i = 0; i < 4; ++i) {p[i] = a.v[i];}}
+inline DQuad broadcastDQuad(const double* p) noexcept {return {{*p, *p, *p, *p}};}
+inline DQuad operator*(DQuad a, DQuad b) noexcept 
+{return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}};}
+inline DQuad fma(DQuad a, DQuad b, DQuad c) noexcept 
+{return {{a.v[0] * b.v[0] + c.v[0], a.v[1] * b.v[1] + c.v[1], a.v[2] * b.v[2] + c.v[2], a.v[3] * b.v[3] + c.v[3]}};}
+
+template <size_t N> inline void loadColumns(const double* p, size_t, DPack* out) noexcept 
+{for (size_t k = 0; k < N; ++k) {out[k].v = p[k];}}
+template <size_t N> inline void storeColumns(double* p, size_t, const DPack* in) noexcept 
+{for (size_t k = 0; k < N; ++k) {p[k] = in[k].v;}}
+
+#endif
+
+/**
+ * @brief load Pack::Width interleaved vectors with N axis and split them into one pack per axis
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @param p a pointer to the interleaved floats
+ * @param r an array of at least N packs to write the axis to
+ */
+template <size_t N> inline void loadVectors(const float* p, Pack* r) noexcept {
+    if (N == 2) {loadInterleaved(p, r[0], r[1]);}
+    else if (N == 3) {loadInterleaved(p, r[0], r[1], r[2]);}
+    else {loadInterleaved(p, r[0], r[1], r[2], r[3]);}
+}
+
+/**
+ * @brief store one pack per axis as Pack::Width interleaved vectors with N axis
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @tparam Stream true : the vectors are written using non-temporal stores, p must be aligned to 16 bytes | false : normal stores are used
+ * @param p a pointer to write the interleaved floats to
+ * @param r an array of at least N packs holding the axis
+ */
+template <size_t N, bool Stream = false> inline void storeVectors(float* p, const Pack* r) noexcept {
+    //non-temporal stores need aligned data, so the vectors are interleaved into a temporary first
+    alignas(64) float tmp[Stream ? N*Pack::Width : 1];
+    float* dst = Stream ? tmp : p;
+    if (N == 2) {storeInterleaved(dst, r[0], r[1]);}
+    else if (N == 3) {storeInterleaved(dst, r[0], r[1], r[2]);}
+    else {storeInterleaved(dst, r[0], r[1], r[2], r[3]);}
+    if (Stream) {
+        for (size_t k = 0; k < N; ++k) 
+        {stream(p + k*Pack::Width, load(tmp + k*Pack::Width));}
+    }
+}
+
+/**
+ * @brief make all non-temporal stores visible to other threads
+ */
+inline void fence() noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    _mm_sfence();
+    #endif
+}
+
+};
+};
+};
+
+#endif
+
+#endif
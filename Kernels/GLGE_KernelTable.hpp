@@ -0,0 +1,168 @@
+/**
+ * @file GLGE_KernelTable.hpp
+ * @author DM8AT
+ * @brief define the table of batch kernels that is selected at runtime for the instruction set of the CPU
+ * 
+ * Every supported instruction set fills its own table (see GLGE_Kernels_*.cpp). GLGE_Dispatch.cpp selects one of them
+ * the first time a kernel is used.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_KERNEL_TABLE_
+#define _GLGE_KERNEL_TABLE_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the size type
+#include <stddef.h>
+//include the fixed size integers for the bone indices
+#include <stdint.h>
+
+namespace glge {
+namespace kernel
+{
+
+/**
+ * @brief the transcendental functions the math kernels can apply to arrays
+ */
+enum class MathFunction {
+    //the sine of the first argument
+    Sin,
+    //the cosine of the first argument
+    Cos,
+    //the tangent of the first argument
+    Tan,
+    //e to the power of the first argument
+    Exp,
+    //the natural logarithm of the first argument
+    Log,
+    //atan2 of the first (y) and the second (x) argument
+    Atan2,
+    //the first argument to the power of the second argument
+    Pow,
+    //the square root of the first argument
+    Sqrt
+};
+
+/**
+ * @brief store pointers to the batch kernels of a single instruction set
+ * 
+ * All kernels work on plain floats. The SoA kernels get one pointer per stream and the amount of streams,
+ * the streams must be aligned to and padded to GLGE_MATH_SOA_ALIGNMENT bytes
+ */
+struct KernelTable {
+
+    //transform 4D vectors by a matrix, optionally using non-temporal stores
+    void (*mat4Transform4)(const float* mat, const float* in, float* out, size_t n, bool stream);
+    //transform 3D points (w = 1) or directions (w = 0) by a matrix, optionally using non-temporal stores
+    void (*mat4Transform3)(const float* mat, const float* in, float* out, size_t n, bool points, bool stream);
+    //invert an array of matrices
+    void (*mat4Inverse)(const float* in, float* out, size_t n);
+    //compose two arrays of affine 3x4 matrices element by element
+    void (*affineMultiply)(const float* a, const float* b, float* out, size_t n);
+    //compose the affine 3x4 matrices of a that are selected by the indices with an array of affine 3x4 matrices
+    void (*affineMultiplyIndexed)(const float* a, const uint32_t* indices, const float* b, float* out, size_t n);
+    //invert an array of affine 3x4 matrices
+    void (*affineInverse)(const float* in, float* out, size_t n);
+
+    //compute the lengths of interleaved vectors with 2, 3 or 4 axis, optionally using the approximate reciprocal square root
+    void (*vecLength)(const float* in, float* out, size_t n, size_t axis, bool fast);
+    //normalize interleaved vectors with 2, 3 or 4 axis, optionally using the approximate reciprocal square root. If padded is
+    //true the last axis is a padding element that is 0 in the input and set to 0 in the output
+    void (*vecNormalize)(const float* in, float* out, size_t n, size_t axis, bool fast, bool padded);
+
+    //apply a transcendental function to an array of floats, b is only used by the functions with two arguments
+    void (*mathFloat)(MathFunction func, const float* a, const float* b, float* out, size_t n);
+    //compute the sines and cosines of an array of floats
+    void (*mathSinCos)(const float* in, float* s, float* c, size_t n);
+    //apply a transcendental function to an array of doubles, b is only used by the functions with two arguments
+    void (*mathDouble)(MathFunction func, const double* a, const double* b, double* out, size_t n);
+    //compute the sines and cosines of an array of doubles
+    void (*mathDSinCos)(const double* in, double* s, double* c, size_t n);
+
+    //multiply two arrays of double matrices element by element
+    void (*dmat4Multiply)(const double* a, const double* b, double* out, size_t n);
+    //transform 4D double vectors by a double matrix
+    void (*dmat4Transform4)(const double* mat, const double* in, double* out, size_t n);
+    //transform 3D double points (w = 1) or directions (w = 0) by a double matrix, the vectors are stride doubles apart
+    void (*dmat4Transform3)(const double* mat, const double* in, double* out, size_t n, size_t stride, bool points);
+    //invert an array of double matrices
+    void (*dmat4Inverse)(const double* in, double* out, size_t n);
+
+    //convert normalized quaternions to rotation matrices, every matrix takes stride (12 or 16) floats
+    void (*quatToMat)(const float* in, float* out, size_t n, size_t stride);
+    //convert the rotation parts of matrices that take stride (12 or 16) floats each to quaternions
+    void (*quatFromMat)(const float* in, float* out, size_t n, size_t stride);
+    //blend pairs of quaternions with a weight per pair using slerp or nlerp
+    void (*quatBlend)(const float* a, const float* b, const float* t, float* out, size_t n, bool slerp);
+    //deform SoA positions and normals by blending the dual quaternions of 4 bones per vertex, nrm may be NULL
+    void (*dqSkin)(const float* bones, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm, 
+                   float* const* outPos, float* const* outNrm, size_t n, bool stream);
+    //deform SoA positions and normals by blending the matrices (stride 12 or 16 floats) of 4 bones per vertex, nrm may be NULL
+    void (*lbsSkin)(const float* palette, size_t stride, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm, 
+                    float* const* outPos, float* const* outNrm, size_t n, bool stream);
+
+    //test spheres (center and radius) against 6 planes, write the indices of the visible spheres or one bit per sphere
+    size_t (*cullSpheres)(const float* planes, const float* spheres, size_t n, uint32_t* out, bool compact);
+    //test axis aligned boxes against 6 planes, write the indices of the visible boxes or one bit per box
+    size_t (*cullAABBs)(const float* planes, const float* mins, const float* maxs, size_t n, uint32_t* out, bool compact);
+    //intersect a ray (origin, inverse direction, maximal distance) with axis aligned boxes, write the entry distance or infinity
+    size_t (*rayAABBs)(const float* ray, const float* boxes, size_t n, float* t);
+    //intersect a ray (origin, direction, squared direction length, maximal distance) with spheres, write the distance or infinity
+    size_t (*raySpheres)(const float* ray, const float* spheres, size_t n, float* t);
+    //test axis aligned boxes for an overlap with a box, write the indices of the overlapping boxes or one bit per box
+    size_t (*aabbOverlaps)(const float* box, const float* boxes, size_t n, uint32_t* out, bool compact);
+    //transform axis aligned boxes by a matrix and compute the boxes around the results
+    void (*aabbTransform)(const float* mat, const float* in, float* out, size_t n);
+
+    //add two containers
+    void (*soaAdd)(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n);
+    //subtract two containers
+    void (*soaSubtract)(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n);
+    //multiply two containers element wise
+    void (*soaMultiply)(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n);
+    //compute a * b + c for three containers
+    void (*soaFma)(const float* const* a, const float* const* b, const float* const* c, float* const* out, size_t streams, size_t n);
+    //compute the dot products of two containers
+    void (*soaDot)(const float* const* a, const float* const* b, float* out, size_t streams, size_t n);
+    //compute the lengths of the elements of a container
+    void (*soaLength)(const float* const* a, float* out, size_t streams, size_t n);
+    //normalize the elements of a container
+    void (*soaNormalize)(const float* const* a, float* const* out, size_t streams, size_t n);
+    //compute the cross products of two 3D containers
+    void (*soaCross)(const float* const* a, const float* const* b, float* const* out, size_t n);
+    //convert interleaved vectors to one stream per axis
+    void (*soaFromAoS)(const float* in, float* const* out, size_t streams, size_t n);
+    //convert one stream per axis to interleaved vectors
+    void (*soaToAoS)(const float* const* in, float* out, size_t streams, size_t n);
+
+};
+
+/**
+ * @brief get the kernel table that is used by the library
+ * 
+ * @return const KernelTable& the table for the selected instruction set
+ */
+const KernelTable& table() noexcept;
+
+//the tables of the instruction sets, only the ones that were compiled into the library are defined
+const KernelTable* getTableScalar() noexcept;
+const KernelTable* getTableSSE2() noexcept;
+const KernelTable* getTableSSE41() noexcept;
+const KernelTable* getTableAVX2() noexcept;
+const KernelTable* getTableAVX512() noexcept;
+
+};
+};
+
+#endif
+
+#endif
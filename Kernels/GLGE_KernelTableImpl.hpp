@@ -0,0 +1,265 @@
+/**
+ * @file GLGE_KernelTableImpl.hpp
+ * @author DM8AT
+ * @brief fill the kernel table for the instruction set of the including translation unit
+ * 
+ * The including file defines GLGE_KERNEL_LEVEL and is compiled with the flags for that instruction set. 
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_KERNEL_TABLE_IMPL_
+#define _GLGE_KERNEL_TABLE_IMPL_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the table to fill
+#include "GLGE_KernelTable.hpp"
+//include the kernels
+#include "GLGE_SoAKernels.hpp"
+#include "GLGE_Mat4Kernels.hpp"
+#include "GLGE_AffineKernels.hpp"
+#include "GLGE_DMat4Kernels.hpp"
+#include "GLGE_VecKernels.hpp"
+#include "GLGE_MathKernels.hpp"
+#include "GLGE_QuatKernels.hpp"
+#include "GLGE_SkinKernels.hpp"
+#include "GLGE_CullKernels.hpp"
+#include "GLGE_GeometryKernels.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+//the table only stores one function per kernel, so the template parameters are selected at runtime
+
+static void mat4Transform4(const float* mat, const float* in, float* out, size_t n, bool stream) {
+    if (stream) {mat4Transform<4, false, true>(mat, in, out, n);}
+    else {mat4Transform<4, false, false>(mat, in, out, n);}
+}
+
+static void mat4Transform3(const float* mat, const float* in, float* out, size_t n, bool points, bool stream) {
+    if (points) {
+        if (stream) {mat4Transform<3, true, true>(mat, in, out, n);}
+        else {mat4Transform<3, true, false>(mat, in, out, n);}
+    } else {
+        if (stream) {mat4Transform<3, false, true>(mat, in, out, n);}
+        else {mat4Transform<3, false, false>(mat, in, out, n);}
+    }
+}
+
+static void vecLengthN(const float* in, float* out, size_t n, size_t axis, bool fast) {
+    switch (axis) {
+    case 2: if (fast) {vecLength<2, true>(in, out, n);} else {vecLength<2, false>(in, out, n);} break;
+    case 3: if (fast) {vecLength<3, true>(in, out, n);} else {vecLength<3, false>(in, out, n);} break;
+    default: if (fast) {vecLength<4, true>(in, out, n);} else {vecLength<4, false>(in, out, n);} break;
+    }
+}
+
+static void vecNormalizeN(const float* in, float* out, size_t n, size_t axis, bool fast, bool padded) {
+    switch (axis) {
+    case 2: if (fast) {vecNormalize<2, true>(in, out, n);} else {vecNormalize<2, false>(in, out, n);} break;
+    case 3: if (fast) {vecNormalize<3, true>(in, out, n);} else {vecNormalize<3, false>(in, out, n);} break;
+    default:
+        if (padded) {if (fast) {vecNormalize<4, true, true>(in, out, n);} else {vecNormalize<4, false, true>(in, out, n);}}
+        else {if (fast) {vecNormalize<4, true>(in, out, n);} else {vecNormalize<4, false>(in, out, n);}}
+        break;
+    }
+}
+
+template <typename P, typename T> static void mathN(MathFunction func, const T* a, const T* b, T* out, size_t n) {
+    switch (func) {
+    case MathFunction::Sin: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return sin(x);}); break;
+    case MathFunction::Cos: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return cos(x);}); break;
+    case MathFunction::Tan: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return tan(x);}); break;
+    case MathFunction::Exp: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return exp(x);}); break;
+    case MathFunction::Log: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return log(x);}); break;
+    case MathFunction::Atan2: mapPacks<P>(a, b, out, n, [](P y, P x) {return atan2(y, x);}); break;
+    case MathFunction::Pow: mapPacks<P>(a, b, out, n, [](P x, P y) {return pow(x, y);}); break;
+    case MathFunction::Sqrt: mapPacks<P>(a, (const T*)NULL, out, n, [](P x, P) {return sqrt(x);}); break;
+    }
+}
+
+static void mathFloat(MathFunction func, const float* a, const float* b, float* out, size_t n) 
+{mathN<Pack>(func, a, b, out, n);}
+
+static void mathSinCos(const float* in, float* s, float* c, size_t n) 
+{sincosArray<Pack>(in, s, c, n);}
+
+static void mathDouble(MathFunction func, const double* a, const double* b, double* out, size_t n) 
+{mathN<DPack>(func, a, b, out, n);}
+
+static void mathDSinCos(const double* in, double* s, double* c, size_t n) 
+{sincosArray<DPack>(in, s, c, n);}
+
+static void dmat4Transform4(const double* mat, const double* in, double* out, size_t n) 
+{dmat4Transform<4, false>(mat, in, out, n, 4);}
+
+static void dmat4Transform3(const double* mat, const double* in, double* out, size_t n, size_t stride, bool points) {
+    if (points) {dmat4Transform<3, true>(mat, in, out, n, stride);}
+    else {dmat4Transform<3, false>(mat, in, out, n, stride);}
+}
+
+static void quatToMatN(const float* in, float* out, size_t n, size_t stride) {
+    if (stride == 12) {quatToMat<12>(in, out, n);}
+    else {quatToMat<16>(in, out, n);}
+}
+
+static void quatFromMatN(const float* in, float* out, size_t n, size_t stride) {
+    if (stride == 12) {quatFromMat<12>(in, out, n);}
+    else {quatFromMat<16>(in, out, n);}
+}
+
+static void quatBlendN(const float* a, const float* b, const float* t, float* out, size_t n, bool slerp) {
+    if (slerp) {quatBlendArray<true>(a, b, t, out, n);}
+    else {quatBlendArray<false>(a, b, t, out, n);}
+}
+
+static void dqSkinN(const float* bones, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm, 
+                    float* const* outPos, float* const* outNrm, size_t n, bool stream) {
+    if (stream) {dqSkin<true>(bones, joints, weights, pos, nrm, outPos, outNrm, n);}
+    else {dqSkin<false>(bones, joints, weights, pos, nrm, outPos, outNrm, n);}
+}
+
+static void lbsSkinN(const float* palette, size_t stride, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm, 
+                     float* const* outPos, float* const* outNrm, size_t n, bool stream) {
+    if (stride == 12) {
+        if (stream) {lbsSkin<12, true>(palette, joints, weights, pos, nrm, outPos, outNrm, n);}
+        else {lbsSkin<12, false>(palette, joints, weights, pos, nrm, outPos, outNrm, n);}
+    } else {
+        if (stream) {lbsSkin<16, true>(palette, joints, weights, pos, nrm, outPos, outNrm, n);}
+        else {lbsSkin<16, false>(palette, joints, weights, pos, nrm, outPos, outNrm, n);}
+    }
+}
+
+static size_t cullSpheresN(const float* planes, const float* spheres, size_t n, uint32_t* out, bool compact) {
+    if (compact) {return cullSpheres<true>(planes, spheres, n, out);}
+    else {return cullSpheres<false>(planes, spheres, n, out);}
+}
+
+static size_t cullAABBsN(const float* planes, const float* mins, const float* maxs, size_t n, uint32_t* out, bool compact) {
+    if (compact) {return cullAABBs<true>(planes, mins, maxs, n, out);}
+    else {return cullAABBs<false>(planes, mins, maxs, n, out);}
+}
+
+static size_t aabbOverlapsN(const float* box, const float* boxes, size_t n, uint32_t* out, bool compact) {
+    if (compact) {return aabbOverlaps<true>(box, boxes, n, out);}
+    else {return aabbOverlaps<false>(box, boxes, n, out);}
+}
+
+//the element wise kernels process every stream on its own, so they are instantiated for a single stream
+
+static void soaAddN(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n) {
+    for (size_t c = 0; c < streams; ++c) {soaAdd<1>(a + c, b + c, out + c, n);}
+}
+
+static void soaSubtractN(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n) {
+    for (size_t c = 0; c < streams; ++c) {soaSubtract<1>(a + c, b + c, out + c, n);}
+}
+
+static void soaMultiplyN(const float* const* a, const float* const* b, float* const* out, size_t streams, size_t n) {
+    for (size_t c = 0; c < streams; ++c) {soaMultiply<1>(a + c, b + c, out + c, n);}
+}
+
+static void soaFmaN(const float* const* a, const float* const* b, const float* const* c, float* const* out, size_t streams, size_t n) {
+    for (size_t s = 0; s < streams; ++s) {soaFma<1>(a + s, b + s, c + s, out + s, n);}
+}
+
+static void soaDotN(const float* const* a, const float* const* b, float* out, size_t streams, size_t n) {
+    switch (streams) {
+    case 2: soaDot<2>(a, b, out, n); break;
+    case 3: soaDot<3>(a, b, out, n); break;
+    default: soaDot<4>(a, b, out, n); break;
+    }
+}
+
+static void soaLengthN(const float* const* a, float* out, size_t streams, size_t n) {
+    switch (streams) {
+    case 2: soaLength<2>(a, out, n); break;
+    case 3: soaLength<3>(a, out, n); break;
+    default: soaLength<4>(a, out, n); break;
+    }
+}
+
+static void soaNormalizeN(const float* const* a, float* const* out, size_t streams, size_t n) {
+    switch (streams) {
+    case 2: soaNormalize<2>(a, out, n); break;
+    case 3: soaNormalize<3>(a, out, n); break;
+    default: soaNormalize<4>(a, out, n); break;
+    }
+}
+
+static void soaFromAoSN(const float* in, float* const* out, size_t streams, size_t n) {
+    switch (streams) {
+    case 2: soaFromAoS<2>(in, out, n); break;
+    case 3: soaFromAoS<3>(in, out, n); break;
+    default: soaFromAoS<4>(in, out, n); break;
+    }
+}
+
+static void soaToAoSN(const float* const* in, float* out, size_t streams, size_t n) {
+    switch (streams) {
+    case 2: soaToAoS<2>(in, out, n); break;
+    case 3: soaToAoS<3>(in, out, n); break;
+    default: soaToAoS<4>(in, out, n); break;
+    }
+}
+
+/**
+ * @brief the kernel table of the instruction set
+ */
+static const KernelTable kernelTable = {
+    mat4Transform4,
+    mat4Transform3,
+    mat4Inverse,
+    affineMultiply,
+    affineMultiplyIndexed,
+    affineInverse,
+    vecLengthN,
+    vecNormalizeN,
+    mathFloat,
+    mathSinCos,
+    mathDouble,
+    mathDSinCos,
+    dmat4Multiply,
+    dmat4Transform4,
+    dmat4Transform3,
+    dmat4Inverse,
+    quatToMatN,
+    quatFromMatN,
+    quatBlendN,
+    dqSkinN,
+    lbsSkinN,
+    cullSpheresN,
+    cullAABBsN,
+    rayAABBs,
+    raySpheres,
+    aabbOverlapsN,
+    aabbTransform,
+    soaAddN,
+    soaSubtractN,
+    soaMultiplyN,
+    soaFmaN,
+    soaDotN,
+    soaLengthN,
+    soaNormalizeN,
+    soaCross,
+    soaFromAoSN,
+    soaToAoSN
+};
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,28 @@
+/**
+ * @file GLGE_Kernels_SSE41.cpp
+ * @author DM8AT
+ * @brief compile the batch kernels for SSE4.1
+ * 
+ * This file is compiled with the compiler flags for the instruction set (see CMakeLists.txt)
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the settings
+#include "../GLGEMath_Settings.h"
+
+//the kernels with SIMD are only compiled if SIMD is requested
+#if GLGE_MATH_USE_SIMD
+
+//select the instruction set for the packs
+#define GLGE_KERNEL_LEVEL 2
+//fill the kernel table
+#include "GLGE_KernelTableImpl.hpp"
+
+const glge::kernel::KernelTable* glge::kernel::getTableSSE41() noexcept {return &kernelTable;}
+
+#endif
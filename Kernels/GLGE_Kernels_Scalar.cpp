@@ -0,0 +1,24 @@
+/**
+ * @file GLGE_Kernels_Scalar.cpp
+ * @author DM8AT
+ * @brief compile the batch kernels without SIMD (the fallback for CPUs and builds without SSE2)
+ * 
+ * This file is compiled without any instruction set flags
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the settings
+#include "../GLGEMath_Settings.h"
+
+//select the instruction set for the packs
+#define GLGE_KERNEL_LEVEL 0
+//fill the kernel table
+#include "GLGE_KernelTableImpl.hpp"
+
+const glge::kernel::KernelTable* glge::kernel::getTableScalar() noexcept {return &kernelTable;}
+
@@ -0,0 +1,167 @@
+/**
+ * @file GLGE_Mat4Kernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for 4x4 float matrices
+ * 
+ * The kernels work on plain floats, the matrix is stored row major (like mat4::m). All kernels use the same steps as the
+ * functions of mat4 and never fuse multiplications and additions, so every instruction set produces the same
+ * results as the single matrix functions.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_MAT4_KERNELS_
+#define _GLGE_MAT4_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief transform a range of vectors with N axis (3 or 4) by a 4x4 matrix
+ * 
+ * @tparam N the amount of axis of the vectors. 3D vectors only use the upper 3x4 part of the matrix
+ * @tparam Points only used for 3D vectors. true : the vectors are points (w = 1) | false : the vectors are directions (w = 0)
+ * @tparam Stream true : the output is written using non-temporal stores, it must be aligned to 16 bytes | false : the output is written using normal stores
+ * @param mat a pointer to the floats of the matrix, 3D vectors only read the upper 12 floats (so a 3x4 matrix can be passed)
+ * @param in a pointer to the interleaved floats of the vectors to transform
+ * @param out a pointer to write the interleaved floats of the transformed vectors to (may be in)
+ * @param n the amount of vectors to transform
+ */
+template <size_t N, bool Points, bool Stream> void mat4Transform(const float* mat, const float* in, float* out, size_t n) noexcept {
+    //keep the used part of the matrix in registers
+    Pack m[16];
+    for (size_t j = 0; j < N*4; ++j)
+    {m[j] = set1(mat[j]);}
+
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack v[4];
+        loadVectors<N>(in + i*N, v);
+        Pack r[4];
+        for (size_t row = 0; row < N; ++row) {
+            const Pack* mr = m + row*4;
+            r[row] = (v[0] * mr[0] + v[1] * mr[1]) + v[2] * mr[2];
+            if (N == 4) {r[row] = r[row] + v[3] * mr[3];}
+            else if (Points) {r[row] = r[row] + mr[3];}
+        }
+        storeVectors<N, Stream>(out + i*N, r);
+    }
+
+    //transform the remaining vectors one by one
+    for (; i < n; ++i) {
+        const float* v = in + i*N;
+        float r[4];
+        for (size_t row = 0; row < N; ++row) {
+            const float* mr = mat + row*4;
+            r[row] = (v[0] * mr[0] + v[1] * mr[1]) + v[2] * mr[2];
+            if (N == 4) {r[row] = r[row] + v[3] * mr[3];}
+            else if (Points) {r[row] = r[row] + mr[3];}
+        }
+        for (size_t row = 0; row < N; ++row)
+        {out[i*N + row] = r[row];}
+    }
+    //make the streamed data visible before returning
+    if (Stream) {fence();}
+}
+
+/**
+ * @brief invert Quad::Width / 4 matrices at once, every group of 4 floats holds a row of a different matrix
+ * 
+ * The steps are exactly the same as in mat4::inverse(), see mat4::adjugate() for the derivation
+ * 
+ * @param r the rows of the matrices, they are overwritten with the rows of the inverse matrices
+ */
+inline void mat4InverseRows(Quad* r) noexcept {
+    //for every column k the top rows (c, c, b, b) and the bottom rows (d, d, d, c) of the row pairs of the 2x2 sub-determinants
+    Quad p[4] = {shuffle<0,0,0,0>(r[2], r[1]), shuffle<1,1,1,1>(r[2], r[1]), shuffle<2,2,2,2>(r[2], r[1]), shuffle<3,3,3,3>(r[2], r[1])};
+    Quad q[4] = {shuffle<0,0,0,0>(r[3], r[2]), shuffle<1,1,1,1>(r[3], r[2]), shuffle<2,2,2,2>(r[3], r[2]), shuffle<3,3,3,3>(r[3], r[2])};
+    //the rows the minors are expanded along (b, a, a, a) for every column k
+    Quad v[4] = {shuffle<0,0,0,0>(r[1], r[0]), shuffle<1,1,1,1>(r[1], r[0]), shuffle<2,2,2,2>(r[1], r[0]), shuffle<3,3,3,3>(r[1], r[0])};
+    for (size_t k = 0; k < 4; ++k) {
+        q[k] = shuffle<0,0,0,2>(q[k], q[k]);
+        v[k] = shuffle<0,2,2,2>(v[k], v[k]);
+    }
+
+    //2x2 sub-determinants for all column pairs
+    Quad s01 = p[0] * q[1] - p[1] * q[0];
+    Quad s02 = p[0] * q[2] - p[2] * q[0];
+    Quad s03 = p[0] * q[3] - p[3] * q[0];
+    Quad s12 = p[1] * q[2] - p[2] * q[1];
+    Quad s13 = p[1] * q[3] - p[3] * q[1];
+    Quad s23 = p[2] * q[3] - p[3] * q[2];
+
+    //expand the minors and apply the checkerboard signs of the cofactors
+    Quad signEven = setQuads(1.f, -1.f, 1.f, -1.f);
+    Quad signOdd = setQuads(-1.f, 1.f, -1.f, 1.f);
+    Quad a0 = ((v[1] * s23 - v[2] * s13) + v[3] * s12) * signEven;
+    Quad a1 = ((v[0] * s23 - v[2] * s03) + v[3] * s02) * signOdd;
+    Quad a2 = ((v[0] * s13 - v[1] * s03) + v[3] * s01) * signEven;
+    Quad a3 = ((v[0] * s12 - v[1] * s02) + v[2] * s01) * signOdd;
+
+    //the determinant is the dot product of the top row and the first column of the adjugate
+    Quad det = r[0] * shuffle<0,2,0,2>(shuffle<0,0,0,0>(a0, a1), shuffle<0,0,0,0>(a2, a3));
+    det = det + shuffle<1,0,3,2>(det, det);
+    det = det + shuffle<2,3,0,1>(det, det);
+    Quad invDet = setQuads(1.f, 1.f, 1.f, 1.f) / det;
+
+    r[0] = a0 * invDet;
+    r[1] = a1 * invDet;
+    r[2] = a2 * invDet;
+    r[3] = a3 * invDet;
+}
+
+/**
+ * @brief invert a range of 4x4 matrices
+ * 
+ * @param in a pointer to the 16 floats of every matrix
+ * @param out a pointer to write the 16 floats of every inverse matrix to (may be in)
+ * @param n the amount of matrices to invert
+ */
+inline void mat4Inverse(const float* in, float* out, size_t n) noexcept {
+    //the amount of matrices that are inverted at once
+    const size_t count = Quad::Width / 4;
+
+    size_t i = 0;
+    for (; i + count <= n; i += count) {
+        Quad r[4];
+        for (size_t row = 0; row < 4; ++row)
+        {r[row] = loadQuads(in + i*16 + row*4, 16);}
+        mat4InverseRows(r);
+        for (size_t row = 0; row < 4; ++row)
+        {storeQuads(out + i*16 + row*4, 16, r[row]);}
+    }
+
+    //the remaining matrices are padded with identity matrices to fill the registers
+    if (i < n) {
+        float tmp[16 * count];
+        for (size_t j = 0; j < 16 * count; ++j) 
+        {tmp[j] = ((j % 16) % 5 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < (n - i) * 16; ++j) 
+        {tmp[j] = in[i*16 + j];}
+        mat4Inverse(tmp, tmp, count);
+        for (size_t j = 0; j < (n - i) * 16; ++j) 
+        {out[i*16 + j] = tmp[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
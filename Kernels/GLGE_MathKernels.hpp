@@ -0,0 +1,452 @@
+/**
+ * @file GLGE_MathKernels.hpp
+ * @author DM8AT
+ * @brief define the polynomial approximations of the transcendental functions for packs of floats and doubles
+ * 
+ * Every function evaluates all lanes of a pack at once without branches. The arguments are reduced to a small range
+ * (multiples of pi/2 for the trigonometric functions, powers of two for exp and log) and the remaining part is evaluated
+ * by a polynomial. The float versions use the coefficients of Cephes, the double versions the ones of fdlibm and Cephes.
+ * The accuracy is documented in GLGE_Common.h.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_MATH_KERNELS_
+#define _GLGE_MATH_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include the limits of floats and doubles
+#include <cfloat>
+//include the C math library for the angles that are too large for the argument reduction
+#include <cmath>
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief compute the sine and the cosine of the lanes of a pack that are too large for the argument reduction
+ * 
+ * The lanes are computed one by one with the C math library, so the results are the same for all instruction sets
+ * 
+ * @tparam P the pack type to use (Pack or DPack)
+ * @param x the angles in radians
+ * @param large the lanes to compute, all bits are set for the large angles
+ * @param s the pack to write the sines of the large angles to
+ * @param c the pack to write the cosines of the large angles to
+ */
+template <typename P> inline void sincosLarge(P x, P large, P& s, P& c) noexcept {
+    //the element type of the pack
+    typedef decltype(first(x)) T;
+    T tx[P::Width], ts[P::Width], tc[P::Width];
+    storeu(tx, x);
+    storeu(ts, s);
+    storeu(tc, c);
+    uint32_t lanes = moveMask(large);
+    for (size_t i = 0; i < P::Width; ++i) {
+        if (lanes & (1u << i)) {ts[i] = std::sin(tx[i]); tc[i] = std::cos(tx[i]);}
+    }
+    s = loadu(ts);
+    c = loadu(tc);
+}
+
+/**
+ * @brief compute the sine and the cosine of a pack of floats at once
+ * 
+ * @param x the angles in radians
+ * @param s the pack to write the sines to
+ * @param c the pack to write the cosines to
+ */
+inline void sincos(Pack x, Pack& s, Pack& c) noexcept {
+    //subtract the nearest multiple k of pi/2 in four steps (Cody-Waite). The first three parts of pi/2 have at most 11
+    //significant bits, so their products with k are exact for abs(k) < 2^13 even if fma rounds the product, and the
+    //differences are either exact or large compared to the remaining parts
+    Pack k = round(x * set1(0.636619772367581f));
+    Pack r = fma(k, set1(-1.5703125f), x);
+    r = fma(k, set1(-4.837512969970703125e-4f), r);
+    r = fma(k, set1(-7.54953362047672271728515625e-8f), r);
+    r = fma(k, set1(-2.5633440683e-12f), r);
+
+    //evaluate both polynomials on [-pi/4, pi/4]
+    Pack z = r * r;
+    Pack ps = fma(fma(set1(-1.9515295891e-4f), z, set1(8.3321608736e-3f)), z, set1(-1.6666654611e-1f));
+    Pack sr = fma(r * z, ps, r);
+    Pack pc = fma(fma(set1(2.443315711809948e-5f), z, set1(-1.388731625493765e-3f)), z, set1(4.166664568298827e-2f));
+    //1 - z/2 is computed with a correction term for the rounding of the subtraction
+    Pack hz = z * set1(0.5f);
+    Pack w = set1(1.f) - hz;
+    Pack cr = w + (((set1(1.f) - w) - hz) + (z * z) * pc);
+
+    //the quadrant q = k mod 4 in [-2, 1] selects the polynomial and the signs
+    Pack q = fma(round(k * set1(0.25f)), set1(-4.f), k);
+    Pack odd = equal(abs(q), set1(1.f));
+    Pack sinNeg = bitOr(lessThan(q, set1(-0.5f)), greaterThan(q, set1(1.5f)));
+    Pack cosNeg = bitOr(greaterThan(q, set1(0.5f)), lessThan(q, set1(-1.5f)));
+    s = bitXor(select(odd, cr, sr), bitAnd(sinNeg, set1(-0.f)));
+    c = bitXor(select(odd, sr, cr), bitAnd(cosNeg, set1(-0.f)));
+    //the reduction turns -0 into +0, so the sine of 0 is the angle itself to keep its sign
+    s = select(equal(x, set1(0.f)), x, s);
+    //k is too large for the exact reduction above 1e4, these angles and infinities are left to the C math library
+    Pack large = greaterThan(abs(x), set1(1e4f));
+    if (moveMask(large)) {sincosLarge(x, large, s, c);}
+}
+
+/**
+ * @brief compute the sine and the cosine of a pack of doubles at once
+ * 
+ * @param x the angles in radians
+ * @param s the pack to write the sines to
+ * @param c the pack to write the cosines to
+ */
+inline void sincos(DPack x, DPack& s, DPack& c) noexcept {
+    //subtract the nearest multiple k of pi/2 in four steps (Cody-Waite). The first three parts of pi/2 have 33 significant
+    //bits like in fdlibm, so their products with k are exact for abs(k) < 2^20 even if fma rounds the product
+    DPack k = round(x * set1(0.63661977236758134308));
+    DPack r = fma(k, set1(-1.57079632673412561417e+00), x);
+    r = fma(k, set1(-6.07710050630396597660e-11), r);
+    r = fma(k, set1(-2.02226624871116645580e-21), r);
+    r = fma(k, set1(-8.47842766036889956997e-32), r);
+
+    //evaluate both polynomials on [-pi/4, pi/4]
+    DPack z = r * r;
+    DPack ps = fma(fma(fma(fma(set1(1.58969099521155010221e-10), z, set1(-2.50507602534068634195e-08)), z,
+                           set1(2.75573137070700676789e-06)), z, set1(-1.98412698298579493134e-04)), z, set1(8.33333333332248946124e-03));
+    DPack sr = fma(r * z, fma(ps, z, set1(-1.66666666666666324348e-01)), r);
+    DPack pc = fma(fma(fma(fma(fma(set1(-1.13596475577881948265e-11), z, set1(2.08757232129817482790e-09)), z,
+                               set1(-2.75573143513906633035e-07)), z, set1(2.48015872894767294178e-05)), z,
+                               set1(-1.38888888888741095749e-03)), z, set1(4.16666666666666019037e-02));
+    //1 - z/2 is computed with a correction term for the rounding of the subtraction
+    DPack hz = z * set1(0.5);
+    DPack w = set1(1.) - hz;
+    DPack cr = w + (((set1(1.) - w) - hz) + (z * z) * pc);
+
+    //the quadrant q = k mod 4 in [-2, 1] selects the polynomial and the signs
+    DPack q = fma(round(k * set1(0.25)), set1(-4.), k);
+    DPack odd = equal(abs(q), set1(1.));
+    DPack sinNeg = bitOr(lessThan(q, set1(-0.5)), greaterThan(q, set1(1.5)));
+    DPack cosNeg = bitOr(greaterThan(q, set1(0.5)), lessThan(q, set1(-1.5)));
+    s = bitXor(select(odd, cr, sr), bitAnd(sinNeg, set1(-0.)));
+    c = bitXor(select(odd, sr, cr), bitAnd(cosNeg, set1(-0.)));
+    //the reduction turns -0 into +0, so the sine of 0 is the angle itself to keep its sign
+    s = select(equal(x, set1(0.)), x, s);
+    //the reduction loses accuracy above 1e5, these angles and infinities are left to the C math library
+    DPack large = greaterThan(abs(x), set1(1e5));
+    if (moveMask(large)) {sincosLarge(x, large, s, c);}
+}
+
+/**
+ * @brief compute the sine of a pack
+ */
+template <typename P> inline P sin(P x) noexcept {P s, c; sincos(x, s, c); return s;}
+
+/**
+ * @brief compute the cosine of a pack
+ */
+template <typename P> inline P cos(P x) noexcept {P s, c; sincos(x, s, c); return c;}
+
+/**
+ * @brief compute the tangent of a pack of floats
+ */
+inline Pack tan(Pack x) noexcept {
+    //tan(x) = sin(x) / cos(x), the sine and the cosine share the argument reduction
+    Pack s, c;
+    sincos(x, s, c);
+    return s / c;
+}
+
+/**
+ * @brief compute the tangent of a pack of doubles
+ */
+inline DPack tan(DPack x) noexcept {
+    DPack s, c;
+    sincos(x, s, c);
+    return s / c;
+}
+
+/**
+ * @brief compute the angle of the points (x, y) to the positive x axis for a pack of floats
+ * 
+ * @param y the y coordinates
+ * @param x the x coordinates
+ * @return Pack the angles in (-pi, pi]
+ */
+inline Pack atan2(Pack y, Pack x) noexcept {
+    //reduce to atan(a) with a = min / max in [0, 1]
+    Pack ax = abs(x);
+    Pack ay = abs(y);
+    Pack mx = max(ax, ay);
+    Pack a = min(ax, ay) / mx;
+    //two equal coordinates are on a diagonal, this also covers two infinities where the quotient is NaN
+    a = select(equal(ax, ay), set1(1.f), a);
+    a = select(equal(mx, set1(0.f)), set1(0.f), a);
+    //above tan(pi/8) use atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    Pack big = greaterThan(a, set1(0.4142135623730950f));
+    a = select(big, (a - set1(1.f)) / (a + set1(1.f)), a);
+    Pack z = a * a;
+    Pack p = fma(fma(fma(set1(8.05374449538e-2f), z, set1(-1.38776856032e-1f)), z, set1(1.99777106478e-1f)), z, set1(-3.33329491539e-1f));
+    Pack r = fma(a * z, p, a) + bitAnd(big, set1(0.785398163397448f));
+    //undo the reduction, the constants are split in a high and a low part
+    r = select(greaterThan(ay, ax), (set1(1.5707963705062866f) - r) + set1(-4.37113900018624e-8f), r);
+    r = select(lessThan(x, set1(0.f)), (set1(3.1415927410125732f) - r) + set1(-8.74227800037248e-8f), r);
+    r = bitOr(r, bitAnd(y, set1(-0.f)));
+    //let NaNs pass, x + y is NaN as well if x and y are infinities of different signs
+    return select(bitAnd(equal(x, x), equal(y, y)), r, x + y);
+}
+
+/**
+ * @brief compute the angle of the points (x, y) to the positive x axis for a pack of doubles
+ * 
+ * @param y the y coordinates
+ * @param x the x coordinates
+ * @return DPack the angles in (-pi, pi]
+ */
+inline DPack atan2(DPack y, DPack x) noexcept {
+    //reduce to atan(a) with a = min / max in [0, 1]
+    DPack ax = abs(x);
+    DPack ay = abs(y);
+    DPack mx = max(ax, ay);
+    DPack a = min(ax, ay) / mx;
+    //two equal coordinates are on a diagonal, this also covers two infinities where the quotient is NaN
+    a = select(equal(ax, ay), set1(1.), a);
+    a = select(equal(mx, set1(0.)), set1(0.), a);
+    //above 0.66 use atan(a) = pi/4 + atan((a - 1) / (a + 1))
+    DPack big = greaterThan(a, set1(0.66));
+    a = select(big, (a - set1(1.)) / (a + set1(1.)), a);
+    //rational approximation of Cephes
+    DPack z = a * a;
+    DPack p = fma(fma(fma(fma(set1(-8.750608600031904122785e-1), z, set1(-1.615753718733365076637e1)), z,
+                          set1(-7.500855792314704667340e1)), z, set1(-1.228866684490136173410e2)), z, set1(-6.485021904942025371773e1));
+    DPack q = fma(fma(fma(fma(z + set1(2.485846490142306297962e1), z, set1(1.650270098316988542046e2)), z,
+                          set1(4.328810604912902668951e2)), z, set1(4.853903996359136964868e2)), z, set1(1.945506571482613964425e2));
+    DPack r = fma(a * z, p / q, a);
+    r = select(big, set1(7.85398163397448309616e-1) + (r + set1(3.061616997868383e-17)), r);
+    //undo the reduction, the constants are split in a high and a low part
+    r = select(greaterThan(ay, ax), (set1(1.5707963267948966) - r) + set1(6.123233995736766e-17), r);
+    r = select(lessThan(x, set1(0.)), (set1(3.141592653589793) - r) + set1(1.2246467991473532e-16), r);
+    r = bitOr(r, bitAnd(y, set1(-0.)));
+    //let NaNs pass, x + y is NaN as well if x and y are infinities of different signs
+    return select(bitAnd(equal(x, x), equal(y, y)), r, x + y);
+}
+
+/**
+ * @brief compute e^x for a pack of floats
+ */
+inline Pack exp(Pack x) noexcept {
+    //results below the smallest normal float are flushed to 0, larger ones than the largest float are infinity
+    const Pack lo = set1(-87.33654475f);
+    const Pack hi = set1(88.72283905f);
+    //the order of the arguments lets NaNs pass
+    Pack xc = min(hi, max(lo, x));
+    //x = k * ln(2) + r with |r| <= ln(2) / 2
+    Pack k = round(xc * set1(1.44269504088896341f));
+    Pack r = fma(k, set1(-0.693359375f), xc);
+    r = fma(k, set1(2.12194440e-4f), r);
+    Pack p = fma(fma(fma(fma(fma(set1(1.9875691500e-4f), r, set1(1.3981999507e-3f)), r, set1(8.3334519073e-3f)), r,
+                         set1(4.1665795894e-2f)), r, set1(1.6666665459e-1f)), r, set1(5.0000001201e-1f));
+    p = fma(p, r * r, r) + set1(1.f);
+    //2^128 is not a float, so the largest results are scaled in two steps
+    Pack big = greaterThan(k, set1(127.f));
+    k = k - bitAnd(big, set1(1.f));
+    p = p + bitAnd(big, p);
+    Pack e = p * pow2(k);
+    e = select(greaterThan(x, hi), set1(INFINITY), e);
+    return select(lessThan(x, lo), set1(0.f), e);
+}
+
+/**
+ * @brief compute e^x for a pack of doubles
+ */
+inline DPack exp(DPack x) noexcept {
+    //results below the smallest normal double are flushed to 0, larger ones than the largest double are infinity
+    const DPack lo = set1(-708.3964185322641);
+    const DPack hi = set1(709.782712893384);
+    //the order of the arguments lets NaNs pass
+    DPack xc = min(hi, max(lo, x));
+    //x = k * ln(2) + r with |r| <= ln(2) / 2
+    DPack k = round(xc * set1(1.4426950408889634074));
+    DPack r = fma(k, set1(-6.93147180369123816490e-01), xc);
+    r = fma(k, set1(-1.90821492927058770002e-10), r);
+    //the Taylor series up to r^13 is exact to less than an ulp in this range
+    DPack p = set1(1. / 6227020800.);
+    const double coefficients[] = {1. / 479001600., 1. / 39916800., 1. / 3628800., 1. / 362880., 1. / 40320., 1. / 5040.,
+                                   1. / 720., 1. / 120., 1. / 24., 1. / 6., 0.5};
+    for (double coefficient : coefficients) {p = fma(p, r, set1(coefficient));}
+    p = fma(p, r * r, r) + set1(1.);
+    //2^1024 is not a double, so the largest results are scaled in two steps
+    DPack big = greaterThan(k, set1(1023.));
+    k = k - bitAnd(big, set1(1.));
+    p = p + bitAnd(big, p);
+    DPack e = p * pow2(k);
+    e = select(greaterThan(x, hi), set1((double)INFINITY), e);
+    return select(lessThan(x, lo), set1(0.), e);
+}
+
+/**
+ * @brief compute the natural logarithm of a pack of floats
+ */
+inline Pack log(Pack x) noexcept {
+    //scale subnormal floats into the normal range
+    Pack tiny = lessThan(x, set1(FLT_MIN));
+    Pack e;
+    Pack m = splitExponent(select(tiny, x * set1(8388608.f), x), e);
+    e = e - bitAnd(tiny, set1(23.f));
+    //x = m * 2^e with m in [sqrt(2)/2, sqrt(2))
+    Pack big = greaterThan(m, set1(1.41421356237309505f));
+    m = select(big, m * set1(0.5f), m);
+    e = e + bitAnd(big, set1(1.f));
+    Pack f = m - set1(1.f);
+    Pack z = f * f;
+    Pack p = set1(7.0376836292e-2f);
+    const float coefficients[] = {-1.1514610310e-1f, 1.1676998740e-1f, -1.2420140846e-1f, 1.4249322787e-1f,
+                                  -1.6668057665e-1f, 2.0000714765e-1f, -2.4999993993e-1f, 3.3333331174e-1f};
+    for (float coefficient : coefficients) {p = fma(p, f, set1(coefficient));}
+    Pack y = (p * f) * z;
+    y = fma(e, set1(-2.12194440e-4f), y);
+    y = fma(z, set1(-0.5f), y);
+    Pack l = fma(e, set1(0.693359375f), f + y);
+    //handle 0, negative values, infinity and NaN
+    l = select(equal(x, set1(0.f)), set1(-INFINITY), l);
+    l = select(lessThan(x, set1(0.f)), set1(NAN), l);
+    l = select(equal(x, set1(INFINITY)), x, l);
+    return select(equal(x, x), l, x);
+}
+
+/**
+ * @brief compute the natural logarithm of a pack of doubles
+ */
+inline DPack log(DPack x) noexcept {
+    //scale subnormal doubles into the normal range
+    DPack tiny = lessThan(x, set1(DBL_MIN));
+    DPack e;
+    DPack m = splitExponent(select(tiny, x * set1(18014398509481984.), x), e);
+    e = e - bitAnd(tiny, set1(54.));
+    //x = m * 2^e with m in [sqrt(2)/2, sqrt(2))
+    DPack big = greaterThan(m, set1(1.41421356237309504880));
+    m = select(big, m * set1(0.5), m);
+    e = e + bitAnd(big, set1(1.));
+    //log(1 + f) = 2s + 2/3 s^3 + 2/5 s^5 + ... with s = f / (2 + f), like fdlibm
+    DPack f = m - set1(1.);
+    DPack s = f / (set1(2.) + f);
+    DPack z = s * s;
+    DPack R = set1(1.479819860511658591e-01);
+    const double coefficients[] = {1.531383769920937332e-01, 1.818357216161805012e-01, 2.222219843214978396e-01,
+                                   2.857142874366239149e-01, 3.999999999940941908e-01, 6.666666666666735130e-01};
+    for (double coefficient : coefficients) {R = fma(R, z, set1(coefficient));}
+    R = R * z;
+    DPack hfsq = set1(0.5) * f * f;
+    DPack l = e * set1(6.93147180369123816490e-01) - ((hfsq - (s * (hfsq + R) + e * set1(1.90821492927058770002e-10))) - f);
+    //handle 0, negative values, infinity and NaN
+    l = select(equal(x, set1(0.)), set1(-(double)INFINITY), l);
+    l = select(lessThan(x, set1(0.)), set1((double)NAN), l);
+    l = select(equal(x, set1((double)INFINITY)), x, l);
+    return select(equal(x, x), l, x);
+}
+
+/**
+ * @brief compute x^y for a pack of floats or doubles
+ * 
+ * Computed as e^(y * log(x)), so negative bases result in NaN
+ */
+template <typename P> inline P pow(P x, P y) noexcept {
+    //the element type of the pack
+    typedef decltype(first(x)) T;
+    P r = exp(y * log(x));
+    //x^0 and 1^y are always 1
+    return select(bitOr(equal(y, set1((T)0)), equal(x, set1((T)1))), set1((T)1), r);
+}
+
+/**
+ * @brief compute x^y for a pack of floats
+ * 
+ * The rounding of y * log(x) is multiplied by y * log(x) in e^(y * log(x)), so the floats are raised to the power with
+ * the double version and the results are rounded to float
+ */
+inline Pack pow(Pack x, Pack y) noexcept {
+    //a pack of floats always holds a multiple of the doubles in a pack of doubles
+    alignas(64) float tx[Pack::Width], ty[Pack::Width];
+    double dx[Pack::Width], dy[Pack::Width];
+    storeu(tx, x);
+    storeu(ty, y);
+    for (size_t i = 0; i < Pack::Width; ++i) {dx[i] = tx[i]; dy[i] = ty[i];}
+    for (size_t i = 0; i < Pack::Width; i += DPack::Width) {storeu(dx + i, pow(loadu(dx + i), loadu(dy + i)));}
+    for (size_t i = 0; i < Pack::Width; ++i) {tx[i] = (float)dx[i];}
+    return loadu(tx);
+}
+
+/**
+ * @brief apply a function to every element of one or two arrays
+ * 
+ * @tparam P the pack type to use (Pack or DPack)
+ * @tparam T the element type of the pack (float or double)
+ * @tparam F the type of the function, it is called with a pack of a and a pack of b
+ * @param a a pointer to the first arguments
+ * @param b a pointer to the second arguments or NULL if the function only has one argument
+ * @param out a pointer to write the results to (may be a or b)
+ * @param n the amount of elements
+ * @param f the function to apply
+ */
+template <typename P, typename T, typename F> inline void mapPacks(const T* a, const T* b, T* out, size_t n, F f) noexcept {
+    size_t i = 0;
+    for (; i + P::Width <= n; i += P::Width)
+    {storeu(out + i, f(loadu(a + i), b ? loadu(b + i) : set1((T)1)));}
+
+    //compute the remaining elements in a padded buffer, the padding is 1 so no lane raises a special case
+    if (i < n) {
+        T ta[P::Width], tb[P::Width];
+        for (size_t j = 0; j < P::Width; ++j) {
+            ta[j] = (i + j < n) ? a[i + j] : (T)1;
+            tb[j] = (b && (i + j < n)) ? b[i + j] : (T)1;
+        }
+        storeu(ta, f(loadu(ta), loadu(tb)));
+        for (size_t j = 0; i + j < n; ++j) {out[i + j] = ta[j];}
+    }
+}
+
+/**
+ * @brief compute the sine and the cosine of every element of an array
+ * 
+ * @tparam P the pack type to use (Pack or DPack)
+ * @tparam T the element type of the pack (float or double)
+ * @param in a pointer to the angles in radians
+ * @param s a pointer to write the sines to (may be in)
+ * @param c a pointer to write the cosines to (may be in, but not s)
+ * @param n the amount of angles
+ */
+template <typename P, typename T> inline void sincosArray(const T* in, T* s, T* c, size_t n) noexcept {
+    size_t i = 0;
+    P ps, pc;
+    for (; i + P::Width <= n; i += P::Width) {
+        sincos(loadu(in + i), ps, pc);
+        storeu(s + i, ps);
+        storeu(c + i, pc);
+    }
+
+    //compute the remaining elements in a padded buffer
+    if (i < n) {
+        T ts[P::Width] = {0}, tc[P::Width];
+        for (size_t j = 0; i + j < n; ++j) {ts[j] = in[i + j];}
+        sincos(loadu(ts), ps, pc);
+        storeu(ts, ps);
+        storeu(tc, pc);
+        for (size_t j = 0; i + j < n; ++j) {s[i + j] = ts[j]; c[i + j] = tc[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,149 @@
+/**
+ * @file GLGE_Parallel.hpp
+ * @author DM8AT
+ * @brief split the work of the batch functions into chunks that are processed by multiple threads
+ * 
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_PARALLEL_
+#define _GLGE_PARALLEL_
+
+//the helpers are only available for C++
+#if __cplusplus
+
+//include the size type
+#include <stddef.h>
+//include the fixed size integers for the thread count
+#include <stdint.h>
+//include threads and the counter for the next chunk
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace glge {
+namespace parallel
+{
+
+/**
+ * @brief get the amount of threads to use for a request
+ * 
+ * @param threads the requested amount of threads, 0 to use one thread per hardware thread
+ * @return uint32_t the amount of threads, at least 1
+ */
+inline uint32_t resolveThreads(uint32_t threads) noexcept {
+    if (threads == 0) {threads = (uint32_t)std::thread::hardware_concurrency();}
+    return (threads == 0) ? 1 : threads;
+}
+
+/**
+ * @brief process the range [0, n) in chunks on multiple threads
+ * 
+ * The chunks are handed out in order through an atomic counter, so threads that finish early take over the remaining 
+ * chunks. The calling thread works on the chunks as well and the function returns after all chunks are done. If no 
+ * thread can be started, all chunks are processed by the calling thread
+ * 
+ * @tparam F the type of the function that processes a chunk
+ * @param n the amount of elements to process
+ * @param chunk the amount of elements per chunk, every chunk except the last one starts and ends at a multiple of it
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param f the function that is called with the first and the end index of every chunk
+ */
+template <typename F> void forChunks(size_t n, size_t chunk, uint32_t threads, F f) noexcept {
+    size_t chunks = (n + chunk - 1) / chunk;
+    size_t workers = resolveThreads(threads);
+    if (workers > chunks) {workers = chunks;}
+    if (workers <= 1) {
+        if (n) {f((size_t)0, n);}
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        for (size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks; c = next.fetch_add(1, std::memory_order_relaxed)) 
+        {f(c * chunk, ((c + 1) * chunk < n) ? (c + 1) * chunk : n);}
+    };
+    std::vector<std::thread> pool;
+    try {
+        pool.reserve(workers - 1);
+        for (size_t t = 1; t < workers; ++t) {pool.emplace_back(work);}
+    } catch (...) {
+        //the threads that could be started and the calling thread still process all chunks
+    }
+    work();
+    for (std::thread& t : pool) {t.join();}
+}
+
+/**
+ * @brief process multiple ranges in order, the elements of a range may only be processed after the previous range is done
+ * 
+ * Range l is [offsets[l], offsets[l + 1]). All ranges are split into chunks that are numbered across the ranges and 
+ * handed out in order through an atomic counter. Before a thread processes a chunk of a range, it waits until all chunks 
+ * of the previous ranges are finished. Every chunk before it was already handed out to a thread that never waits for a 
+ * later chunk, so the wait always ends. The threads are only started once for all ranges
+ * 
+ * @tparam F the type of the function that processes a chunk
+ * @param ranges the amount of ranges
+ * @param offsets a pointer to the first element of every range, followed by the end of the last range (ranges + 1 entries)
+ * @param chunk the maximum amount of elements per chunk, a chunk never spans two ranges
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ * @param f the function that is called with the first and the end index of every chunk
+ */
+template <typename F> void forRanges(size_t ranges, const size_t* offsets, size_t chunk, uint32_t threads, F f) noexcept {
+    //the first chunk of every range, followed by the total amount of chunks
+    std::vector<size_t> firstChunk;
+    try {firstChunk.resize(ranges + 1);}
+    catch (...) {
+        //without the chunk table the ranges are processed in order by the calling thread
+        for (size_t l = 0; l < ranges; ++l) {if (offsets[l] < offsets[l + 1]) {f(offsets[l], offsets[l + 1]);}}
+        return;
+    }
+    firstChunk[0] = 0;
+    for (size_t l = 0; l < ranges; ++l)
+    {firstChunk[l + 1] = firstChunk[l] + (offsets[l + 1] - offsets[l] + chunk - 1) / chunk;}
+    size_t chunks = firstChunk[ranges];
+    size_t workers = resolveThreads(threads);
+    if (workers > chunks) {workers = chunks;}
+    if (workers <= 1) {
+        for (size_t l = 0; l < ranges; ++l) {if (offsets[l] < offsets[l + 1]) {f(offsets[l], offsets[l + 1]);}}
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<size_t> done(0);
+    auto work = [&]() {
+        size_t l = 0;
+        for (size_t c = next.fetch_add(1, std::memory_order_relaxed); c < chunks; c = next.fetch_add(1, std::memory_order_relaxed)) {
+            //the chunks are handed out in order, so the range of the chunk only moves forward
+            while (c >= firstChunk[l + 1]) {++l;}
+            //wait until the previous ranges are finished
+            while (done.load(std::memory_order_acquire) < firstChunk[l]) {std::this_thread::yield();}
+            size_t begin = offsets[l] + (c - firstChunk[l]) * chunk;
+            f(begin, (begin + chunk < offsets[l + 1]) ? begin + chunk : offsets[l + 1]);
+            done.fetch_add(1, std::memory_order_acq_rel);
+        }
+    };
+    std::vector<std::thread> pool;
+    try {
+        pool.reserve(workers - 1);
+        for (size_t t = 1; t < workers; ++t) {pool.emplace_back(work);}
+    } catch (...) {
+        //the threads that could be started and the calling thread still process all chunks
+    }
+    work();
+    for (std::thread& t : pool) {t.join();}
+}
+
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,341 @@
+/**
+ * @file GLGE_QuatKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels that convert between quaternions and rotation matrices and that blend quaternions
+ * 
+ * The quaternions are loaded as interleaved 4D vectors (w, x, y, z) and split into one pack per axis, so Pack::Width
+ * quaternions are converted at once. The matrices are stored row by row, every row takes 4 floats. A matrix is either
+ * a full 4x4 matrix (16 floats) or only the upper 3x4 part of it (12 floats).
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_QUAT_KERNELS_
+#define _GLGE_QUAT_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief compute the 3x3 rotation matrices of Pack::Width normalized quaternions
+ * 
+ * The operations are exactly the same as in Quaternion::toMat3()
+ * 
+ * @param q the w, x, y and z parts of the quaternions
+ * @param r an array to write the 9 elements of the matrices to (row major)
+ */
+inline void quatToRotation(const Pack* q, Pack* r) noexcept {
+    Pack x2 = q[1] + q[1], y2 = q[2] + q[2], z2 = q[3] + q[3];
+    Pack xx = q[1] * x2, yy = q[2] * y2, zz = q[3] * z2;
+    Pack xy = q[1] * y2, xz = q[1] * z2, yz = q[2] * z2;
+    Pack wx = q[0] * x2, wy = q[0] * y2, wz = q[0] * z2;
+    Pack one = set1(1.f);
+    r[0] = one - (yy + zz); r[1] = xy - wz;          r[2] = xz + wy;
+    r[3] = xy + wz;         r[4] = one - (xx + zz);  r[5] = yz - wx;
+    r[6] = xz - wy;         r[7] = yz + wx;          r[8] = one - (xx + yy);
+}
+
+/**
+ * @brief convert Pack::Width rotation matrices to quaternions using Shepperd's method
+ * 
+ * Shepperd's method computes the quaternion part with the largest magnitude from the diagonal and the other parts from
+ * the off-diagonal elements, which keeps the division away from zero. The case is selected per lane without branches.
+ * The operations are exactly the same as in Quaternion::fromRotation(), the result always has a positive real part
+ * 
+ * @param m the 9 elements of the matrices (row major)
+ * @param q an array to write the w, x, y and z parts of the quaternions to
+ */
+inline void rotationToQuat(const Pack* m, Pack* q) noexcept {
+    Pack one = set1(1.f);
+    //select the largest of 4w^2 = 1 + trace, 4x^2 = 1 + 2m00 - trace, ... by comparing the trace to the diagonal
+    Pack trace = (m[0] + m[4]) + m[8];
+    Pack c1 = greaterThan(m[0], trace);
+    Pack best = max(m[0], trace);
+    Pack c2 = greaterThan(m[4], best);
+    best = max(m[4], best);
+    Pack c3 = greaterThan(m[8], best);
+
+    //four times the square of the largest part
+    Pack t = select(c3, (one + m[8]) - (m[0] + m[4]),
+             select(c2, (one + m[4]) - (m[0] + m[8]),
+             select(c1, (one + m[0]) - (m[4] + m[8]), one + trace)));
+    Pack s = set1(0.5f) / sqrt(t);
+
+    //the sums and differences of the off-diagonal elements
+    Pack a = m[7] - m[5], b = m[2] - m[6], c = m[3] - m[1];
+    Pack d = m[1] + m[3], e = m[2] + m[6], f = m[5] + m[7];
+    q[0] = select(c3, c, select(c2, b, select(c1, a, t))) * s;
+    q[1] = select(c3, e, select(c2, d, select(c1, t, a))) * s;
+    q[2] = select(c3, f, select(c2, t, select(c1, d, b))) * s;
+    q[3] = select(c3, t, select(c2, f, select(c1, e, c))) * s;
+
+    //q and -q are the same rotation, flip the signs so the real part is positive
+    Pack sign = bitAnd(q[0], set1(-0.f));
+    for (size_t k = 0; k < 4; ++k)
+    {q[k] = bitXor(q[k], sign);}
+}
+
+//without SIMD a pack holds a single float, so a row of a matrix is loaded like an interleaved vector
+#if GLGE_KERNEL_LEVEL >= 1
+
+/**
+ * @brief transpose the 4x4 blocks of floats formed by the groups of 4 floats (128 bit lanes) of four packs
+ * 
+ * @param r the packs to transpose
+ */
+inline void transposeQuads(Pack* r) noexcept {
+    Pack t0 = shuffle<0,1,0,1>(r[0], r[1]);
+    Pack t1 = shuffle<2,3,2,3>(r[0], r[1]);
+    Pack t2 = shuffle<0,1,0,1>(r[2], r[3]);
+    Pack t3 = shuffle<2,3,2,3>(r[2], r[3]);
+    r[0] = shuffle<0,2,0,2>(t0, t2);
+    r[1] = shuffle<1,3,1,3>(t0, t2);
+    r[2] = shuffle<0,2,0,2>(t1, t3);
+    r[3] = shuffle<1,3,1,3>(t1, t3);
+}
+
+#endif
+
+/**
+ * @brief load the same row of Pack::Width matrices and split it into one pack per column
+ * 
+ * Every group of 4 floats holds the row of 4 neighbouring matrices after the transpose, so the groups of a pack are loaded 
+ * from matrices that are 4 apart. This keeps the order of the matrices without moving floats between the groups
+ * 
+ * @tparam Stride the amount of floats per matrix
+ * @param p a pointer to the row of the first matrix
+ * @param c an array of 4 packs to write the columns to
+ */
+template <size_t Stride> inline void loadRows(const float* p, Pack* c) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    for (size_t k = 0; k < 4; ++k)
+    {c[k] = loadQuads(p + k*Stride, 4*Stride);}
+    transposeQuads(c);
+    #else
+    loadVectors<4>(p, c);
+    #endif
+}
+
+/**
+ * @brief store one pack per column as the same row of Pack::Width matrices
+ * 
+ * @tparam Stride the amount of floats per matrix
+ * @param p a pointer to the row of the first matrix
+ * @param c the 4 columns to store, they are overwritten
+ */
+template <size_t Stride> inline void storeRows(float* p, Pack* c) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    transposeQuads(c);
+    for (size_t k = 0; k < 4; ++k)
+    {storeQuads(p + k*Stride, 4*Stride, c[k]);}
+    #else
+    storeVectors<4>(p, c);
+    #endif
+}
+
+/**
+ * @brief convert a range of normalized quaternions to rotation matrices
+ * 
+ * @tparam Stride the amount of floats per matrix. 16 : full 4x4 matrices | 12 : only the upper 3x4 part is written
+ * @param in a pointer to the interleaved floats of the quaternions
+ * @param out a pointer to write the matrices to
+ * @param n the amount of quaternions to convert
+ */
+template <size_t Stride> void quatToMat(const float* in, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack q[4];
+        loadVectors<4>(in + i*4, q);
+        Pack r[9];
+        quatToRotation(q, r);
+
+        //write the rows of all matrices, the translation column is 0
+        for (size_t row = 0; row < 3; ++row) {
+            Pack c[4] = {r[row*3], r[row*3 + 1], r[row*3 + 2], set1(0.f)};
+            storeRows<Stride>(out + i*Stride + row*4, c);
+        }
+        if (Stride == 16) {
+            Pack c[4] = {set1(0.f), set1(0.f), set1(0.f), set1(1.f)};
+            storeRows<Stride>(out + i*Stride + 12, c);
+        }
+    }
+
+    //the remaining quaternions are padded with identity quaternions to fill the registers
+    if (i < n) {
+        float tmp[4 * Pack::Width];
+        float mats[Stride * Pack::Width];
+        for (size_t j = 0; j < 4 * Pack::Width; ++j) 
+        {tmp[j] = (j % 4 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < (n - i) * 4; ++j) 
+        {tmp[j] = in[i*4 + j];}
+        quatToMat<Stride>(tmp, mats, Pack::Width);
+        for (size_t j = 0; j < (n - i) * Stride; ++j) 
+        {out[i*Stride + j] = mats[j];}
+    }
+}
+
+/**
+ * @brief convert the rotation part of a range of matrices to quaternions
+ * 
+ * @tparam Stride the amount of floats per matrix. 16 : full 4x4 matrices | 12 : only the upper 3x4 part is stored
+ * @param in a pointer to the matrices
+ * @param out a pointer to write the interleaved floats of the quaternions to
+ * @param n the amount of matrices to convert
+ */
+template <size_t Stride> void quatFromMat(const float* in, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        //load the rows of all matrices, the translation column is dropped
+        Pack m[9];
+        for (size_t row = 0; row < 3; ++row) {
+            Pack c[4];
+            loadRows<Stride>(in + i*Stride + row*4, c);
+            m[row*3] = c[0]; m[row*3 + 1] = c[1]; m[row*3 + 2] = c[2];
+        }
+        Pack q[4];
+        rotationToQuat(m, q);
+        storeVectors<4>(out + i*4, q);
+    }
+
+    //the remaining matrices are padded with identity matrices to fill the registers
+    if (i < n) {
+        float mats[Stride * Pack::Width];
+        float tmp[4 * Pack::Width];
+        for (size_t j = 0; j < Stride * Pack::Width; ++j) 
+        {mats[j] = ((j % Stride) % 5 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < (n - i) * Stride; ++j) 
+        {mats[j] = in[i*Stride + j];}
+        quatFromMat<Stride>(mats, tmp, Pack::Width);
+        for (size_t j = 0; j < (n - i) * 4; ++j) 
+        {out[i*4 + j] = tmp[j];}
+    }
+}
+
+/**
+ * @brief the coefficients of the series of sin(t a) / sin(a) in cos(a) - 1 that is used for slerp
+ * 
+ * The factors of the terms are u[i] * t^2 - v[i] with u[i] = 1 / (i (2i + 1)) and v[i] = i / (2i + 1) for i = 1 ... 6. The 
+ * last pair is scaled by 1.15 to make up for the truncated terms (see "A Fast and Accurate Algorithm for Computing SLERP" 
+ * by D. Eberly). For angles up to pi / 4 the error of the series is below 1e-8
+ */
+static const float slerpU[6] = {1.f/3.f, 1.f/10.f, 1.f/21.f, 1.f/36.f, 1.f/55.f, 1.15f/78.f};
+static const float slerpV[6] = {1.f/3.f, 2.f/5.f, 3.f/7.f, 4.f/9.f, 5.f/11.f, 1.15f*6.f/13.f};
+
+/**
+ * @brief blend Pack::Width pairs of normalized quaternions along the shortest path
+ * 
+ * The second quaternion is negated if the quaternions lie in opposite half spaces, so the blend never takes the long way 
+ * around. nlerp blends linearly and normalizes the result. 
+ * slerp computes the weights sin((1 - t) a) / sin(a) and sin(t a) / sin(a) with a polynomial in cos(a) instead of calling 
+ * acos and sin. The polynomial converges slowly for large angles, so the blend is split at the half way quaternion 
+ * m = (a + b) / |a + b| and only the half that contains t is interpolated, which halves the angle
+ * 
+ * @tparam Slerp true : spherical linear interpolation | false : normalized linear interpolation
+ * @param a the w, x, y and z parts of the quaternions to blend from
+ * @param b the w, x, y and z parts of the quaternions to blend to
+ * @param t the blend weights (0 : a, 1 : b)
+ * @param r an array to write the w, x, y and z parts of the blended quaternions to
+ */
+template <bool Slerp> inline void quatBlend(const Pack* a, const Pack* b, Pack t, Pack* r) noexcept {
+    //the cosine of the angle between the quaternions, its sign selects the shortest path
+    Pack d = fma(a[3], b[3], fma(a[2], b[2], fma(a[1], b[1], a[0] * b[0])));
+    Pack sign = bitAnd(d, set1(-0.f));
+    Pack one = set1(1.f);
+    Pack wa = one - t;
+    Pack wb = t;
+
+    if (Slerp) {
+        //m = (a + b) * k and the cosine of the half angle is sqrt((1 + d) / 2)
+        Pack h = one + bitXor(d, sign);
+        Pack k = one / sqrt(h + h);
+        Pack x = sqrt(h * set1(0.5f)) - one;
+        //the weight inside the half, 2t for the first half and 2t - 1 for the second half
+        Pack low = lessThan(t, set1(0.5f));
+        Pack u = select(low, t + t, (t + t) - one);
+        Pack sa = one - u, sb = u;
+
+        //sum the series for both weights at once
+        Pack ta = sa, tb = sb;
+        Pack qa = sa * sa, qb = sb * sb;
+        for (size_t i = 0; i < 6; ++i) {
+            Pack cu = set1(slerpU[i]), cv = set1(slerpV[i]);
+            ta = ta * ((cu * qa - cv) * x);
+            tb = tb * ((cu * qb - cv) * x);
+            sa = sa + ta;
+            sb = sb + tb;
+        }
+
+        //express the blend between a and m or m and b as a blend between a and b
+        wa = select(low, fma(sb, k, sa), sa * k);
+        wb = select(low, sb * k, fma(sa, k, sb));
+    }
+
+    wb = bitXor(wb, sign);
+    for (size_t k = 0; k < 4; ++k)
+    {r[k] = fma(b[k], wb, a[k] * wa);}
+
+    if (!Slerp) {
+        Pack l = sqrt(fma(r[3], r[3], fma(r[2], r[2], fma(r[1], r[1], r[0] * r[0]))));
+        for (size_t k = 0; k < 4; ++k)
+        {r[k] = r[k] / l;}
+    }
+}
+
+/**
+ * @brief blend a range of pairs of normalized quaternions with a weight per pair
+ * 
+ * @tparam Slerp true : spherical linear interpolation | false : normalized linear interpolation
+ * @param a a pointer to the interleaved floats of the quaternions to blend from
+ * @param b a pointer to the interleaved floats of the quaternions to blend to
+ * @param t a pointer to the blend weights
+ * @param out a pointer to write the interleaved floats of the blended quaternions to (may be a or b)
+ * @param n the amount of quaternions to blend
+ */
+template <bool Slerp> void quatBlendArray(const float* a, const float* b, const float* t, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack qa[4], qb[4], r[4];
+        loadVectors<4>(a + i*4, qa);
+        loadVectors<4>(b + i*4, qb);
+        quatBlend<Slerp>(qa, qb, loadu(t + i), r);
+        storeVectors<4>(out + i*4, r);
+    }
+
+    //the remaining quaternions are padded with identity quaternions to fill the registers
+    if (i < n) {
+        float ta[4 * Pack::Width], tb[4 * Pack::Width], tt[Pack::Width];
+        for (size_t j = 0; j < 4 * Pack::Width; ++j) 
+        {ta[j] = tb[j] = (j % 4 == 0) ? 1.f : 0.f;}
+        for (size_t j = 0; j < Pack::Width; ++j) 
+        {tt[j] = 0.f;}
+        for (size_t j = 0; j < (n - i) * 4; ++j) 
+        {ta[j] = a[i*4 + j]; tb[j] = b[i*4 + j];}
+        for (size_t j = 0; j < n - i; ++j) 
+        {tt[j] = t[i + j];}
+        quatBlendArray<Slerp>(ta, tb, tt, ta, Pack::Width);
+        for (size_t j = 0; j < (n - i) * 4; ++j) 
+        {out[i*4 + j] = ta[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
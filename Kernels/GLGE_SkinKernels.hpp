@@ -0,0 +1,298 @@
+/**
+ * @file GLGE_SkinKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels that deform the vertices of a mesh by the bones of a skeleton
+ * 
+ * Every vertex is influenced by exactly 4 bones, the indices of the bones and the weights of a vertex are stored next to
+ * each other. Unused influences have a weight of 0. The positions and normals are stored as one stream per axis, so the
+ * streams must be aligned to and padded to GLGE_MATH_SOA_ALIGNMENT bytes.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_SKIN_KERNELS_
+#define _GLGE_SKIN_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include the quaternion kernels for the transpose of groups of 4 floats
+#include "GLGE_QuatKernels.hpp"
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief load the dual quaternions of a single influence of Pack::Width vertices and split them into one pack per part
+ * 
+ * The real and the dual quaternion of a bone are loaded as a group of 4 floats each. The groups of a pack are loaded
+ * for vertices that are 4 apart, so the transpose keeps the order of the vertices (see loadRows)
+ * 
+ * @param bones a pointer to the dual quaternions of the bones (8 floats per bone)
+ * @param joints a pointer to the 4 bone indices of the first vertex
+ * @param k the index of the influence (0 - 3)
+ * @param real an array of 4 packs to write the real parts (w, x, y, z) to
+ * @param dual an array of 4 packs to write the dual parts (w, x, y, z) to
+ */
+inline void loadInfluence(const float* bones, const uint32_t* joints, size_t k, Pack* real, Pack* dual) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    const size_t groups = Pack::Width / 4;
+    for (size_t r = 0; r < 4; ++r) {
+        const float* pr[groups];
+        const float* pd[groups];
+        for (size_t g = 0; g < groups; ++g) {
+            pr[g] = bones + 8*(size_t)joints[4*(4*g + r) + k];
+            pd[g] = pr[g] + 4;
+        }
+        real[r] = gatherQuads(pr);
+        dual[r] = gatherQuads(pd);
+    }
+    transposeQuads(real);
+    transposeQuads(dual);
+    #else
+    const float* p = bones + 8*(size_t)joints[k];
+    for (size_t c = 0; c < 4; ++c)
+    {real[c] = set1(p[c]); dual[c] = set1(p[4 + c]);}
+    #endif
+}
+
+/**
+ * @brief rotate Pack::Width 3D vectors by normalized quaternions
+ * 
+ * Computes v + w t + q x t with t = 2 (q x v), like Quaternion::rotate(const vec3&)
+ * 
+ * @param q the w, x, y and z parts of the quaternions
+ * @param v the x, y and z axis of the vectors, they are overwritten by the rotated vectors
+ */
+inline void rotateVectors(const Pack* q, Pack* v) noexcept {
+    Pack tx = set1(2.f) * (q[2]*v[2] - q[3]*v[1]);
+    Pack ty = set1(2.f) * (q[3]*v[0] - q[1]*v[2]);
+    Pack tz = set1(2.f) * (q[1]*v[1] - q[2]*v[0]);
+    v[0] = fma(q[0], tx, v[0]) + (q[2]*tz - q[3]*ty);
+    v[1] = fma(q[0], ty, v[1]) + (q[3]*tx - q[1]*tz);
+    v[2] = fma(q[0], tz, v[2]) + (q[1]*ty - q[2]*tx);
+}
+
+/**
+ * @brief deform Pack::Width vertices by blending the dual quaternions of their bones
+ * 
+ * All influences are flipped into the hemisphere of the first one before they are added, so the blend takes the shortest
+ * path (antipodality). The blended dual quaternion is normalized and then applied to the position and the normal
+ * 
+ * @param bones a pointer to the normalized dual quaternions of the bones (8 floats per bone)
+ * @param joints a pointer to the 4 bone indices of the first vertex
+ * @param weights a pointer to the 4 weights of the first vertex
+ * @param pos the x, y and z axis of the positions, they are overwritten by the deformed positions
+ * @param nrm the x, y and z axis of the normals, they are overwritten by the deformed normals. NULL to skip the normals
+ */
+inline void dqSkinPack(const float* bones, const uint32_t* joints, const float* weights, Pack* pos, Pack* nrm) noexcept {
+    Pack w[4];
+    loadVectors<4>(weights, w);
+
+    //blend the weighted dual quaternions
+    Pack r[4], d[4];
+    loadInfluence(bones, joints, 0, r, d);
+    Pack pivot[4] = {r[0], r[1], r[2], r[3]};
+    for (size_t c = 0; c < 4; ++c)
+    {r[c] = r[c] * w[0]; d[c] = d[c] * w[0];}
+    for (size_t k = 1; k < 4; ++k) {
+        Pack qr[4], qd[4];
+        loadInfluence(bones, joints, k, qr, qd);
+        //flip the weight if the bone lies in the other hemisphere
+        Pack dot = fma(pivot[0], qr[0], fma(pivot[1], qr[1], fma(pivot[2], qr[2], pivot[3] * qr[3])));
+        Pack wk = bitXor(w[k], bitAnd(dot, set1(-0.f)));
+        for (size_t c = 0; c < 4; ++c)
+        {r[c] = fma(wk, qr[c], r[c]); d[c] = fma(wk, qd[c], d[c]);}
+    }
+
+    //normalize by the length of the real part
+    Pack inv = set1(1.f) / sqrt(fma(r[0], r[0], fma(r[1], r[1], fma(r[2], r[2], r[3] * r[3]))));
+    for (size_t c = 0; c < 4; ++c)
+    {r[c] = r[c] * inv; d[c] = d[c] * inv;}
+
+    //the translation is 2 (w_r d - w_d r + r x d) for the imaginary parts r and d
+    Pack t[3] = {
+        fma(r[0], d[1], (r[2]*d[3] - r[3]*d[2])) - d[0]*r[1],
+        fma(r[0], d[2], (r[3]*d[1] - r[1]*d[3])) - d[0]*r[2],
+        fma(r[0], d[3], (r[1]*d[2] - r[2]*d[1])) - d[0]*r[3]
+    };
+    rotateVectors(r, pos);
+    for (size_t c = 0; c < 3; ++c)
+    {pos[c] = fma(set1(2.f), t[c], pos[c]);}
+    if (nrm) {rotateVectors(r, nrm);}
+}
+
+/**
+ * @brief load the weighted sum of the bone matrices of Pack::Width vertices and split it into one pack per element
+ * 
+ * The rows of the matrices are blended as groups of 4 floats before they are transposed, so only the 3 blended rows are 
+ * transposed instead of the rows of every influence. The groups of a pack belong to vertices that are 4 apart (see loadRows)
+ * 
+ * @tparam Stride the amount of floats per bone matrix (16 for a mat4, 12 for a packed 3x4 matrix)
+ * @param palette a pointer to the bone matrices, stored row by row
+ * @param joints a pointer to the 4 bone indices of the first vertex
+ * @param weights a pointer to the 4 weights of the first vertex
+ * @param m an array of 12 packs to write the upper 3x4 part of the blended matrices to (row major)
+ */
+template <size_t Stride> inline void blendMatrices(const float* palette, const uint32_t* joints, const float* weights, Pack* m) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    const size_t groups = Pack::Width / 4;
+    Pack rows[3][4];
+    for (size_t r = 0; r < 4; ++r) {
+        const float* pw[groups];
+        for (size_t g = 0; g < groups; ++g) {pw[g] = weights + 4*(4*g + r);}
+        Pack w = gatherQuads(pw);
+        //broadcast the weight of every influence within the groups
+        Pack wk[4] = {shuffle<0,0,0,0>(w, w), shuffle<1,1,1,1>(w, w), shuffle<2,2,2,2>(w, w), shuffle<3,3,3,3>(w, w)};
+        for (size_t k = 0; k < 4; ++k) {
+            const float* pm[groups];
+            for (size_t g = 0; g < groups; ++g) {pm[g] = palette + Stride*(size_t)joints[4*(4*g + r) + k];}
+            for (size_t row = 0; row < 3; ++row) {
+                const float* pr[groups];
+                for (size_t g = 0; g < groups; ++g) {pr[g] = pm[g] + 4*row;}
+                rows[row][r] = (k == 0) ? wk[0] * gatherQuads(pr) : fma(wk[k], gatherQuads(pr), rows[row][r]);
+            }
+        }
+    }
+    for (size_t row = 0; row < 3; ++row) {
+        transposeQuads(rows[row]);
+        for (size_t c = 0; c < 4; ++c) {m[row*4 + c] = rows[row][c];}
+    }
+    #else
+    for (size_t e = 0; e < 12; ++e) {m[e] = set1(weights[0] * palette[Stride*(size_t)joints[0] + e]);}
+    for (size_t k = 1; k < 4; ++k) {
+        const float* pm = palette + Stride*(size_t)joints[k];
+        for (size_t e = 0; e < 12; ++e) {m[e] = fma(set1(weights[k]), set1(pm[e]), m[e]);}
+    }
+    #endif
+}
+
+/**
+ * @brief deform Pack::Width vertices by the weighted sum of the matrices of their bones (linear blend skinning)
+ * 
+ * The normals are transformed by the upper 3x3 part of the blended matrix, so the bones should not be scaled non-uniformly. 
+ * The normals are not normalized again
+ * 
+ * @tparam Stride the amount of floats per bone matrix (16 for a mat4, 12 for a packed 3x4 matrix)
+ * @param palette a pointer to the bone matrices, stored row by row
+ * @param joints a pointer to the 4 bone indices of the first vertex
+ * @param weights a pointer to the 4 weights of the first vertex
+ * @param pos the x, y and z axis of the positions, they are overwritten by the deformed positions
+ * @param nrm the x, y and z axis of the normals, they are overwritten by the deformed normals. NULL to skip the normals
+ */
+template <size_t Stride> inline void lbsSkinPack(const float* palette, const uint32_t* joints, const float* weights, Pack* pos, Pack* nrm) noexcept {
+    Pack m[12];
+    blendMatrices<Stride>(palette, joints, weights, m);
+    Pack p[3] = {pos[0], pos[1], pos[2]};
+    for (size_t row = 0; row < 3; ++row) 
+    {pos[row] = fma(m[row*4], p[0], fma(m[row*4 + 1], p[1], fma(m[row*4 + 2], p[2], m[row*4 + 3])));}
+    if (nrm) {
+        Pack v[3] = {nrm[0], nrm[1], nrm[2]};
+        for (size_t row = 0; row < 3; ++row) 
+        {nrm[row] = fma(m[row*4], v[0], fma(m[row*4 + 1], v[1], m[row*4 + 2] * v[2]));}
+    }
+}
+
+/**
+ * @brief deform the vertices of a mesh by the bones they are bound to
+ * 
+ * @tparam Stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ * @tparam F the type of the function that deforms a pack of vertices
+ * @param joints a pointer to the 4 bone indices of every vertex
+ * @param weights a pointer to the 4 weights of every vertex, the weights of a vertex should add up to 1
+ * @param pos the 3 streams of the positions
+ * @param nrm the 3 streams of the normals or NULL to skip the normals
+ * @param outPos the 3 streams to write the deformed positions to (may be pos)
+ * @param outNrm the 3 streams to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param n the amount of vertices to deform
+ * @param deform the function that deforms a pack of vertices given the pointers to their bone indices and weights
+ */
+template <bool Stream, typename F> inline void skinVertices(const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm,
+                                                           float* const* outPos, float* const* outNrm, size_t n, F deform) noexcept {
+    //the influences are not padded, so the last vertices read them from a padded copy
+    uint32_t tailJoints[4 * Pack::Width];
+    float tailWeights[4 * Pack::Width];
+    for (size_t i = 0; i < n; i += Pack::Width) {
+        const uint32_t* j = joints + 4*i;
+        const float* w = weights + 4*i;
+        if (i + Pack::Width > n) {
+            //the padding vertices are fully bound to the first bone, so the blend never divides by 0
+            for (size_t v = 0; v < 4 * Pack::Width; ++v)
+            {tailJoints[v] = 0; tailWeights[v] = (v % 4 == 0) ? 1.f : 0.f;}
+            for (size_t v = 0; v < 4 * (n - i); ++v)
+            {tailJoints[v] = j[v]; tailWeights[v] = w[v];}
+            j = tailJoints;
+            w = tailWeights;
+        }
+
+        Pack p[3], nr[3];
+        for (size_t c = 0; c < 3; ++c) {p[c] = load(pos[c] + i);}
+        if (nrm)
+        {for (size_t c = 0; c < 3; ++c) {nr[c] = load(nrm[c] + i);}}
+        deform(j, w, p, nrm ? nr : NULL);
+        for (size_t c = 0; c < 3; ++c) 
+        {if (Stream) {stream(outPos[c] + i, p[c]);} else {store(outPos[c] + i, p[c]);}}
+        if (nrm) {
+            for (size_t c = 0; c < 3; ++c) 
+            {if (Stream) {stream(outNrm[c] + i, nr[c]);} else {store(outNrm[c] + i, nr[c]);}}
+        }
+    }
+    if (Stream) {fence();}
+}
+
+/**
+ * @brief deform the vertices of a mesh using dual quaternion skinning
+ * 
+ * @tparam Stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ * @param bones a pointer to the normalized dual quaternions of the bones (8 floats per bone, real part first)
+ * @param joints a pointer to the 4 bone indices of every vertex
+ * @param weights a pointer to the 4 weights of every vertex, the weights of a vertex should add up to 1
+ * @param pos the 3 streams of the positions
+ * @param nrm the 3 streams of the normals or NULL to skip the normals
+ * @param outPos the 3 streams to write the deformed positions to (may be pos)
+ * @param outNrm the 3 streams to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param n the amount of vertices to deform
+ */
+template <bool Stream> void dqSkin(const float* bones, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm,
+                                   float* const* outPos, float* const* outNrm, size_t n) noexcept {
+    skinVertices<Stream>(joints, weights, pos, nrm, outPos, outNrm, n, 
+        [bones](const uint32_t* j, const float* w, Pack* p, Pack* nr) {dqSkinPack(bones, j, w, p, nr);});
+}
+
+/**
+ * @brief deform the vertices of a mesh using linear blend skinning
+ * 
+ * @tparam Stride the amount of floats per bone matrix (16 for a mat4, 12 for a packed 3x4 matrix)
+ * @tparam Stream true : the deformed vertices are written using non-temporal stores | false : normal stores are used
+ * @param palette a pointer to the bone matrices, stored row by row
+ * @param joints a pointer to the 4 bone indices of every vertex
+ * @param weights a pointer to the 4 weights of every vertex, the weights of a vertex should add up to 1
+ * @param pos the 3 streams of the positions
+ * @param nrm the 3 streams of the normals or NULL to skip the normals
+ * @param outPos the 3 streams to write the deformed positions to (may be pos)
+ * @param outNrm the 3 streams to write the deformed normals to (may be nrm), only used if nrm is not NULL
+ * @param n the amount of vertices to deform
+ */
+template <size_t Stride, bool Stream> void lbsSkin(const float* palette, const uint32_t* joints, const float* weights, const float* const* pos, const float* const* nrm,
+                                                   float* const* outPos, float* const* outNrm, size_t n) noexcept {
+    skinVertices<Stream>(joints, weights, pos, nrm, outPos, outNrm, n, 
+        [palette](const uint32_t* j, const float* w, Pack* p, Pack* nr) {lbsSkinPack<Stride>(palette, j, w, p, nr);});
+}
+
+};
+};
+};
+
+#endif
+
+#endif
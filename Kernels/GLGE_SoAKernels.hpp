@@ -0,0 +1,260 @@
+/**
+ * @file GLGE_SoAKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for the structure of arrays vector containers
+ * 
+ * All kernels work on N separate streams of floats (one per axis). The streams must be aligned to GLGE_MATH_SOA_ALIGNMENT and 
+ * padded to a multiple of GLGE_MATH_SOA_ALIGNMENT bytes, so the kernels can always process full packs. 
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_SOA_KERNELS_
+#define _GLGE_SOA_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include memcpy for the tails of non-padded outputs
+#include <string.h>
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief write a pack to an array that is not padded
+ * 
+ * @param out a pointer to the location to write the pack to
+ * @param r the pack to write
+ * @param count the amount of floats that are still available in the array
+ */
+inline void storePartial(float* out, Pack r, size_t count) noexcept {
+    if (count >= Pack::Width) {storeu(out, r); return;}
+    //write the full pack to a temporary and only copy the valid floats
+    alignas(GLGE_MATH_SOA_ALIGNMENT) float tmp[Pack::Width];
+    store(tmp, r);
+    memcpy(out, tmp, count * sizeof(float));
+}
+
+/**
+ * @brief add the streams of two containers
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the first container
+ * @param b the streams of the second container
+ * @param out the streams to write the sums to (may be a or b)
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaAdd(const float* const* a, const float* const* b, float* const* out, size_t n) noexcept {
+    //the streams are independent, so each one is processed as a single flat loop
+    for (size_t c = 0; c < N; ++c) {
+        const float* pa = a[c];
+        const float* pb = b[c];
+        float* po = out[c];
+        for (size_t i = 0; i < n; i += Pack::Width) 
+        {store(po + i, load(pa + i) + load(pb + i));}
+    }
+}
+
+/**
+ * @brief subtract the streams of two containers
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the container to subtract from
+ * @param b the streams of the container to subtract
+ * @param out the streams to write the differences to (may be a or b)
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaSubtract(const float* const* a, const float* const* b, float* const* out, size_t n) noexcept {
+    //the streams are independent, so each one is processed as a single flat loop
+    for (size_t c = 0; c < N; ++c) {
+        const float* pa = a[c];
+        const float* pb = b[c];
+        float* po = out[c];
+        for (size_t i = 0; i < n; i += Pack::Width) 
+        {store(po + i, load(pa + i) - load(pb + i));}
+    }
+}
+
+/**
+ * @brief multiply the streams of two containers element wise
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the first container
+ * @param b the streams of the second container
+ * @param out the streams to write the products to (may be a or b)
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaMultiply(const float* const* a, const float* const* b, float* const* out, size_t n) noexcept {
+    //the streams are independent, so each one is processed as a single flat loop
+    for (size_t c = 0; c < N; ++c) {
+        const float* pa = a[c];
+        const float* pb = b[c];
+        float* po = out[c];
+        for (size_t i = 0; i < n; i += Pack::Width) 
+        {store(po + i, load(pa + i) * load(pb + i));}
+    }
+}
+
+/**
+ * @brief compute a * b + c for the streams of three containers
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the first factor
+ * @param b the streams of the second factor
+ * @param c the streams of the summand
+ * @param out the streams to write the results to (may be a, b or c)
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaFma(const float* const* a, const float* const* b, const float* const* c, float* const* out, size_t n) noexcept {
+    //the streams are independent, so each one is processed as a single flat loop
+    for (size_t s = 0; s < N; ++s) {
+        const float* pa = a[s];
+        const float* pb = b[s];
+        const float* pc = c[s];
+        float* po = out[s];
+        for (size_t i = 0; i < n; i += Pack::Width) 
+        {store(po + i, fma(load(pa + i), load(pb + i), load(pc + i)));}
+    }
+}
+
+/**
+ * @brief compute the dot products of a single pack of elements
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the first container
+ * @param b the streams of the second container
+ * @param i the index of the first element of the pack
+ * @return Pack the dot products
+ */
+template <size_t N> inline Pack soaDotPack(const float* const* a, const float* const* b, size_t i) noexcept {
+    Pack d = load(a[0] + i) * load(b[0] + i);
+    for (size_t c = 1; c < N; ++c) 
+    {d = fma(load(a[c] + i), load(b[c] + i), d);}
+    return d;
+}
+
+/**
+ * @brief compute the dot products of the elements of two containers
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the first container
+ * @param b the streams of the second container
+ * @param out a pointer to an array with n floats to write the dot products to
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaDot(const float* const* a, const float* const* b, float* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; i += Pack::Width) 
+    {storePartial(out + i, soaDotPack<N>(a, b, i), n - i);}
+}
+
+/**
+ * @brief compute the lengths of the elements of a container
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the container
+ * @param out a pointer to an array with n floats to write the lengths to
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaLength(const float* const* a, float* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; i += Pack::Width) 
+    {storePartial(out + i, sqrt(soaDotPack<N>(a, a, i)), n - i);}
+}
+
+/**
+ * @brief normalize the elements of a container
+ * 
+ * @tparam N the amount of streams (axis) per container
+ * @param a the streams of the container
+ * @param out the streams to write the normalized elements to (may be a)
+ * @param n the amount of elements per stream
+ */
+template <size_t N> void soaNormalize(const float* const* a, float* const* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; i += Pack::Width) {
+        Pack len = sqrt(soaDotPack<N>(a, a, i));
+        for (size_t c = 0; c < N; ++c) 
+        {store(out[c] + i, load(a[c] + i) / len);}
+    }
+}
+
+/**
+ * @brief compute the cross products of the elements of two 3D containers
+ * 
+ * @param a the streams of the first container
+ * @param b the streams of the second container
+ * @param out the streams to write the cross products to (may be a or b)
+ * @param n the amount of elements per stream
+ */
+inline void soaCross(const float* const* a, const float* const* b, float* const* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; i += Pack::Width) {
+        Pack ax = load(a[0] + i), ay = load(a[1] + i), az = load(a[2] + i);
+        Pack bx = load(b[0] + i), by = load(b[1] + i), bz = load(b[2] + i);
+        store(out[0] + i, ay*bz - az*by);
+        store(out[1] + i, az*bx - ax*bz);
+        store(out[2] + i, ax*by - ay*bx);
+    }
+}
+
+/**
+ * @brief convert interleaved vectors (array of structures) to one stream per axis
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @param in a pointer to the interleaved floats
+ * @param out the streams to write the axis to
+ * @param n the amount of vectors
+ */
+template <size_t N> void soaFromAoS(const float* in, float* const* out, size_t n) noexcept {
+    Pack p[4];
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        loadVectors<N>(in + i*N, p);
+        for (size_t c = 0; c < N; ++c) 
+        {store(out[c] + i, p[c]);}
+    }
+    //copy the remaining vectors one by one
+    for (; i < n; ++i) {
+        for (size_t c = 0; c < N; ++c) 
+        {out[c][i] = in[i*N + c];}
+    }
+}
+
+/**
+ * @brief convert one stream per axis to interleaved vectors (array of structures)
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @param in the streams of the axis
+ * @param out a pointer to write the interleaved floats to
+ * @param n the amount of vectors
+ */
+template <size_t N> void soaToAoS(const float* const* in, float* out, size_t n) noexcept {
+    Pack p[4];
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        for (size_t c = 0; c < N; ++c) 
+        {p[c] = load(in[c] + i);}
+        storeVectors<N>(out + i*N, p);
+    }
+    //copy the remaining vectors one by one
+    for (; i < n; ++i) {
+        for (size_t c = 0; c < N; ++c) 
+        {out[i*N + c] = in[c][i];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @file GLGE_VecKernels.hpp
+ * @author DM8AT
+ * @brief define the batch kernels for arrays of interleaved float vectors (arrays of structures)
+ * 
+ * The exact kernels use a square root and a division like length() and normalize() of the vectors. The fast kernels use
+ * the approximate reciprocal square root of the instruction set refined by a single Newton-Raphson step, see glge::Precision
+ * for the error bounds.
+ * This is an internal header of the library, it is not included by GLGEMath.h
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_VEC_KERNELS_
+#define _GLGE_VEC_KERNELS_
+
+//the kernels are only available for C++
+#if __cplusplus
+
+//include the packs the kernels are written with
+#include "GLGE_KernelPack.hpp"
+//include the limits for the smallest normal float
+#include <cfloat>
+
+namespace glge {
+namespace kernel {
+inline namespace GLGE_KERNEL_NAMESPACE
+{
+
+/**
+ * @brief compute the reciprocal square root using the approximation refined by a single Newton-Raphson step
+ * 
+ * Values below the smallest normal float are clamped to it, so 0 results in a large finite value instead of infinity
+ * 
+ * @param d the values to compute the reciprocal square root of
+ * @return Pack the approximated reciprocal square roots
+ */
+inline Pack rsqrtRefined(Pack d) noexcept {
+    d = max(d, set1(FLT_MIN));
+    Pack y = rsqrt(d);
+    //y * (3 - d * y * y) / 2
+    return y * (set1(1.5f) - (set1(0.5f) * d) * (y * y));
+}
+
+/**
+ * @brief compute the squared lengths of Pack::Width vectors
+ * 
+ * @tparam N the amount of axis per vector
+ * @param v one pack per axis
+ * @return Pack the squared lengths
+ */
+template <size_t N> inline Pack squaredLength(const Pack* v) noexcept {
+    Pack d = v[0] * v[0];
+    for (size_t c = 1; c < N; ++c) 
+    {d = fma(v[c], v[c], d);}
+    return d;
+}
+
+/**
+ * @brief compute the lengths of interleaved vectors
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @tparam Fast true : use the refined approximation | false : use the square root
+ * @param in a pointer to the interleaved floats of the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+template <size_t N, bool Fast> void vecLength(const float* in, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack v[4];
+        loadVectors<N>(in + i*N, v);
+        Pack d = squaredLength<N>(v);
+        storeu(out + i, Fast ? (d * rsqrtRefined(d)) : sqrt(d));
+    }
+
+    //compute the remaining lengths in a padded buffer
+    if (i < n) {
+        size_t count = n - i;
+        float tmp[4 * Pack::Width] = {0};
+        float len[Pack::Width];
+        for (size_t j = 0; j < count*N; ++j) {tmp[j] = in[i*N + j];}
+        vecLength<N, Fast>(tmp, len, Pack::Width);
+        for (size_t j = 0; j < count; ++j) {out[i + j] = len[j];}
+    }
+}
+
+/**
+ * @brief normalize interleaved vectors
+ * 
+ * @tparam N the amount of axis per vector (2, 3 or 4)
+ * @tparam Fast true : multiply by the refined approximation | false : divide by the length
+ * @tparam Padded true : the last axis is a padding element that is written as 0, even for vectors of length 0
+ * @param in a pointer to the interleaved floats of the vectors
+ * @param out a pointer to write the interleaved floats of the normalized vectors to (may be in)
+ * @param n the amount of vectors
+ */
+template <size_t N, bool Fast, bool Padded = false> void vecNormalize(const float* in, float* out, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + Pack::Width <= n; i += Pack::Width) {
+        Pack v[4];
+        loadVectors<N>(in + i*N, v);
+        Pack d = squaredLength<N>(v);
+        if (Fast) {
+            Pack s = rsqrtRefined(d);
+            for (size_t c = 0; c < N; ++c) {v[c] = v[c] * s;}
+        } else {
+            Pack len = sqrt(d);
+            for (size_t c = 0; c < N; ++c) {v[c] = v[c] / len;}
+        }
+        //0 / 0 is NaN, so the padding is cleared after the division
+        if (Padded) {v[N - 1] = set1(0.f);}
+        storeVectors<N>(out + i*N, v);
+    }
+
+    //normalize the remaining vectors in a padded buffer
+    if (i < n) {
+        size_t count = n - i;
+        float tmp[4 * Pack::Width] = {0};
+        for (size_t j = 0; j < count*N; ++j) {tmp[j] = in[i*N + j];}
+        vecNormalize<N, Fast, Padded>(tmp, tmp, Pack::Width);
+        for (size_t j = 0; j < count*N; ++j) {out[i*N + j] = tmp[j];}
+    }
+}
+
+};
+};
+};
+
+#endif
+
+#endif
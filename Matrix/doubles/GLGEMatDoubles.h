@@ -1,7 +1,7 @@
 /**
- * @file GLGEMatFloats.h
+ * @file GLGEMatDoubles.h
  * @author DM8AT
- * @brief include all float matrices
+ * @brief include all double matrices
  * @version 0.1
  * @date 2025-10-11
  * 
@@ -10,8 +10,8 @@
  */
 
 //header guard
-#ifndef _GLGE_MATH_FLOAT_MATRIX_
-#define _GLGE_MATH_FLOAT_MATRIX_
+#ifndef _GLGE_MATH_DOUBLE_MATRIX_
+#define _GLGE_MATH_DOUBLE_MATRIX_
 
 //include 2x2 matrices
 #include "GLGE_dmat2.h"
@@ -11,6 +11,8 @@
 
 //include the 2*2 float matrices
 #include "GLGE_dmat4.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
 
 dmat4 dmat4_add(const dmat4* a, const dmat4* b) {return *a + *b;}
 
@@ -48,4 +50,25 @@ dmat4 dmat4_adjugate(const dmat4* mat) {return mat->adjugate();}
 
 dmat4 dmat4_traspose(const dmat4* mat) {return mat->transpose();}
 
-dmat4 dmat4_inverse(const dmat4* mat) {return mat->inverse();}
\ No newline at end of file
+dmat4 dmat4_inverse(const dmat4* mat) {return mat->inverse();}
+
+dmat4 dmat4_inverseAffine(const dmat4* mat) {return mat->inverseAffine();}
+
+dmat4 dmat4_inverseRigid(const dmat4* mat) {return mat->inverseRigid();}
+
+dmat4 dmat4_inverseUniformScale(const dmat4* mat) {return mat->inverseUniformScale();}
+
+void dmat4_multiplyArray(const dmat4* a, const dmat4* b, dmat4* out, size_t n) 
+{glge::kernel::table().dmat4Multiply((const double*)a, (const double*)b, (double*)out, n);}
+
+void dmat4_inverseArray(const dmat4* in, dmat4* out, size_t n) 
+{glge::kernel::table().dmat4Inverse((const double*)in, (double*)out, n);}
+
+void dmat4_applyArray(const dmat4* mat, const dvec4* in, dvec4* out, size_t n) 
+{glge::kernel::table().dmat4Transform4(mat->m, (const double*)in, (double*)out, n);}
+
+void dmat4_transformPoints(const dmat4* mat, const dvec3* in, dvec3* out, size_t n) 
+{glge::kernel::table().dmat4Transform3(mat->m, (const double*)in, (double*)out, n, sizeof(dvec3) / sizeof(double), true);}
+
+void dmat4_transformDirections(const dmat4* mat, const dvec3* in, dvec3* out, size_t n) 
+{glge::kernel::table().dmat4Transform3(mat->m, (const double*)in, (double*)out, n, sizeof(dvec3) / sizeof(double), false);}
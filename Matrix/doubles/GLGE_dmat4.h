@@ -16,6 +16,16 @@
 //include double 3D vectors
 #include "../../Vector/doubles/GLGE_dvec4.h"
 
+//if SIMD is requested, include SIMD intrinsics
+#include "../../GLGEMath_Settings.h"
+#if GLGE_MATH_USE_SIMD
+#if GLGE_MATH_ALLOW_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
 /**
  * @brief a 4x4 matrix of double elements
  */
@@ -197,12 +207,14 @@ typedef struct s_dmat4
     }
 
     /**
-     * @brief multiply this matrix with another matrix and return the result
+     * @brief multiply this matrix with another matrix using only scalar operations
+     * 
+     * This is the matrix product if SIMD is disabled or during constant evaluation
      * 
      * @param c the other matrix
      * @return s_dmat4 the product of the two matrices
      */
-    inline constexpr s_dmat4 operator*(s_dmat4 c) const noexcept {
+    inline constexpr s_dmat4 scalarProduct(const s_dmat4& c) const noexcept {
         return s_dmat4(
             dvec4(
                 rows[0].x * c.rows[0].x + rows[0].y * c.rows[1].x + rows[0].z * c.rows[2].x + rows[0].w * c.rows[3].x, 
@@ -230,6 +242,81 @@ typedef struct s_dmat4
             )
         );
     }
+
+    //implement the SIMD matrix product
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief multiply this matrix with another matrix and return the result
+     * 
+     * Each row of the product is the row of this matrix times the other matrix. So every element of the row is broadcasted
+     * to all lanes and multiplied with the matching row of the other matrix, then all four products are summed up. 
+     * The product is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+     * 
+     * @param c the other matrix
+     * @return s_dmat4 the product of the two matrices
+     */
+    inline GLGE_MATH_SIMD_CONSTEXPR s_dmat4 operator*(const s_dmat4& c) const noexcept {
+        //intrinsics can't be evaluated at compile time, so constant evaluation uses the scalar product
+        if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return scalarProduct(c);}
+        //check for AVX2 to process a whole row at once
+        #if GLGE_MATH_ALLOW_AVX2
+        //the broadcasts load the elements directly from memory, the sums are fused into the multiplications if FMA3 is allowed
+        auto row = [&c](const double* a) noexcept -> __m256d {
+            __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(a), c.rows[0].simd);
+            #if GLGE_MATH_ALLOW_FMA
+            r = _mm256_fmadd_pd(_mm256_broadcast_sd(a + 1), c.rows[1].simd, r);
+            r = _mm256_fmadd_pd(_mm256_broadcast_sd(a + 2), c.rows[2].simd, r);
+            return _mm256_fmadd_pd(_mm256_broadcast_sd(a + 3), c.rows[3].simd, r);
+            #else
+            r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(a + 1), c.rows[1].simd));
+            r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(a + 2), c.rows[2].simd));
+            return _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(a + 3), c.rows[3].simd));
+            #endif
+        };
+        return s_dmat4(dvec4(row(m)), dvec4(row(m + 4)), dvec4(row(m + 8)), dvec4(row(m + 12)));
+        #else
+        //compute a single row of the product, the lower and upper half of the row are summed up on their own
+        auto row = [&c](const double* a) noexcept -> dvec4 {
+            __m128d a0 = _mm_set1_pd(a[0]);
+            __m128d a1 = _mm_set1_pd(a[1]);
+            __m128d a2 = _mm_set1_pd(a[2]);
+            __m128d a3 = _mm_set1_pd(a[3]);
+            __m128d lo = _mm_mul_pd(a0, c.rows[0].lower);
+            __m128d hi = _mm_mul_pd(a0, c.rows[0].upper);
+            #if GLGE_MATH_ALLOW_FMA
+            lo = _mm_fmadd_pd(a1, c.rows[1].lower, lo);
+            hi = _mm_fmadd_pd(a1, c.rows[1].upper, hi);
+            lo = _mm_fmadd_pd(a2, c.rows[2].lower, lo);
+            hi = _mm_fmadd_pd(a2, c.rows[2].upper, hi);
+            lo = _mm_fmadd_pd(a3, c.rows[3].lower, lo);
+            hi = _mm_fmadd_pd(a3, c.rows[3].upper, hi);
+            #else
+            lo = _mm_add_pd(lo, _mm_mul_pd(a1, c.rows[1].lower));
+            hi = _mm_add_pd(hi, _mm_mul_pd(a1, c.rows[1].upper));
+            lo = _mm_add_pd(lo, _mm_mul_pd(a2, c.rows[2].lower));
+            hi = _mm_add_pd(hi, _mm_mul_pd(a2, c.rows[2].upper));
+            lo = _mm_add_pd(lo, _mm_mul_pd(a3, c.rows[3].lower));
+            hi = _mm_add_pd(hi, _mm_mul_pd(a3, c.rows[3].upper));
+            #endif
+            return dvec4(lo, hi);
+        };
+        return s_dmat4(row(m), row(m + 4), row(m + 8), row(m + 12));
+        #endif
+    }
+
+    #else //else, implement the scalar matrix product
+
+    /**
+     * @brief multiply this matrix with another matrix and return the result
+     * 
+     * @param c the other matrix
+     * @return s_dmat4 the product of the two matrices
+     */
+    inline constexpr s_dmat4 operator*(const s_dmat4& c) const noexcept {return scalarProduct(c);}
+
+    #endif
+
     /**
      * @brief scale the matrix and return the result
      * 
@@ -251,39 +338,55 @@ typedef struct s_dmat4
      * @return dvec4 the product of this matrix and the vector
      */
     inline dvec4 operator*(const dvec4& v) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        //transpose the matrix, so the vector is applied by scaling the columns and summing them up
+        __m256d t0 = _mm256_unpacklo_pd(rows[0].simd, rows[1].simd);
+        __m256d t1 = _mm256_unpackhi_pd(rows[0].simd, rows[1].simd);
+        __m256d t2 = _mm256_unpacklo_pd(rows[2].simd, rows[3].simd);
+        __m256d t3 = _mm256_unpackhi_pd(rows[2].simd, rows[3].simd);
+        __m256d c0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+        __m256d c1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+        __m256d c2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+        __m256d c3 = _mm256_permute2f128_pd(t1, t3, 0x31);
+        //sum up in the same order as the scalar code, the sums are fused into the multiplications if FMA3 is allowed
+        __m256d r = _mm256_mul_pd(c0, _mm256_set1_pd(v.x));
+        #if GLGE_MATH_ALLOW_FMA
+        r = _mm256_fmadd_pd(c1, _mm256_set1_pd(v.y), r);
+        r = _mm256_fmadd_pd(c2, _mm256_set1_pd(v.z), r);
+        return _mm256_fmadd_pd(c3, _mm256_set1_pd(v.w), r);
+        #else
+        r = _mm256_add_pd(r, _mm256_mul_pd(c1, _mm256_set1_pd(v.y)));
+        r = _mm256_add_pd(r, _mm256_mul_pd(c2, _mm256_set1_pd(v.z)));
+        return _mm256_add_pd(r, _mm256_mul_pd(c3, _mm256_set1_pd(v.w)));
+        #endif
+        #else
+        //compute two elements of the product at once by scaling the halves of the columns of the two rows
+        auto half = [&v](const dvec4& r0, const dvec4& r1) noexcept -> __m128d {
+            __m128d r = _mm_mul_pd(_mm_unpacklo_pd(r0.lower, r1.lower), _mm_set1_pd(v.x));
+            r = _mm_add_pd(r, _mm_mul_pd(_mm_unpackhi_pd(r0.lower, r1.lower), _mm_set1_pd(v.y)));
+            r = _mm_add_pd(r, _mm_mul_pd(_mm_unpacklo_pd(r0.upper, r1.upper), _mm_set1_pd(v.z)));
+            return _mm_add_pd(r, _mm_mul_pd(_mm_unpackhi_pd(r0.upper, r1.upper), _mm_set1_pd(v.w)));
+        };
+        return dvec4(half(rows[0], rows[1]), half(rows[2], rows[3]));
+        #endif
+        #else
         return dvec4(
             v.x * rows[0].x + v.y * rows[0].y + v.z * rows[0].z + v.w * rows[0].w,
             v.x * rows[1].x + v.y * rows[1].y + v.z * rows[1].z + v.w * rows[1].w,
             v.x * rows[2].x + v.y * rows[2].y + v.z * rows[2].z + v.w * rows[2].w,
             v.x * rows[3].x + v.y * rows[3].y + v.z * rows[3].z + v.w * rows[3].w
         );
+        #endif
     }
     /**
      * @brief multiply this matrix by another matrix
      * 
-     * @param c the other matrix
+     * @param c the other matrix (may be this matrix, the product is finished before it is stored)
      */
-    inline constexpr void operator*=(s_dmat4 c) noexcept {
-        //create a temporary container for the matrix elements
-        s_dmat4 t = *this;
-        //override the elements with the calculated values
-        rows[0].x = t.rows[0].x * c.rows[0].x + t.rows[0].y * c.rows[1].x + t.rows[0].z * c.rows[2].x + t.rows[0].w * c.rows[3].x; 
-        rows[0].y = t.rows[0].x * c.rows[0].y + t.rows[0].y * c.rows[1].y + t.rows[0].z * c.rows[2].y + t.rows[0].w * c.rows[3].y; 
-        rows[0].z = t.rows[0].x * c.rows[0].z + t.rows[0].y * c.rows[1].z + t.rows[0].z * c.rows[2].z + t.rows[0].w * c.rows[3].z; 
-        rows[0].w = t.rows[0].x * c.rows[0].w + t.rows[0].y * c.rows[1].w + t.rows[0].z * c.rows[2].w + t.rows[0].w * c.rows[3].w;
-        rows[1].x = t.rows[1].x * c.rows[0].x + t.rows[1].y * c.rows[1].x + t.rows[1].z * c.rows[2].x + t.rows[1].w * c.rows[3].x; 
-        rows[1].y = t.rows[1].x * c.rows[0].y + t.rows[1].y * c.rows[1].y + t.rows[1].z * c.rows[2].y + t.rows[1].w * c.rows[3].y; 
-        rows[1].z = t.rows[1].x * c.rows[0].z + t.rows[1].y * c.rows[1].z + t.rows[1].z * c.rows[2].z + t.rows[1].w * c.rows[3].z; 
-        rows[1].w = t.rows[1].x * c.rows[0].w + t.rows[1].y * c.rows[1].w + t.rows[1].z * c.rows[2].w + t.rows[1].w * c.rows[3].w;
-        rows[2].x = t.rows[2].x * c.rows[0].x + t.rows[2].y * c.rows[1].x + t.rows[2].z * c.rows[2].x + t.rows[2].w * c.rows[3].x; 
-        rows[2].y = t.rows[2].x * c.rows[0].y + t.rows[2].y * c.rows[1].y + t.rows[2].z * c.rows[2].y + t.rows[2].w * c.rows[3].y; 
-        rows[2].z = t.rows[2].x * c.rows[0].z + t.rows[2].y * c.rows[1].z + t.rows[2].z * c.rows[2].z + t.rows[2].w * c.rows[3].z; 
-        rows[2].w = t.rows[2].x * c.rows[0].w + t.rows[2].y * c.rows[1].w + t.rows[2].z * c.rows[2].w + t.rows[2].w * c.rows[3].w;
-        rows[3].x = t.rows[3].x * c.rows[0].x + t.rows[3].y * c.rows[1].x + t.rows[3].z * c.rows[2].x + t.rows[3].w * c.rows[3].x; 
-        rows[3].y = t.rows[3].x * c.rows[0].y + t.rows[3].y * c.rows[1].y + t.rows[3].z * c.rows[2].y + t.rows[3].w * c.rows[3].y; 
-        rows[3].z = t.rows[3].x * c.rows[0].z + t.rows[3].y * c.rows[1].z + t.rows[3].z * c.rows[2].z + t.rows[3].w * c.rows[3].z; 
-        rows[3].w = t.rows[3].x * c.rows[0].w + t.rows[3].y * c.rows[1].w + t.rows[3].z * c.rows[2].w + t.rows[3].w * c.rows[3].w;
-    }
+    inline GLGE_MATH_SIMD_CONSTEXPR void operator*=(const s_dmat4& c) noexcept
+    {*this = *this * c;}
+
     /**
      * @brief scale this matrix
      * 
@@ -303,32 +406,28 @@ typedef struct s_dmat4
      */
     inline constexpr double determinant() const noexcept {
         /**
-         * a deterimant of a 4x4 matrix is calculated like this:
-         * det = m[0].x * det(M00) + m[0].y * det(M01) + m[0].z * det(M02) + m[0].w * det(M03)
-         * Where Mxy denotes a 3x3 sub-matrix where the xth column and yth row are deleted
-         * det() is a fictional command to compute the determinant of a 3x3 matrix
-         * 
-         * The determinant of a 3x3 matrix is computed as follows:
-         * m[0].x * (m[1].y * m[2].z - m[1].z * m[2].y) - m[0].y * (m[1].x * m[2].z - m[1].z * m[2].x) + m[0].z * (m[1].x * m[2].y - m[1].y * m[2].x)
-         * 
-         * Now replacing each element with the correct index to fit the sub-matricies:
-         * M00: m[1].y * (m[2].z * m[3].w - m[2].w * m[3].z) - m[1].z * (m[2].y * m[3].w - m[2].w * m[3].y) + m[1].w * (m[2].y * m[3].z - m[2].z * m[3].y)
-         * M01: m[1].x * (m[2].z * m[3].w - m[2].w * m[3].z) - m[1].z * (m[2].x * m[3].w - m[2].w * m[3].x) + m[1].w * (m[2].x * m[3].z - m[2].z * m[3].x)
-         * M02: m[1].x * (m[2].y * m[3].w - m[2].w * m[3].y) - m[1].y * (m[2].x * m[3].w - m[2].w * m[3].x) + m[1].w * (m[2].x * m[3].y - m[2].y * m[3].x)
-         * M03: m[1].x * (m[2].y * m[3].z - m[2].z * m[3].y) - m[1].y * (m[2].x * m[3].z - m[2].z * m[3].x) + m[1].z * (m[2].x * m[3].y - m[2].y * m[3].x)
+         * The determinant is expanded along the top row: det = m[0].x * C00 + m[0].y * C01 + m[0].z * C02 + m[0].w * C03
+         * Where Cxy denotes the cofactor of the element in the xth row and yth column.
          * 
-         * //plug the determinants into the exquation:
+         * All cofactors of the top row are made of the 2x2 sub-determinants of the lower two rows, so only the
+         * 6 different sub-determinants are computed and shared between the cofactors.
+         * The sum uses the same steps as inverse(), so the determinant and the inverse match exactly.
          */
-        return (
-            //m[0].x * det(M00)
-            rows[0].x * (rows[1].y * (rows[2].z * rows[3].w - rows[2].w * rows[3].z) - rows[1].z * (rows[2].y * rows[3].w - rows[2].w * rows[3].y) + rows[1].w * (rows[2].y * rows[3].z - rows[2].z * rows[3].y)) - 
-            //m[0].y * det(M01)
-            rows[0].y * (rows[1].x * (rows[2].z * rows[3].w - rows[2].w * rows[3].z) - rows[1].z * (rows[2].x * rows[3].w - rows[2].w * rows[3].x) + rows[1].w * (rows[2].x * rows[3].z - rows[2].z * rows[3].x)) + 
-            //m[0].z * det(M02)
-            rows[0].z * (rows[1].x * (rows[2].y * rows[3].w - rows[2].w * rows[3].y) - rows[1].y * (rows[2].x * rows[3].w - rows[2].w * rows[3].x) + rows[1].w * (rows[2].x * rows[3].y - rows[2].y * rows[3].x)) - 
-            //m[0].w * det(M03)
-            rows[0].w * (rows[1].x * (rows[2].y * rows[3].z - rows[2].z * rows[3].y) - rows[1].y * (rows[2].x * rows[3].z - rows[2].z * rows[3].x) + rows[1].z * (rows[2].x * rows[3].y - rows[2].y * rows[3].x))
-        );
+        //2x2 sub-determinants of the lower two rows, the numbers are the columns of the sub-matrix
+        double s01 = rows[2].x * rows[3].y - rows[2].y * rows[3].x;
+        double s02 = rows[2].x * rows[3].z - rows[2].z * rows[3].x;
+        double s03 = rows[2].x * rows[3].w - rows[2].w * rows[3].x;
+        double s12 = rows[2].y * rows[3].z - rows[2].z * rows[3].y;
+        double s13 = rows[2].y * rows[3].w - rows[2].w * rows[3].y;
+        double s23 = rows[2].z * rows[3].w - rows[2].w * rows[3].z;
+
+        //cofactors of the top row
+        double c0 =  ((rows[1].y * s23 - rows[1].z * s13) + rows[1].w * s12);
+        double c1 = -((rows[1].x * s23 - rows[1].z * s03) + rows[1].w * s02);
+        double c2 =  ((rows[1].x * s13 - rows[1].y * s03) + rows[1].w * s01);
+        double c3 = -((rows[1].x * s12 - rows[1].y * s02) + rows[1].z * s01);
+
+        return (rows[0].x * c0 + rows[0].y * c1) + (rows[0].z * c2 + rows[0].w * c3);
     }
 
     /**
@@ -345,117 +444,45 @@ typedef struct s_dmat4
      * @return constexpr s_dmat4 the cofactor matrix
      */
     inline constexpr s_dmat4 cofactors() const noexcept {
-        /**
-         * Value source: https://semath.info/src/cofactor-matrix.html
-         * 
-         * Representation in an intermediate format represented by a number for the row and a vector element (x,y,z or w) for the column
-         * Example: 0x represents the top left element of the matrix and 3w the bottom right element
-         * Multiplication can be represented by the multiply operator (*) or a space
-         * 
-         * Row 0:
-         * 0x =  1y 2z 3w + 1z 2w 3y + 1w 2y 3z
-         *      -1w 2z 3y - 1z 2y 3w - 1y 2w 3z
-         * 0y =  0y 2z 3w + 0z 2w 3y + 0w 2y 3z
-         *      -0w 2z 3y - 0z 2y 3w - 0y 2w 3z
-         * 0z =  0y 1z 3w + 0z 1w 3y + 0w 1y 3z
-         *      -0w 1z 3y - 0z 1y 3w - 0y 1w 3z
-         * 0w =  0y 1z 2w + 0z 1w 2y + 0w 1y 2z
-         *      -0w 1z 2y - 0z 1y 2w - 0y 1w 2z
-         * 
-         * Row 1:
-         * 1x =  1x 2z 3w + 1z 2w 3x + 1w 2x 3z
-         *      -1w 2z 3x - 1z 2x 3w - 1x 2w 3z
-         * 1y =  0x 2z 3w + 0z 2w 3x + 0w 2x 3z
-         *      -0w 2z 3x - 0z 2x 3w - 0x 2w 3z
-         * 1z =  0x 1z 3w + 0z 1w 3x + 0w 1x 3z
-         *      -0w 1z 3x - 0z 1x 3w - 0x 1w 3z
-         * 1w =  0x 1z 2w + 0z 1w 2x + 0w 1x 2z
-         *      -0w 1z 2x - 0z 1x 2w - 0x 1w 2z
-         * 
-         * Row 2:
-         * 2x =  1x 2y 3w + 1y 2w 3x + 1w 2x 3y
-         *      -1w 2y 3x - 1y 2x 3w - 1x 2w 3y
-         * 2y =  0x 2y 3w + 0y 2w 3x + 0w 2x 3y
-         *      -0w 2y 3x - 0y 2x 3w - 0x 2w 3y
-         * 2z =  0x 1y 3w + 0y 1w 3x + 0w 1x 3y
-         *      -0w 1y 3x - 0y 1x 3w - 0x 1w 3y
-         * 2w =  0x 1y 2w + 0y 1w 2x + 0w 1x 2y
-         *      -0w 1y 2x - 0y 1x 2w - 0x 1w 2y
-         * 
-         * Row 3:
-         * 3x =  1x 2y 3z + 1y 2z 3x + 1z 2x 3y
-         *      -1z 2y 3x - 1y 2x 3z - 1x 2z 3y
-         * 3y =  0x 2y 3z + 0y 2z 3x + 0z 2x 3y
-         *      -0z 2y 3x - 0y 2x 3z - 0x 2z 3y
-         * 3z =  0x 1y 3z + 0y 1z 3x + 0z 1x 3y
-         *      -0z 1y 3x - 0y 1x 3z - 0x 1z 3y
-         * 1w =  0x 1y 2z + 0y 1z 2x + 0z 1x 2y
-         *      -0z 1y 2x - 0y 1x 2z - 0x 1z 2y
-         * 
-         * Plug all the values into a single matrix to compute the cofactor matrix of any 4x4 matrix
-         * Warning: The values above are TRANSPOSED in comparison to my default layout
-         */
+        //the cofactor matrix is the transposed adjugate, the elements are swapped here so this stays a constant expression
+        s_dmat4 a = adjugate();
         return s_dmat4(
-            //row 0
-            dvec4(
-                 (rows[1].y * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].y + rows[1].w * rows[2].y * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].y - rows[1].z * rows[2].y * rows[3].w - rows[1].y * rows[2].w * rows[3].z),
-                -(rows[1].x * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].x - rows[1].z * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].z),
-                 (rows[1].x * rows[2].y * rows[3].w + rows[1].y * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].y
-                  -rows[1].w * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].y),
-                -(rows[1].x * rows[2].y * rows[3].z + rows[1].y * rows[2].z * rows[3].x + rows[1].z * rows[2].x * rows[3].y
-                  -rows[1].z * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].z - rows[1].x * rows[2].z * rows[3].y)
-            ),
-            //row 1
-            dvec4(
-                -(rows[0].y * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].y + rows[0].w * rows[2].y * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].y - rows[0].z * rows[2].y * rows[3].w - rows[0].y * rows[2].w * rows[3].z),
-                 (rows[0].x * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].x - rows[0].z * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].z),
-                -(rows[0].x * rows[2].y * rows[3].w + rows[0].y * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].y
-                  -rows[0].w * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].y),
-                 (rows[0].x * rows[2].y * rows[3].z + rows[0].y * rows[2].z * rows[3].x + rows[0].z * rows[2].x * rows[3].y
-                  -rows[0].z * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].z - rows[0].x * rows[2].z * rows[3].y)
-            ),
-            //row 2
-            dvec4(
-                 (rows[0].y * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].y + rows[0].w * rows[1].y * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].y - rows[0].z * rows[1].y * rows[3].w - rows[0].y * rows[1].w * rows[3].z),
-                -(rows[0].x * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].x - rows[0].z * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].z),
-                 (rows[0].x * rows[1].y * rows[3].w + rows[0].y * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].y
-                  -rows[0].w * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[3].z + rows[0].y * rows[1].z * rows[3].x + rows[0].z * rows[1].x * rows[3].y
-                  -rows[0].z * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].z - rows[0].x * rows[1].z * rows[3].y)
-            ),
-            //row 3
-            dvec4(
-                -(rows[0].y * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].y + rows[0].w * rows[1].y * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].y - rows[0].z * rows[1].y * rows[2].w - rows[0].y * rows[1].w * rows[2].z),
-                 (rows[0].x * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].x - rows[0].z * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].z),
-                -(rows[0].x * rows[1].y * rows[2].w + rows[0].y * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].y
-                  -rows[0].w * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].y),
-                 (rows[0].x * rows[1].y * rows[2].z + rows[0].y * rows[1].z * rows[2].x + rows[0].z * rows[1].x * rows[2].y
-                  -rows[0].z * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].z - rows[0].x * rows[1].z * rows[2].y)
-            )
+            a.m[0], a.m[4], a.m[8],  a.m[12],
+            a.m[1], a.m[5], a.m[9],  a.m[13],
+            a.m[2], a.m[6], a.m[10], a.m[14],
+            a.m[3], a.m[7], a.m[11], a.m[15]
         );
-    };
+    }
 
     /**
      * @brief get the transpose of the matrix
      * 
      * @return constexpr s_dmat4 the transposed matrix
      */
+    #if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_AVX2
+    inline s_dmat4 transpose() const noexcept {
+        //interleave the pairs of rows, then swap the upper half of the upper rows with the lower half of the lower rows
+        __m256d t0 = _mm256_unpacklo_pd(rows[0].simd, rows[1].simd);
+        __m256d t1 = _mm256_unpackhi_pd(rows[0].simd, rows[1].simd);
+        __m256d t2 = _mm256_unpacklo_pd(rows[2].simd, rows[3].simd);
+        __m256d t3 = _mm256_unpackhi_pd(rows[2].simd, rows[3].simd);
+        return s_dmat4(
+            dvec4(_mm256_permute2f128_pd(t0, t2, 0x20)),
+            dvec4(_mm256_permute2f128_pd(t1, t3, 0x20)),
+            dvec4(_mm256_permute2f128_pd(t0, t2, 0x31)),
+            dvec4(_mm256_permute2f128_pd(t1, t3, 0x31))
+        );
+    }
+    #else
     inline constexpr s_dmat4 transpose() const noexcept {
         return s_dmat4(
             dvec4(rows[0].x, rows[1].x, rows[2].x, rows[3].x),
-            dvec4(rows[0].y, rows[1].y, rows[2].y, rows[3].y), 
-            dvec4(rows[0].z, rows[1].z, rows[2].z, rows[3].z), 
+            dvec4(rows[0].y, rows[1].y, rows[2].y, rows[3].y),
+            dvec4(rows[0].z, rows[1].z, rows[2].z, rows[3].z),
             dvec4(rows[0].w, rows[1].w, rows[2].w, rows[3].w)
         );
     }
+    #endif
 
     /**
      * @brief compute the adjugate matrix of a 4*4 double matrix
@@ -463,51 +490,65 @@ typedef struct s_dmat4
      * @return constexpr s_dmat4 the adjugate matrix of this matrix
      */
     inline constexpr s_dmat4 adjugate() const noexcept {
-        //same as the cofactor computation, but rows and columns are swapped
+        /**
+         * The element in the ith row and jth column of the adjugate is the cofactor of the element in the jth row and ith column.
+         * The 3x3 minor of that cofactor keeps all rows except j, it is expanded along its top row (row 1 for j = 0, else row 0).
+         * The remaining two rows of the minor are the rows 2 and 3 (j = 0 and j = 1), 1 and 3 (j = 2) or 1 and 2 (j = 3).
+         * 
+         * So every element is made of three 2x2 sub-determinants of one of these row pairs. There are only 18 different
+         * sub-determinants (3 row pairs with 6 column pairs each), they are computed once and shared between all elements.
+         * inverse() uses exactly the same steps, so the SIMD and the scalar implementation produce the same results.
+         */
+        //2x2 sub-determinants of the rows 2 and 3, the numbers are the columns of the sub-matrix
+        double a01 = rows[2].x * rows[3].y - rows[2].y * rows[3].x;
+        double a02 = rows[2].x * rows[3].z - rows[2].z * rows[3].x;
+        double a03 = rows[2].x * rows[3].w - rows[2].w * rows[3].x;
+        double a12 = rows[2].y * rows[3].z - rows[2].z * rows[3].y;
+        double a13 = rows[2].y * rows[3].w - rows[2].w * rows[3].y;
+        double a23 = rows[2].z * rows[3].w - rows[2].w * rows[3].z;
+        //2x2 sub-determinants of the rows 1 and 3
+        double b01 = rows[1].x * rows[3].y - rows[1].y * rows[3].x;
+        double b02 = rows[1].x * rows[3].z - rows[1].z * rows[3].x;
+        double b03 = rows[1].x * rows[3].w - rows[1].w * rows[3].x;
+        double b12 = rows[1].y * rows[3].z - rows[1].z * rows[3].y;
+        double b13 = rows[1].y * rows[3].w - rows[1].w * rows[3].y;
+        double b23 = rows[1].z * rows[3].w - rows[1].w * rows[3].z;
+        //2x2 sub-determinants of the rows 1 and 2
+        double c01 = rows[1].x * rows[2].y - rows[1].y * rows[2].x;
+        double c02 = rows[1].x * rows[2].z - rows[1].z * rows[2].x;
+        double c03 = rows[1].x * rows[2].w - rows[1].w * rows[2].x;
+        double c12 = rows[1].y * rows[2].z - rows[1].z * rows[2].y;
+        double c13 = rows[1].y * rows[2].w - rows[1].w * rows[2].y;
+        double c23 = rows[1].z * rows[2].w - rows[1].w * rows[2].z;
+
         return s_dmat4(
-            //row 0
+            //row 0 (minors without column 0)
             dvec4(
-                  (rows[1].y * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].y + rows[1].w * rows[2].y * rows[3].z
-                   -rows[1].w * rows[2].z * rows[3].y - rows[1].z * rows[2].y * rows[3].w - rows[1].y * rows[2].w * rows[3].z),
-                -(rows[0].y * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].y + rows[0].w * rows[2].y * rows[3].z
-                   -rows[0].w * rows[2].z * rows[3].y - rows[0].z * rows[2].y * rows[3].w - rows[0].y * rows[2].w * rows[3].z),
-                  (rows[0].y * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].y + rows[0].w * rows[1].y * rows[3].z
-                   -rows[0].w * rows[1].z * rows[3].y - rows[0].z * rows[1].y * rows[3].w - rows[0].y * rows[1].w * rows[3].z),
-                -(rows[0].y * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].y + rows[0].w * rows[1].y * rows[2].z
-                   -rows[0].w * rows[1].z * rows[2].y - rows[0].z * rows[1].y * rows[2].w - rows[0].y * rows[1].w * rows[2].z)
+                 ((rows[1].y * a23 - rows[1].z * a13) + rows[1].w * a12),
+                -((rows[0].y * a23 - rows[0].z * a13) + rows[0].w * a12),
+                 ((rows[0].y * b23 - rows[0].z * b13) + rows[0].w * b12),
+                -((rows[0].y * c23 - rows[0].z * c13) + rows[0].w * c12)
             ),
-            //row 1
+            //row 1 (minors without column 1)
             dvec4(
-                -(rows[1].x * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].x - rows[1].z * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].z),
-                 (rows[0].x * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].x - rows[0].z * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].z),
-                -(rows[0].x * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].x - rows[0].z * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].z),
-                 (rows[0].x * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].x - rows[0].z * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].z)
+                -((rows[1].x * a23 - rows[1].z * a03) + rows[1].w * a02),
+                 ((rows[0].x * a23 - rows[0].z * a03) + rows[0].w * a02),
+                -((rows[0].x * b23 - rows[0].z * b03) + rows[0].w * b02),
+                 ((rows[0].x * c23 - rows[0].z * c03) + rows[0].w * c02)
             ),
-            //row 2
+            //row 2 (minors without column 2)
             dvec4(
-                 (rows[1].x * rows[2].y * rows[3].w + rows[1].y * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].y
-                  -rows[1].w * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].y),
-                -(rows[0].x * rows[2].y * rows[3].w + rows[0].y * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].y
-                  -rows[0].w * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].y),
-                 (rows[0].x * rows[1].y * rows[3].w + rows[0].y * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].y
-                  -rows[0].w * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[2].w + rows[0].y * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].y
-                  -rows[0].w * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].y)
+                 ((rows[1].x * a13 - rows[1].y * a03) + rows[1].w * a01),
+                -((rows[0].x * a13 - rows[0].y * a03) + rows[0].w * a01),
+                 ((rows[0].x * b13 - rows[0].y * b03) + rows[0].w * b01),
+                -((rows[0].x * c13 - rows[0].y * c03) + rows[0].w * c01)
             ),
-            //row 3
+            //row 3 (minors without column 3)
             dvec4(
-                -(rows[1].x * rows[2].y * rows[3].z + rows[1].y * rows[2].z * rows[3].x + rows[1].z * rows[2].x * rows[3].y
-                  -rows[1].z * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].z - rows[1].x * rows[2].z * rows[3].y),
-                 (rows[0].x * rows[2].y * rows[3].z + rows[0].y * rows[2].z * rows[3].x + rows[0].z * rows[2].x * rows[3].y
-                  -rows[0].z * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].z - rows[0].x * rows[2].z * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[3].z + rows[0].y * rows[1].z * rows[3].x + rows[0].z * rows[1].x * rows[3].y
-                  -rows[0].z * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].z - rows[0].x * rows[1].z * rows[3].y),
-                 (rows[0].x * rows[1].y * rows[2].z + rows[0].y * rows[1].z * rows[2].x + rows[0].z * rows[1].x * rows[2].y
-                  -rows[0].z * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].z - rows[0].x * rows[1].z * rows[2].y)
+                -((rows[1].x * a12 - rows[1].y * a02) + rows[1].z * a01),
+                 ((rows[0].x * a12 - rows[0].y * a02) + rows[0].z * a01),
+                -((rows[0].x * b12 - rows[0].y * b02) + rows[0].z * b01),
+                 ((rows[0].x * c12 - rows[0].y * c02) + rows[0].z * c01)
             )
         );
     }
@@ -515,13 +556,125 @@ typedef struct s_dmat4
     /**
      * @brief calculate the inverse of the matrix
      * 
+     * The inverse is the adjugate divided by the determinant. The determinant is computed from the first column of the adjugate,
+     * so all 2x2 sub-determinants are only computed once.
+     * 
      * @return s_dmat4 the inverse matrix
      */
     inline s_dmat4 inverse() const noexcept {
-        //cache the inverse determinant
-        double inv_det = 1.f / determinant();
-        //return a matrix where all elements are swapped correctly and scaled by the inverse determinant
-        return cofactors() * inv_det;
+        //check for AVX2 to compute a whole row of the adjugate at once
+        #if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_AVX2
+        //the same steps as adjugate(), but every lane computes a different column of a row of the adjugate
+        __m256d a = rows[0].simd;
+        //for every column k of the matrix p holds the top rows (c, c, b, b), q the bottom rows (d, d, d, c) of the
+        //row pairs of the 2x2 sub-determinants and v the rows the minors are expanded along (b, a, a, a)
+        __m256d p[4], q[4], v[4];
+        for (int k = 0; k < 4; ++k) {
+            p[k] = _mm256_blend_pd(_mm256_broadcast_sd(m + 8 + k), _mm256_broadcast_sd(m + 4 + k), 0xC);
+            q[k] = _mm256_blend_pd(_mm256_broadcast_sd(m + 12 + k), _mm256_broadcast_sd(m + 8 + k), 0x8);
+            v[k] = _mm256_blend_pd(_mm256_broadcast_sd(m + k), _mm256_broadcast_sd(m + 4 + k), 0x1);
+        }
+
+        //2x2 sub-determinants for all column pairs, lane 0 and 1 of the rows 2 and 3, lane 2 of the rows 1 and 3 and lane 3 of the rows 1 and 2
+        __m256d s01 = _mm256_sub_pd(_mm256_mul_pd(p[0], q[1]), _mm256_mul_pd(p[1], q[0]));
+        __m256d s02 = _mm256_sub_pd(_mm256_mul_pd(p[0], q[2]), _mm256_mul_pd(p[2], q[0]));
+        __m256d s03 = _mm256_sub_pd(_mm256_mul_pd(p[0], q[3]), _mm256_mul_pd(p[3], q[0]));
+        __m256d s12 = _mm256_sub_pd(_mm256_mul_pd(p[1], q[2]), _mm256_mul_pd(p[2], q[1]));
+        __m256d s13 = _mm256_sub_pd(_mm256_mul_pd(p[1], q[3]), _mm256_mul_pd(p[3], q[1]));
+        __m256d s23 = _mm256_sub_pd(_mm256_mul_pd(p[2], q[3]), _mm256_mul_pd(p[3], q[2]));
+
+        //expand the minors and apply the checkerboard signs of the cofactors. Nothing is fused, so the result matches adjugate()
+        __m256d signEven = _mm256_setr_pd(1., -1., 1., -1.);
+        __m256d signOdd = _mm256_setr_pd(-1., 1., -1., 1.);
+        __m256d r0 = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(v[1], s23), _mm256_mul_pd(v[2], s13)), _mm256_mul_pd(v[3], s12)), signEven);
+        __m256d r1 = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(v[0], s23), _mm256_mul_pd(v[2], s03)), _mm256_mul_pd(v[3], s02)), signOdd);
+        __m256d r2 = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(v[0], s13), _mm256_mul_pd(v[1], s03)), _mm256_mul_pd(v[3], s01)), signEven);
+        __m256d r3 = _mm256_mul_pd(_mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(v[0], s12), _mm256_mul_pd(v[1], s02)), _mm256_mul_pd(v[2], s01)), signOdd);
+
+        //the determinant is the dot product of the top row and the first column of the adjugate
+        __m256d col = _mm256_permute2f128_pd(_mm256_unpacklo_pd(r0, r1), _mm256_unpacklo_pd(r2, r3), 0x20);
+        __m256d det = _mm256_mul_pd(a, col);
+        det = _mm256_add_pd(det, _mm256_permute_pd(det, 0x5));
+        det = _mm256_add_pd(det, _mm256_permute2f128_pd(det, det, 0x01));
+        __m256d inv_det = _mm256_div_pd(_mm256_set1_pd(1.), det);
+
+        return s_dmat4(
+            dvec4(_mm256_mul_pd(r0, inv_det)),
+            dvec4(_mm256_mul_pd(r1, inv_det)),
+            dvec4(_mm256_mul_pd(r2, inv_det)),
+            dvec4(_mm256_mul_pd(r3, inv_det))
+        );
+        #else
+        s_dmat4 adj = adjugate();
+        //the determinant is the dot product of the top row and the first column of the adjugate
+        double inv_det = 1. / ((rows[0].x * adj.rows[0].x + rows[0].y * adj.rows[1].x) + (rows[0].z * adj.rows[2].x + rows[0].w * adj.rows[3].x));
+        return adj * inv_det;
+        #endif
+    }
+
+    /**
+     * @brief calculate the inverse of an affine matrix
+     * 
+     * The bottom row must be (0, 0, 0, 1). Only the upper 3x3 part is inverted, the translation is rotated by that inverse and negated.
+     * This is a lot cheaper than inverse(), the bottom row of the input is not read.
+     * 
+     * @return s_dmat4 the inverse matrix
+     */
+    inline s_dmat4 inverseAffine() const noexcept {
+        //the columns of the inverse of the 3x3 part are the cross products of the rows
+        double x0 = rows[1].y * rows[2].z - rows[1].z * rows[2].y, x1 = rows[1].z * rows[2].x - rows[1].x * rows[2].z, x2 = rows[1].x * rows[2].y - rows[1].y * rows[2].x;
+        double y0 = rows[2].y * rows[0].z - rows[2].z * rows[0].y, y1 = rows[2].z * rows[0].x - rows[2].x * rows[0].z, y2 = rows[2].x * rows[0].y - rows[2].y * rows[0].x;
+        double z0 = rows[0].y * rows[1].z - rows[0].z * rows[1].y, z1 = rows[0].z * rows[1].x - rows[0].x * rows[1].z, z2 = rows[0].x * rows[1].y - rows[0].y * rows[1].x;
+        double inv_det = 1. / ((rows[0].x * x0 + rows[0].y * x1) + rows[0].z * x2);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        double t0 = (x0 * rows[0].w + y0 * rows[1].w) + z0 * rows[2].w;
+        double t1 = (x1 * rows[0].w + y1 * rows[1].w) + z1 * rows[2].w;
+        double t2 = (x2 * rows[0].w + y2 * rows[1].w) + z2 * rows[2].w;
+        return s_dmat4(
+            x0 * inv_det, y0 * inv_det, z0 * inv_det, -t0 * inv_det,
+            x1 * inv_det, y1 * inv_det, z1 * inv_det, -t1 * inv_det,
+            x2 * inv_det, y2 * inv_det, z2 * inv_det, -t2 * inv_det,
+            0., 0., 0., 1.
+        );
+    }
+
+    /**
+     * @brief calculate the inverse of a rigid matrix
+     * 
+     * The upper 3x3 part must be a pure rotation (orthonormal) and the bottom row must be (0, 0, 0, 1). The rotation is
+     * transposed and the translation is rotated by the transposed rotation and negated.
+     * 
+     * @return s_dmat4 the inverse matrix
+     */
+    inline s_dmat4 inverseRigid() const noexcept {
+        //the new translation is the negated translation transformed by the transposed rotation
+        double t0 = (rows[0].x * rows[0].w + rows[1].x * rows[1].w) + rows[2].x * rows[2].w;
+        double t1 = (rows[0].y * rows[0].w + rows[1].y * rows[1].w) + rows[2].y * rows[2].w;
+        double t2 = (rows[0].z * rows[0].w + rows[1].z * rows[1].w) + rows[2].z * rows[2].w;
+        return s_dmat4(
+            rows[0].x, rows[1].x, rows[2].x, -t0,
+            rows[0].y, rows[1].y, rows[2].y, -t1,
+            rows[0].z, rows[1].z, rows[2].z, -t2,
+            0., 0., 0., 1.
+        );
+    }
+
+    /**
+     * @brief calculate the inverse of a matrix made of a uniform scale, a rotation and a translation
+     * 
+     * The upper 3x3 part must be a rotation multiplied by a single scale factor and the bottom row must be (0, 0, 0, 1).
+     * Like inverseRigid(), but the result is divided by the squared scale, which is read from the length of the top row.
+     * 
+     * @return s_dmat4 the inverse matrix
+     */
+    inline s_dmat4 inverseUniformScale() const noexcept {
+        //the squared length of any row of the 3x3 part is the squared scale
+        double inv_s2 = 1. / ((rows[0].x * rows[0].x + rows[0].y * rows[0].y) + rows[0].z * rows[0].z);
+        s_dmat4 r = inverseRigid();
+        r.rows[0] *= inv_s2;
+        r.rows[1] *= inv_s2;
+        r.rows[2] *= inv_s2;
+        return r;
     }
 
     #endif
@@ -693,9 +846,197 @@ dmat4 dmat4_traspose(const dmat4* mat);
  */
 dmat4 dmat4_inverse(const dmat4* mat);
 
-//end a potential C-Section
+/**
+ * @brief compute the inverse of an affine matrix (the bottom row is (0, 0, 0, 1))
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return dmat4 the inverse matrix
+ */
+dmat4 dmat4_inverseAffine(const dmat4* mat);
+
+/**
+ * @brief compute the inverse of a rigid matrix (rotation and translation only)
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return dmat4 the inverse matrix
+ */
+dmat4 dmat4_inverseRigid(const dmat4* mat);
+
+/**
+ * @brief compute the inverse of a matrix made of a uniform scale, a rotation and a translation
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return dmat4 the inverse matrix
+ */
+dmat4 dmat4_inverseUniformScale(const dmat4* mat);
+
+/**
+ * @brief multiply every matrix of an array with the matching matrix of another array
+ * 
+ * Multiple products are computed at once if the CPU supports wide registers. With AVX2 the sums are fused into the 
+ * multiplications, so the results may differ in the last bit from dmat4_multiply in a build without AVX2. 
+ * 
+ * @param a a constant pointer to the left matrices
+ * @param b a constant pointer to the right matrices
+ * @param out a pointer to the array to write the products to (may be the same as a or b)
+ * @param n the amount of matrices to multiply
+ */
+void dmat4_multiplyArray(const dmat4* a, const dmat4* b, dmat4* out, size_t n);
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * Multiple matrices are inverted at once if the CPU supports wide registers. The results are bit-identical to dmat4_inverse. 
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param n the amount of matrices to invert
+ */
+void dmat4_inverseArray(const dmat4* in, dmat4* out, size_t n);
+
+/**
+ * @brief apply a matrix to an array of 4D vectors
+ * 
+ * With AVX2 the sums are fused into the multiplications, so the results may differ in the last bit from dmat4_apply 
+ * in a build without AVX2. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the vectors to transform
+ * @param out a pointer to the array to write the transformed vectors to (may be the same as in)
+ * @param n the amount of vectors to transform
+ */
+void dmat4_applyArray(const dmat4* mat, const dvec4* in, dvec4* out, size_t n);
+
+/**
+ * @brief transform an array of 3D points by a matrix
+ * 
+ * The points are extended with a w of 1, so the translation is applied. The w component of the result is discarded, 
+ * no perspective divide is done. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param n the amount of points to transform
+ */
+void dmat4_transformPoints(const dmat4* mat, const dvec3* in, dvec3* out, size_t n);
+
+/**
+ * @brief transform an array of 3D directions by a matrix
+ * 
+ * The directions are extended with a w of 0, so the translation is not applied. The w component of the result is discarded. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param n the amount of directions to transform
+ */
+void dmat4_transformDirections(const dmat4* mat, const dvec3* in, dvec3* out, size_t n);
+
+//end a potential C-Section and add the C++ specific functions
 #if __cplusplus
 }
+
+/**
+ * @brief multiply every matrix of an array with the matching matrix of another array
+ * 
+ * @param a a constant pointer to the left matrices
+ * @param b a constant pointer to the right matrices
+ * @param out a pointer to the array to write the products to (may be the same as a or b)
+ * @param count the amount of matrices to multiply
+ */
+inline void multiply(const dmat4* a, const dmat4* b, dmat4* out, size_t count) noexcept
+{dmat4_multiplyArray(a, b, out, count);}
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param count the amount of matrices to invert
+ */
+inline void inverse(const dmat4* in, dmat4* out, size_t count) noexcept
+{dmat4_inverseArray(in, out, count);}
+
+/**
+ * @brief transform an array of 4D vectors by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the vectors to transform
+ * @param out a pointer to the array to write the transformed vectors to (may be the same as in)
+ * @param count the amount of vectors to transform
+ */
+inline void transform(const dmat4& mat, const dvec4* in, dvec4* out, size_t count) noexcept
+{dmat4_applyArray(&mat, in, out, count);}
+
+/**
+ * @brief transform an array of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param count the amount of points to transform
+ */
+inline void transformPoints(const dmat4& mat, const dvec3* in, dvec3* out, size_t count) noexcept
+{dmat4_transformPoints(&mat, in, out, count);}
+
+/**
+ * @brief transform an array of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param count the amount of directions to transform
+ */
+inline void transformDirections(const dmat4& mat, const dvec3* in, dvec3* out, size_t count) noexcept
+{dmat4_transformDirections(&mat, in, out, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief compute the inverse of every matrix in a span
+ * 
+ * @param in the matrices to invert
+ * @param out the span to write the inverse matrices to, only as many elements as both spans hold are inverted
+ */
+inline void inverse(std::span<const dmat4> in, std::span<dmat4> out) noexcept
+{dmat4_inverseArray(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 4D vectors by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the vectors to transform
+ * @param out the span to write the transformed vectors to, only as many elements as both spans hold are transformed
+ */
+inline void transform(const dmat4& mat, std::span<const dvec4> in, std::span<dvec4> out) noexcept
+{dmat4_applyArray(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the points to transform
+ * @param out the span to write the transformed points to, only as many elements as both spans hold are transformed
+ */
+inline void transformPoints(const dmat4& mat, std::span<const dvec3> in, std::span<dvec3> out) noexcept
+{dmat4_transformPoints(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the directions to transform
+ * @param out the span to write the transformed directions to, only as many elements as both spans hold are transformed
+ */
+inline void transformDirections(const dmat4& mat, std::span<const dvec3> in, std::span<dvec3> out) noexcept
+{dmat4_transformDirections(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
+
 #endif
 
 #endif
\ No newline at end of file
@@ -19,5 +19,7 @@
 #include "GLGE_mat3.h"
 //include 4x4 matrices
 #include "GLGE_mat4.h"
+//include affine 3x4 matrices
+#include "GLGE_mat3x4.h"
 
 #endif
\ No newline at end of file
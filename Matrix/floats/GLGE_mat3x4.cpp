@@ -0,0 +1,61 @@
+/**
+ * @file GLGE_mat3x4.cpp
+ * @author DM8AT
+ * @brief implement the C function binding for the mat3x4 object
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the affine 3*4 float matrices
+#include "GLGE_mat3x4.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+
+mat3x4 mat3x4_fromMat4(const mat4* mat) {return mat3x4(*mat);}
+
+mat4 mat3x4_toMat4(const mat3x4* mat) {return mat->toMat4();}
+
+mat3x4 mat3x4_fromDMat4(const dmat4* mat) {return mat3x4(*mat);}
+
+dmat4 mat3x4_toDMat4(const mat3x4* mat) {return mat->toDMat4();}
+
+mat3x4 mat3x4_multiply(const mat3x4* a, const mat3x4* b) {return *a * *b;}
+
+void mat3x4_multiplyTo(mat3x4* a, const mat3x4* b) {*a *= *b;}
+
+vec4 mat3x4_apply(const mat3x4* a, const vec4* b) {return *a * *b;}
+
+vec3 mat3x4_transformPoint(const mat3x4* mat, const vec3* p) {return mat->transformPoint(*p);}
+
+vec3 mat3x4_transformDirection(const mat3x4* mat, const vec3* d) {return mat->transformDirection(*d);}
+
+float mat3x4_determinant(const mat3x4* mat) {return mat->determinant();}
+
+bool mat3x4_hasInverse(const mat3x4* mat) {return mat->hasInverse();}
+
+mat3x4 mat3x4_inverse(const mat3x4* mat) {return mat->inverse();}
+
+mat3x4 mat3x4_inverseRigid(const mat3x4* mat) {return mat->inverseRigid();}
+
+void mat3x4_multiplyArray(const mat3x4* a, const mat3x4* b, mat3x4* out, size_t n) 
+{glge::kernel::table().affineMultiply((const float*)a, (const float*)b, (float*)out, n);}
+
+void mat3x4_inverseArray(const mat3x4* in, mat3x4* out, size_t n) 
+{glge::kernel::table().affineInverse((const float*)in, (float*)out, n);}
+
+void mat3x4_transformPoints(const mat3x4* mat, const vec3* in, vec3* out, size_t n) {
+    //streaming requires the output to be aligned to 16 bytes
+    bool stream = ((n * sizeof(vec3)) >= GLGE_MATH_STREAMING_THRESHOLD) && !(((uintptr_t)out) & 15);
+    //the 3D transform of the 4x4 matrices only reads the upper 3 rows
+    glge::kernel::table().mat4Transform3(mat->m, (const float*)in, (float*)out, n, true, stream);
+}
+
+void mat3x4_transformDirections(const mat3x4* mat, const vec3* in, vec3* out, size_t n) {
+    //streaming requires the output to be aligned to 16 bytes
+    bool stream = ((n * sizeof(vec3)) >= GLGE_MATH_STREAMING_THRESHOLD) && !(((uintptr_t)out) & 15);
+    //the 3D transform of the 4x4 matrices only reads the upper 3 rows
+    glge::kernel::table().mat4Transform3(mat->m, (const float*)in, (float*)out, n, false, stream);
+}
\ No newline at end of file
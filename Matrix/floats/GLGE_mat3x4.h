@@ -0,0 +1,592 @@
+/**
+ * @file GLGE_mat3x4.h
+ * @author DM8AT
+ * @brief define an affine 3x4 float matrix
+ * 
+ * A 3x4 matrix stores the upper 3 rows of an affine 4x4 matrix, the bottom row is always (0, 0, 0, 1) and not stored.
+ * So a matrix only takes 48 instead of 64 bytes and the product, the transformation and the inverse skip all work for
+ * the bottom row. The layout is the same as the upper 3 rows of mat4 (row major, the translation in the last column).
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_MAT_3x4_
+#define _GLGE_FLOAT_MAT_3x4_
+
+//include float 3D and 4D vectors
+#include "../../Vector/floats/GLGE_vec3.h"
+#include "../../Vector/floats/GLGE_vec4.h"
+//include the 4x4 matrices to convert to and from
+#include "GLGE_mat4.h"
+#include "../doubles/GLGE_dmat4.h"
+
+//if SIMD is requested, include SIMD intrinsics
+#include "../../GLGEMath_Settings.h"
+#if GLGE_MATH_USE_SIMD
+#if GLGE_MATH_ALLOW_AVX2
+#include <immintrin.h>
+#else
+#include <xmmintrin.h>
+#endif
+#endif
+
+/**
+ * @brief an affine 3x4 matrix of float elements, the bottom row (0, 0, 0, 1) is implicit
+ */
+typedef struct s_mat3x4
+{
+    //store all possible lay outs for the data
+    union {
+        //use a 12 element (3*4) float array for data storage
+        float m[12];
+        //the matrix is made of 3 rows where each row has 4 elements (4D vector)
+        vec4 rows[3];
+    };
+
+    //check for C++ to implement the member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new 3*4 matrix
+     * default constructor, the matrix is the identity transformation
+     */
+    inline constexpr s_mat3x4() noexcept
+     : m{1,0,0,0,0,1,0,0,0,0,1,0}
+    {}
+
+    /**
+     * @brief Construct a new 3*4 matrix
+     * 
+     * @param m00 the top left item of the matrix
+     * @param m03 the x translation of the matrix
+     * @param m13 the y translation of the matrix
+     * @param m23 the z translation of the matrix
+     */
+    inline constexpr s_mat3x4(float m00, float m01, float m02, float m03,
+                              float m10, float m11, float m12, float m13,
+                              float m20, float m21, float m22, float m23) noexcept
+     : m{m00,m01,m02,m03,m10,m11,m12,m13,m20,m21,m22,m23}
+    {}
+
+    /**
+     * @brief Construct a new 3*4 matrix
+     * 
+     * @param r0 a const reference to a 4D float vector for the top row
+     * @param r1 a const reference to a 4D float vector for the middle row
+     * @param r2 a const reference to a 4D float vector for the bottom row
+     */
+    inline constexpr s_mat3x4(const vec4& r0, const vec4& r1, const vec4& r2) noexcept
+     : rows{r0,r1,r2}
+    {}
+
+    /**
+     * @brief Construct a new 3*4 matrix from a 4*4 matrix
+     * 
+     * The bottom row of the 4*4 matrix is dropped, it should be (0, 0, 0, 1)
+     * 
+     * @param mat the 4*4 matrix to convert
+     */
+    explicit inline constexpr s_mat3x4(const mat4& mat) noexcept
+     : rows{mat.rows[0], mat.rows[1], mat.rows[2]}
+    {}
+
+    /**
+     * @brief Construct a new 3*4 matrix from a 4*4 double matrix
+     * 
+     * The bottom row of the 4*4 matrix is dropped, it should be (0, 0, 0, 1)
+     * 
+     * @param mat the 4*4 double matrix to convert
+     */
+    explicit inline constexpr s_mat3x4(const dmat4& mat) noexcept
+     : m{(float)mat.m[0], (float)mat.m[1], (float)mat.m[2],  (float)mat.m[3],
+         (float)mat.m[4], (float)mat.m[5], (float)mat.m[6],  (float)mat.m[7],
+         (float)mat.m[8], (float)mat.m[9], (float)mat.m[10], (float)mat.m[11]}
+    {}
+
+    /**
+     * @brief convert the matrix to a 4*4 matrix
+     * 
+     * @return mat4 the 4*4 matrix with the bottom row (0, 0, 0, 1)
+     */
+    inline constexpr mat4 toMat4() const noexcept
+    {return mat4(rows[0], rows[1], rows[2], vec4(0.f, 0.f, 0.f, 1.f));}
+
+    /**
+     * @brief convert the matrix to a 4*4 double matrix
+     * 
+     * @return dmat4 the 4*4 double matrix with the bottom row (0, 0, 0, 1)
+     */
+    inline constexpr dmat4 toDMat4() const noexcept {
+        return dmat4(
+            m[0], m[1], m[2],  m[3],
+            m[4], m[5], m[6],  m[7],
+            m[8], m[9], m[10], m[11],
+            0.,   0.,   0.,    1.
+        );
+    }
+
+    /**
+     * @brief compose two affine transformations
+     * 
+     * The product is the same as the product of the 4*4 matrices, but the bottom row of the other matrix is (0, 0, 0, 1).
+     * So every row of the product only needs three of the broadcasted elements, the w element of the row is added to
+     * the translation. The multiplications and additions are not fused, so the result matches the batched product.
+     * 
+     * @param c the other matrix, it is applied first
+     * @return s_mat3x4 the product of the two matrices
+     */
+    inline s_mat3x4 operator*(const s_mat3x4& c) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        //only keeps the w lane of a row
+        __m128 wMask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+        //compute a single row of the product by broadcasting the elements of the row and summing up the scaled rows of the other matrix
+        auto row = [&c, wMask](__m128 a) noexcept -> __m128 {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0,0,0,0)), c.rows[0].simd);
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1,1,1,1)), c.rows[1].simd));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2,2,2,2)), c.rows[2].simd));
+            return _mm_add_ps(r, _mm_and_ps(a, wMask));
+        };
+        return s_mat3x4(vec4(row(rows[0].simd)), vec4(row(rows[1].simd)), vec4(row(rows[2].simd)));
+        #else
+        auto row = [&c](const vec4& a) noexcept -> vec4 {
+            return vec4(
+                (a.x * c.rows[0].x + a.y * c.rows[1].x) + a.z * c.rows[2].x,
+                (a.x * c.rows[0].y + a.y * c.rows[1].y) + a.z * c.rows[2].y,
+                (a.x * c.rows[0].z + a.y * c.rows[1].z) + a.z * c.rows[2].z,
+                ((a.x * c.rows[0].w + a.y * c.rows[1].w) + a.z * c.rows[2].w) + a.w
+            );
+        };
+        return s_mat3x4(row(rows[0]), row(rows[1]), row(rows[2]));
+        #endif
+    }
+
+    /**
+     * @brief multiply this matrix by another matrix
+     * 
+     * @param c the other matrix (may be this matrix, the product is finished before it is stored)
+     */
+    inline void operator*=(const s_mat3x4& c) noexcept
+    {*this = *this * c;}
+
+    /**
+     * @brief multiply this matrix by a vector and return the result
+     * 
+     * @param v the vector
+     * @return vec4 the product of the matrix and the vector, the w element is the w element of the vector
+     */
+    inline vec4 operator*(const vec4& v) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        //multiply all rows with the vector, the implicit bottom row only keeps the w element
+        __m128 p0 = _mm_mul_ps(rows[0].simd, v.simd);
+        __m128 p1 = _mm_mul_ps(rows[1].simd, v.simd);
+        __m128 p2 = _mm_mul_ps(rows[2].simd, v.simd);
+        __m128 p3 = _mm_and_ps(v.simd, _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1)));
+        //transpose the products so p0 holds all x products, p1 all y products and so on
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+        //sum up in the same order as the scalar code does
+        return _mm_add_ps(_mm_add_ps(_mm_add_ps(p0, p1), p2), p3);
+        #else
+        return vec4(
+            ((v.x * rows[0].x + v.y * rows[0].y) + v.z * rows[0].z) + v.w * rows[0].w,
+            ((v.x * rows[1].x + v.y * rows[1].y) + v.z * rows[1].z) + v.w * rows[1].w,
+            ((v.x * rows[2].x + v.y * rows[2].y) + v.z * rows[2].z) + v.w * rows[2].w,
+            v.w
+        );
+        #endif
+    }
+
+    /**
+     * @brief transform a point (w = 1), the translation is applied
+     * 
+     * @param p the point to transform
+     * @return vec3 the transformed point
+     */
+    inline vec3 transformPoint(const vec3& p) const noexcept {
+        vec4 r = *this * vec4(p.x, p.y, p.z, 1.f);
+        return vec3(r.x, r.y, r.z);
+    }
+
+    /**
+     * @brief transform a direction (w = 0), the translation is not applied
+     * 
+     * @param d the direction to transform
+     * @return vec3 the transformed direction
+     */
+    inline vec3 transformDirection(const vec3& d) const noexcept {
+        vec4 r = *this * vec4(d.x, d.y, d.z, 0.f);
+        return vec3(r.x, r.y, r.z);
+    }
+
+    /**
+     * @brief calculate the determinant of the matrix
+     * 
+     * The implicit bottom row makes the determinant the determinant of the upper left 3x3 part
+     * 
+     * @return float the determinant of this matrix
+     */
+    inline constexpr float determinant() const noexcept {
+        return (rows[0].x * (rows[1].y * rows[2].z - rows[1].z * rows[2].y)
+              + rows[0].y * (rows[1].z * rows[2].x - rows[1].x * rows[2].z))
+              + rows[0].z * (rows[1].x * rows[2].y - rows[1].y * rows[2].x);
+    }
+
+    /**
+     * @brief check if the matrix has an inverse matrix
+     * 
+     * @return true : an inverse matrix exists
+     * @return false : no inverse matrix exists
+     */
+    inline constexpr bool hasInverse() const noexcept {return determinant() != 0;}
+
+    /**
+     * @brief calculate the inverse of the matrix
+     * 
+     * Only the upper 3x3 part is inverted, the translation is rotated by that inverse and negated. The steps are the same
+     * as in mat4::inverseAffine(), so the results match.
+     * 
+     * @return s_mat3x4 the inverse matrix
+     */
+    inline s_mat3x4 inverse() const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        __m128 a = rows[0].simd;
+        __m128 b = rows[1].simd;
+        __m128 c = rows[2].simd;
+        //the columns of the inverse of the 3x3 part are the cross products of the rows (the w lanes cancel out to 0)
+        __m128 x = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1))));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1))));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1))));
+        //the determinant is the dot product of the top row and the first column
+        __m128 det = _mm_mul_ps(a, x);
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2,3,0,1)));
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1,0,3,2)));
+        __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.f), det);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3))),
+                                         _mm_mul_ps(y, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3)))),
+                              _mm_mul_ps(z, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,3,3,3))));
+        t = _mm_xor_ps(t, _mm_set1_ps(-0.f));
+        //x, y, z and t are the columns of the result
+        _MM_TRANSPOSE4_PS(x, y, z, t);
+        return s_mat3x4(vec4(_mm_mul_ps(x, inv_det)), vec4(_mm_mul_ps(y, inv_det)), vec4(_mm_mul_ps(z, inv_det)));
+        #else
+        //the columns of the inverse of the 3x3 part are the cross products of the rows
+        vec3 x(rows[1].y * rows[2].z - rows[1].z * rows[2].y, rows[1].z * rows[2].x - rows[1].x * rows[2].z, rows[1].x * rows[2].y - rows[1].y * rows[2].x);
+        vec3 y(rows[2].y * rows[0].z - rows[2].z * rows[0].y, rows[2].z * rows[0].x - rows[2].x * rows[0].z, rows[2].x * rows[0].y - rows[2].y * rows[0].x);
+        vec3 z(rows[0].y * rows[1].z - rows[0].z * rows[1].y, rows[0].z * rows[1].x - rows[0].x * rows[1].z, rows[0].x * rows[1].y - rows[0].y * rows[1].x);
+        float inv_det = 1.f / ((rows[0].x * x.x + rows[0].y * x.y) + rows[0].z * x.z);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        vec3 t = (x * rows[0].w + y * rows[1].w) + z * rows[2].w;
+        return s_mat3x4(
+            x.x * inv_det, y.x * inv_det, z.x * inv_det, -t.x * inv_det,
+            x.y * inv_det, y.y * inv_det, z.y * inv_det, -t.y * inv_det,
+            x.z * inv_det, y.z * inv_det, z.z * inv_det, -t.z * inv_det
+        );
+        #endif
+    }
+
+    /**
+     * @brief calculate the inverse of a rigid matrix
+     * 
+     * The upper 3x3 part must be a pure rotation (orthonormal). The rotation is transposed and the translation is rotated
+     * by the transposed rotation and negated.
+     * 
+     * @return s_mat3x4 the inverse matrix
+     */
+    inline s_mat3x4 inverseRigid() const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        __m128 a = rows[0].simd;
+        __m128 b = rows[1].simd;
+        __m128 c = rows[2].simd;
+        //the new translation is the negated translation transformed by the transposed rotation
+        __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3))),
+                                         _mm_mul_ps(b, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3)))),
+                              _mm_mul_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,3,3,3))));
+        t = _mm_xor_ps(t, _mm_set1_ps(-0.f));
+        //transposing the rows with the new translation as the bottom row moves the translation to the last column
+        _MM_TRANSPOSE4_PS(a, b, c, t);
+        return s_mat3x4(vec4(a), vec4(b), vec4(c));
+        #else
+        //the new translation is the negated translation transformed by the transposed rotation
+        vec3 t = (vec3(rows[0].x, rows[0].y, rows[0].z) * rows[0].w + vec3(rows[1].x, rows[1].y, rows[1].z) * rows[1].w)
+                 + vec3(rows[2].x, rows[2].y, rows[2].z) * rows[2].w;
+        return s_mat3x4(
+            rows[0].x, rows[1].x, rows[2].x, -t.x,
+            rows[0].y, rows[1].y, rows[2].y, -t.y,
+            rows[0].z, rows[1].z, rows[2].z, -t.z
+        );
+        #endif
+    }
+
+    #endif
+
+} mat3x4;
+
+//for C++ start a C-Section
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief convert a 4x4 matrix to a 3x4 matrix by dropping the bottom row
+ * 
+ * @param mat a constant pointer to the 4x4 matrix, its bottom row should be (0, 0, 0, 1)
+ * @return mat3x4 the 3x4 matrix
+ */
+mat3x4 mat3x4_fromMat4(const mat4* mat);
+
+/**
+ * @brief convert a 3x4 matrix to a 4x4 matrix
+ * 
+ * @param mat a constant pointer to the 3x4 matrix
+ * @return mat4 the 4x4 matrix with the bottom row (0, 0, 0, 1)
+ */
+mat4 mat3x4_toMat4(const mat3x4* mat);
+
+/**
+ * @brief convert a 4x4 double matrix to a 3x4 matrix by dropping the bottom row
+ * 
+ * @param mat a constant pointer to the 4x4 double matrix, its bottom row should be (0, 0, 0, 1)
+ * @return mat3x4 the 3x4 matrix
+ */
+mat3x4 mat3x4_fromDMat4(const dmat4* mat);
+
+/**
+ * @brief convert a 3x4 matrix to a 4x4 double matrix
+ * 
+ * @param mat a constant pointer to the 3x4 matrix
+ * @return dmat4 the 4x4 double matrix with the bottom row (0, 0, 0, 1)
+ */
+dmat4 mat3x4_toDMat4(const mat3x4* mat);
+
+/**
+ * @brief compose two affine transformations
+ * 
+ * @param a a constant pointer to the transformation that is applied last
+ * @param b a constant pointer to the transformation that is applied first
+ * @return mat3x4 the product of both matrices
+ */
+mat3x4 mat3x4_multiply(const mat3x4* a, const mat3x4* b);
+
+/**
+ * @brief multiply another matrix to a matrix
+ * 
+ * @param a a pointer to the matrix to multiply with and to
+ * @param b a constant pointer to the matrix to multiply with
+ */
+void mat3x4_multiplyTo(mat3x4* a, const mat3x4* b);
+
+/**
+ * @brief apply the matrix to a vector by multiplying them together
+ * 
+ * @param a a constant pointer to the matrix to apply
+ * @param b a constant pointer to the vector to multiply with the matrix
+ * @return vec4 the product of the matrix and the vector
+ */
+vec4 mat3x4_apply(const mat3x4* a, const vec4* b);
+
+/**
+ * @brief transform a point (w = 1) by a matrix
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param p a constant pointer to the point to transform
+ * @return vec3 the transformed point
+ */
+vec3 mat3x4_transformPoint(const mat3x4* mat, const vec3* p);
+
+/**
+ * @brief transform a direction (w = 0) by a matrix
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param d a constant pointer to the direction to transform
+ * @return vec3 the transformed direction
+ */
+vec3 mat3x4_transformDirection(const mat3x4* mat, const vec3* d);
+
+/**
+ * @brief compute the determinant of a matrix
+ * 
+ * @param mat a constant pointer to the matrix to compute the determinant of
+ * @return float the determinant of the matrix
+ */
+float mat3x4_determinant(const mat3x4* mat);
+
+/**
+ * @brief check if a matrix has an inverse matrix
+ * 
+ * @param mat a constant pointer to the matrix to check
+ * @return true : an inverse matrix can be constructured
+ * @return false : no inverse matrix exists
+ */
+bool mat3x4_hasInverse(const mat3x4* mat);
+
+/**
+ * @brief compute the inverse of a matrix
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return mat3x4 the inverse matrix
+ */
+mat3x4 mat3x4_inverse(const mat3x4* mat);
+
+/**
+ * @brief compute the inverse of a rigid matrix (rotation and translation only)
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return mat3x4 the inverse matrix
+ */
+mat3x4 mat3x4_inverseRigid(const mat3x4* mat);
+
+/**
+ * @brief compose the matrices of two arrays element by element
+ * 
+ * Multiple products are computed at once if the CPU supports wide registers. The results are bit-identical to mat3x4_multiply.
+ * 
+ * @param a a constant pointer to the transformations that are applied last
+ * @param b a constant pointer to the transformations that are applied first
+ * @param out a pointer to the array to write the products to (may be the same as a or b)
+ * @param n the amount of matrices to multiply
+ */
+void mat3x4_multiplyArray(const mat3x4* a, const mat3x4* b, mat3x4* out, size_t n);
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * Multiple matrices are inverted at once if the CPU supports wide registers. The results are bit-identical to mat3x4_inverse.
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param n the amount of matrices to invert
+ */
+void mat3x4_inverseArray(const mat3x4* in, mat3x4* out, size_t n);
+
+/**
+ * @brief transform an array of 3D points by a matrix
+ * 
+ * The points are extended with a w of 1, so the translation is applied. If the output is larger than
+ * GLGE_MATH_STREAMING_THRESHOLD and aligned to 16 bytes it is written with non-temporal stores.
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param n the amount of points to transform
+ */
+void mat3x4_transformPoints(const mat3x4* mat, const vec3* in, vec3* out, size_t n);
+
+/**
+ * @brief transform an array of 3D directions by a matrix
+ * 
+ * The directions are extended with a w of 0, so the translation is not applied.
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param n the amount of directions to transform
+ */
+void mat3x4_transformDirections(const mat3x4* mat, const vec3* in, vec3* out, size_t n);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief transform an array of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param count the amount of points to transform
+ */
+inline void transformPoints(const mat3x4& mat, const vec3* in, vec3* out, size_t count) noexcept
+{mat3x4_transformPoints(&mat, in, out, count);}
+
+/**
+ * @brief transform an array of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param count the amount of directions to transform
+ */
+inline void transformDirections(const mat3x4& mat, const vec3* in, vec3* out, size_t count) noexcept
+{mat3x4_transformDirections(&mat, in, out, count);}
+
+/**
+ * @brief compose the matrices of two arrays element by element
+ * 
+ * @param a a constant pointer to the transformations that are applied last
+ * @param b a constant pointer to the transformations that are applied first
+ * @param out a pointer to the array to write the products to (may be the same as a or b)
+ * @param count the amount of matrices to multiply
+ */
+inline void multiply(const mat3x4* a, const mat3x4* b, mat3x4* out, size_t count) noexcept
+{mat3x4_multiplyArray(a, b, out, count);}
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param count the amount of matrices to invert
+ */
+inline void inverse(const mat3x4* in, mat3x4* out, size_t count) noexcept
+{mat3x4_inverseArray(in, out, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief transform a span of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the points to transform
+ * @param out the span to write the transformed points to, only as many elements as both spans hold are transformed
+ */
+inline void transformPoints(const mat3x4& mat, std::span<const vec3> in, std::span<vec3> out) noexcept
+{mat3x4_transformPoints(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the directions to transform
+ * @param out the span to write the transformed directions to, only as many elements as both spans hold are transformed
+ */
+inline void transformDirections(const mat3x4& mat, std::span<const vec3> in, std::span<vec3> out) noexcept
+{mat3x4_transformDirections(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief compose the matrices of two spans element by element
+ * 
+ * @param a the transformations that are applied last
+ * @param b the transformations that are applied first
+ * @param out the span to write the products to, only as many elements as all spans hold are multiplied
+ */
+inline void multiply(std::span<const mat3x4> a, std::span<const mat3x4> b, std::span<mat3x4> out) noexcept {
+    size_t count = (a.size() < b.size()) ? a.size() : b.size();
+    mat3x4_multiplyArray(a.data(), b.data(), out.data(), (count < out.size()) ? count : out.size());
+}
+
+/**
+ * @brief compute the inverse of every matrix in a span
+ * 
+ * @param in the matrices to invert
+ * @param out the span to write the inverse matrices to, only as many elements as both spans hold are inverted
+ */
+inline void inverse(std::span<const mat3x4> in, std::span<mat3x4> out) noexcept
+{mat3x4_inverseArray(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
+
+#endif
+
+#endif
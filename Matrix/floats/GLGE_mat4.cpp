@@ -11,6 +11,8 @@
 
 //include the 2*2 float matrices
 #include "GLGE_mat4.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
 
 mat4 mat4_add(const mat4* a, const mat4* b) {return *a + *b;}
 
@@ -48,4 +50,31 @@ mat4 mat4_adjugate(const mat4* mat) {return mat->adjugate();}
 
 mat4 mat4_traspose(const mat4* mat) {return mat->transpose();}
 
-mat4 mat4_inverse(const mat4* mat) {return mat->inverse();}
\ No newline at end of file
+mat4 mat4_inverse(const mat4* mat) {return mat->inverse();}
+
+mat4 mat4_inverseAffine(const mat4* mat) {return mat->inverseAffine();}
+
+mat4 mat4_inverseRigid(const mat4* mat) {return mat->inverseRigid();}
+
+mat4 mat4_inverseUniformScale(const mat4* mat) {return mat->inverseUniformScale();}
+
+void mat4_inverseArray(const mat4* in, mat4* out, size_t n) 
+{glge::kernel::table().mat4Inverse((const float*)in, (float*)out, n);}
+
+void mat4_applyArray(const mat4* mat, const vec4* in, vec4* out, size_t n) {
+    //large outputs are written using non-temporal stores so they don't evict the rest of the cache
+    bool stream = (n * sizeof(vec4)) >= GLGE_MATH_STREAMING_THRESHOLD;
+    glge::kernel::table().mat4Transform4(mat->m, (const float*)in, (float*)out, n, stream);
+}
+
+void mat4_transformPoints(const mat4* mat, const vec3* in, vec3* out, size_t n) {
+    //streaming requires the output to be aligned to 16 bytes
+    bool stream = ((n * sizeof(vec3)) >= GLGE_MATH_STREAMING_THRESHOLD) && !(((uintptr_t)out) & 15);
+    glge::kernel::table().mat4Transform3(mat->m, (const float*)in, (float*)out, n, true, stream);
+}
+
+void mat4_transformDirections(const mat4* mat, const vec3* in, vec3* out, size_t n) {
+    //streaming requires the output to be aligned to 16 bytes
+    bool stream = ((n * sizeof(vec3)) >= GLGE_MATH_STREAMING_THRESHOLD) && !(((uintptr_t)out) & 15);
+    glge::kernel::table().mat4Transform3(mat->m, (const float*)in, (float*)out, n, false, stream);
+}
@@ -16,6 +16,16 @@
 //include float 3D vectors
 #include "../../Vector/floats/GLGE_vec4.h"
 
+//if SIMD is requested, include SIMD intrinsics
+#include "../../GLGEMath_Settings.h"
+#if GLGE_MATH_USE_SIMD
+#if GLGE_MATH_ALLOW_AVX2
+#include <immintrin.h>
+#else
+#include <xmmintrin.h>
+#endif
+#endif
+
 /**
  * @brief a 4x4 matrix of float elements
  */
@@ -197,12 +207,14 @@ typedef struct s_mat4
     }
 
     /**
-     * @brief multiply this matrix with another matrix and return the result
+     * @brief multiply this matrix with another matrix using only scalar operations
+     * 
+     * This is the matrix product if SIMD is disabled or during constant evaluation
      * 
      * @param c the other matrix
      * @return s_mat4 the product of the two matrices
      */
-    inline constexpr s_mat4 operator*(s_mat4 c) const noexcept {
+    inline constexpr s_mat4 scalarProduct(const s_mat4& c) const noexcept {
         return s_mat4(
             vec4(
                 rows[0].x * c.rows[0].x + rows[0].y * c.rows[1].x + rows[0].z * c.rows[2].x + rows[0].w * c.rows[3].x, 
@@ -230,6 +242,85 @@ typedef struct s_mat4
             )
         );
     }
+
+    //implement the SIMD matrix product
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief multiply this matrix with another matrix and return the result
+     * 
+     * Each row of the product is the row of this matrix times the other matrix. So every element of the row is broadcasted
+     * to all lanes and multiplied with the matching row of the other matrix, then all four products are summed up. 
+     * The product is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+     * 
+     * @param c the other matrix
+     * @return s_mat4 the product of the two matrices
+     */
+    inline GLGE_MATH_SIMD_CONSTEXPR s_mat4 operator*(const s_mat4& c) const noexcept {
+        //intrinsics can't be evaluated at compile time, so constant evaluation uses the scalar product
+        if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return scalarProduct(c);}
+        //check for AVX2 to process two rows at once
+        #if GLGE_MATH_ALLOW_AVX2
+        //duplicate the rows of the other matrix into both 128 bit lanes
+        __m256 c0 = _mm256_broadcast_ps(&c.rows[0].simd);
+        __m256 c1 = _mm256_broadcast_ps(&c.rows[1].simd);
+        __m256 c2 = _mm256_broadcast_ps(&c.rows[2].simd);
+        __m256 c3 = _mm256_broadcast_ps(&c.rows[3].simd);
+        //load the two upper and the two lower rows of this matrix
+        __m256 a01 = _mm256_loadu_ps(m);
+        __m256 a23 = _mm256_loadu_ps(m + 8);
+        //the sums are only fused into the multiplications if FMA3 is allowed
+        auto madd = [](__m256 a, __m256 b, __m256 c) noexcept -> __m256 {
+            #if GLGE_MATH_ALLOW_FMA
+            return _mm256_fmadd_ps(a, b, c);
+            #else
+            return _mm256_add_ps(c, _mm256_mul_ps(a, b));
+            #endif
+        };
+        //the permutes broadcast the x, y, z and w element of each row to all lanes of the 128 bit lane of the row
+        __m256 r01 = _mm256_mul_ps(_mm256_permute_ps(a01, 0x00), c0);
+        __m256 r23 = _mm256_mul_ps(_mm256_permute_ps(a23, 0x00), c0);
+        r01 = madd(_mm256_permute_ps(a01, 0x55), c1, r01);
+        r23 = madd(_mm256_permute_ps(a23, 0x55), c1, r23);
+        r01 = madd(_mm256_permute_ps(a01, 0xAA), c2, r01);
+        r23 = madd(_mm256_permute_ps(a23, 0xAA), c2, r23);
+        r01 = madd(_mm256_permute_ps(a01, 0xFF), c3, r01);
+        r23 = madd(_mm256_permute_ps(a23, 0xFF), c3, r23);
+        //split the register pairs back into the rows
+        return s_mat4(
+            vec4(_mm256_castps256_ps128(r01)), vec4(_mm256_extractf128_ps(r01, 1)),
+            vec4(_mm256_castps256_ps128(r23)), vec4(_mm256_extractf128_ps(r23, 1))
+        );
+        #else
+        //compute a single row of the product by broadcasting the elements of the row and summing up the scaled rows of the other matrix
+        auto row = [&c](__m128 a) noexcept -> __m128 {
+            __m128 r = _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0,0,0,0)), c.rows[0].simd);
+            #if GLGE_MATH_ALLOW_FMA
+            r = _mm_fmadd_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1,1,1,1)), c.rows[1].simd, r);
+            r = _mm_fmadd_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2,2,2,2)), c.rows[2].simd, r);
+            return _mm_fmadd_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3)), c.rows[3].simd, r);
+            #else
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(1,1,1,1)), c.rows[1].simd));
+            r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2,2,2,2)), c.rows[2].simd));
+            return _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3)), c.rows[3].simd));
+            #endif
+        };
+        return s_mat4(vec4(row(rows[0].simd)), vec4(row(rows[1].simd)), vec4(row(rows[2].simd)), vec4(row(rows[3].simd)));
+        #endif
+    }
+
+    #else //else, implement the scalar matrix product
+
+    /**
+     * @brief multiply this matrix with another matrix and return the result
+     * 
+     * @param c the other matrix
+     * @return s_mat4 the product of the two matrices
+     */
+    inline constexpr s_mat4 operator*(const s_mat4& c) const noexcept {return scalarProduct(c);}
+
+    #endif
+
     /**
      * @brief scale the matrix and return the result
      * 
@@ -251,39 +342,34 @@ typedef struct s_mat4
      * @return vec4 the product of this matrix and the vector
      */
     inline vec4 operator*(const vec4& v) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        //multiply all rows with the vector, each lane holds a single product of the dot products
+        __m128 p0 = _mm_mul_ps(rows[0].simd, v.simd);
+        __m128 p1 = _mm_mul_ps(rows[1].simd, v.simd);
+        __m128 p2 = _mm_mul_ps(rows[2].simd, v.simd);
+        __m128 p3 = _mm_mul_ps(rows[3].simd, v.simd);
+        //transpose the products so p0 holds all x products, p1 all y products and so on
+        _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+        //sum up in the same order as the scalar code does. The transpose separates the multiplications from the additions, 
+        //so they can not be contracted to FMA and the result is bit-identical for the SSE and the AVX2 build
+        return _mm_add_ps(_mm_add_ps(_mm_add_ps(p0, p1), p2), p3);
+        #else
         return vec4(
             v.x * rows[0].x + v.y * rows[0].y + v.z * rows[0].z + v.w * rows[0].w,
             v.x * rows[1].x + v.y * rows[1].y + v.z * rows[1].z + v.w * rows[1].w,
             v.x * rows[2].x + v.y * rows[2].y + v.z * rows[2].z + v.w * rows[2].w,
             v.x * rows[3].x + v.y * rows[3].y + v.z * rows[3].z + v.w * rows[3].w
         );
+        #endif
     }
     /**
      * @brief multiply this matrix by another matrix
      * 
-     * @param c the other matrix
+     * @param c the other matrix (may be this matrix, the product is finished before it is stored)
      */
-    inline constexpr void operator*=(s_mat4 c) noexcept {
-        //create a temporary container for the matrix elements
-        s_mat4 t = *this;
-        //override the elements with the calculated values
-        rows[0].x = t.rows[0].x * c.rows[0].x + t.rows[0].y * c.rows[1].x + t.rows[0].z * c.rows[2].x + t.rows[0].w * c.rows[3].x; 
-        rows[0].y = t.rows[0].x * c.rows[0].y + t.rows[0].y * c.rows[1].y + t.rows[0].z * c.rows[2].y + t.rows[0].w * c.rows[3].y; 
-        rows[0].z = t.rows[0].x * c.rows[0].z + t.rows[0].y * c.rows[1].z + t.rows[0].z * c.rows[2].z + t.rows[0].w * c.rows[3].z; 
-        rows[0].w = t.rows[0].x * c.rows[0].w + t.rows[0].y * c.rows[1].w + t.rows[0].z * c.rows[2].w + t.rows[0].w * c.rows[3].w;
-        rows[1].x = t.rows[1].x * c.rows[0].x + t.rows[1].y * c.rows[1].x + t.rows[1].z * c.rows[2].x + t.rows[1].w * c.rows[3].x; 
-        rows[1].y = t.rows[1].x * c.rows[0].y + t.rows[1].y * c.rows[1].y + t.rows[1].z * c.rows[2].y + t.rows[1].w * c.rows[3].y; 
-        rows[1].z = t.rows[1].x * c.rows[0].z + t.rows[1].y * c.rows[1].z + t.rows[1].z * c.rows[2].z + t.rows[1].w * c.rows[3].z; 
-        rows[1].w = t.rows[1].x * c.rows[0].w + t.rows[1].y * c.rows[1].w + t.rows[1].z * c.rows[2].w + t.rows[1].w * c.rows[3].w;
-        rows[2].x = t.rows[2].x * c.rows[0].x + t.rows[2].y * c.rows[1].x + t.rows[2].z * c.rows[2].x + t.rows[2].w * c.rows[3].x; 
-        rows[2].y = t.rows[2].x * c.rows[0].y + t.rows[2].y * c.rows[1].y + t.rows[2].z * c.rows[2].y + t.rows[2].w * c.rows[3].y; 
-        rows[2].z = t.rows[2].x * c.rows[0].z + t.rows[2].y * c.rows[1].z + t.rows[2].z * c.rows[2].z + t.rows[2].w * c.rows[3].z; 
-        rows[2].w = t.rows[2].x * c.rows[0].w + t.rows[2].y * c.rows[1].w + t.rows[2].z * c.rows[2].w + t.rows[2].w * c.rows[3].w;
-        rows[3].x = t.rows[3].x * c.rows[0].x + t.rows[3].y * c.rows[1].x + t.rows[3].z * c.rows[2].x + t.rows[3].w * c.rows[3].x; 
-        rows[3].y = t.rows[3].x * c.rows[0].y + t.rows[3].y * c.rows[1].y + t.rows[3].z * c.rows[2].y + t.rows[3].w * c.rows[3].y; 
-        rows[3].z = t.rows[3].x * c.rows[0].z + t.rows[3].y * c.rows[1].z + t.rows[3].z * c.rows[2].z + t.rows[3].w * c.rows[3].z; 
-        rows[3].w = t.rows[3].x * c.rows[0].w + t.rows[3].y * c.rows[1].w + t.rows[3].z * c.rows[2].w + t.rows[3].w * c.rows[3].w;
-    }
+    inline GLGE_MATH_SIMD_CONSTEXPR void operator*=(const s_mat4& c) noexcept
+    {*this = *this * c;}
+
     /**
      * @brief scale this matrix
      * 
@@ -303,32 +389,28 @@ typedef struct s_mat4
      */
     inline constexpr float determinant() const noexcept {
         /**
-         * a deterimant of a 4x4 matrix is calculated like this:
-         * det = m[0].x * det(M00) + m[0].y * det(M01) + m[0].z * det(M02) + m[0].w * det(M03)
-         * Where Mxy denotes a 3x3 sub-matrix where the xth column and yth row are deleted
-         * det() is a fictional command to compute the determinant of a 3x3 matrix
-         * 
-         * The determinant of a 3x3 matrix is computed as follows:
-         * m[0].x * (m[1].y * m[2].z - m[1].z * m[2].y) - m[0].y * (m[1].x * m[2].z - m[1].z * m[2].x) + m[0].z * (m[1].x * m[2].y - m[1].y * m[2].x)
-         * 
-         * Now replacing each element with the correct index to fit the sub-matricies:
-         * M00: m[1].y * (m[2].z * m[3].w - m[2].w * m[3].z) - m[1].z * (m[2].y * m[3].w - m[2].w * m[3].y) + m[1].w * (m[2].y * m[3].z - m[2].z * m[3].y)
-         * M01: m[1].x * (m[2].z * m[3].w - m[2].w * m[3].z) - m[1].z * (m[2].x * m[3].w - m[2].w * m[3].x) + m[1].w * (m[2].x * m[3].z - m[2].z * m[3].x)
-         * M02: m[1].x * (m[2].y * m[3].w - m[2].w * m[3].y) - m[1].y * (m[2].x * m[3].w - m[2].w * m[3].x) + m[1].w * (m[2].x * m[3].y - m[2].y * m[3].x)
-         * M03: m[1].x * (m[2].y * m[3].z - m[2].z * m[3].y) - m[1].y * (m[2].x * m[3].z - m[2].z * m[3].x) + m[1].z * (m[2].x * m[3].y - m[2].y * m[3].x)
+         * The determinant is expanded along the top row: det = m[0].x * C00 + m[0].y * C01 + m[0].z * C02 + m[0].w * C03
+         * Where Cxy denotes the cofactor of the element in the xth row and yth column.
          * 
-         * //plug the determinants into the exquation:
+         * All cofactors of the top row are made of the 2x2 sub-determinants of the lower two rows, so only the
+         * 6 different sub-determinants are computed and shared between the cofactors.
+         * The sum uses the same steps as inverse(), so the determinant and the inverse match exactly.
          */
-        return (
-            //m[0].x * det(M00)
-            rows[0].x * (rows[1].y * (rows[2].z * rows[3].w - rows[2].w * rows[3].z) - rows[1].z * (rows[2].y * rows[3].w - rows[2].w * rows[3].y) + rows[1].w * (rows[2].y * rows[3].z - rows[2].z * rows[3].y)) - 
-            //m[0].y * det(M01)
-            rows[0].y * (rows[1].x * (rows[2].z * rows[3].w - rows[2].w * rows[3].z) - rows[1].z * (rows[2].x * rows[3].w - rows[2].w * rows[3].x) + rows[1].w * (rows[2].x * rows[3].z - rows[2].z * rows[3].x)) + 
-            //m[0].z * det(M02)
-            rows[0].z * (rows[1].x * (rows[2].y * rows[3].w - rows[2].w * rows[3].y) - rows[1].y * (rows[2].x * rows[3].w - rows[2].w * rows[3].x) + rows[1].w * (rows[2].x * rows[3].y - rows[2].y * rows[3].x)) - 
-            //m[0].w * det(M03)
-            rows[0].w * (rows[1].x * (rows[2].y * rows[3].z - rows[2].z * rows[3].y) - rows[1].y * (rows[2].x * rows[3].z - rows[2].z * rows[3].x) + rows[1].z * (rows[2].x * rows[3].y - rows[2].y * rows[3].x))
-        );
+        //2x2 sub-determinants of the lower two rows, the numbers are the columns of the sub-matrix
+        float s01 = rows[2].x * rows[3].y - rows[2].y * rows[3].x;
+        float s02 = rows[2].x * rows[3].z - rows[2].z * rows[3].x;
+        float s03 = rows[2].x * rows[3].w - rows[2].w * rows[3].x;
+        float s12 = rows[2].y * rows[3].z - rows[2].z * rows[3].y;
+        float s13 = rows[2].y * rows[3].w - rows[2].w * rows[3].y;
+        float s23 = rows[2].z * rows[3].w - rows[2].w * rows[3].z;
+
+        //cofactors of the top row
+        float c0 =  ((rows[1].y * s23 - rows[1].z * s13) + rows[1].w * s12);
+        float c1 = -((rows[1].x * s23 - rows[1].z * s03) + rows[1].w * s02);
+        float c2 =  ((rows[1].x * s13 - rows[1].y * s03) + rows[1].w * s01);
+        float c3 = -((rows[1].x * s12 - rows[1].y * s02) + rows[1].z * s01);
+
+        return (rows[0].x * c0 + rows[0].y * c1) + (rows[0].z * c2 + rows[0].w * c3);
     }
 
     /**
@@ -344,104 +426,8 @@ typedef struct s_mat4
      * 
      * @return constexpr s_mat4 the cofactor matrix
      */
-    inline constexpr s_mat4 cofactors() const noexcept {
-        /**
-         * Value source: https://semath.info/src/cofactor-matrix.html
-         * 
-         * Representation in an intermediate format represented by a number for the row and a vector element (x,y,z or w) for the column
-         * Example: 0x represents the top left element of the matrix and 3w the bottom right element
-         * Multiplication can be represented by the multiply operator (*) or a space
-         * 
-         * Row 0:
-         * 0x =  1y 2z 3w + 1z 2w 3y + 1w 2y 3z
-         *      -1w 2z 3y - 1z 2y 3w - 1y 2w 3z
-         * 0y =  0y 2z 3w + 0z 2w 3y + 0w 2y 3z
-         *      -0w 2z 3y - 0z 2y 3w - 0y 2w 3z
-         * 0z =  0y 1z 3w + 0z 1w 3y + 0w 1y 3z
-         *      -0w 1z 3y - 0z 1y 3w - 0y 1w 3z
-         * 0w =  0y 1z 2w + 0z 1w 2y + 0w 1y 2z
-         *      -0w 1z 2y - 0z 1y 2w - 0y 1w 2z
-         * 
-         * Row 1:
-         * 1x =  1x 2z 3w + 1z 2w 3x + 1w 2x 3z
-         *      -1w 2z 3x - 1z 2x 3w - 1x 2w 3z
-         * 1y =  0x 2z 3w + 0z 2w 3x + 0w 2x 3z
-         *      -0w 2z 3x - 0z 2x 3w - 0x 2w 3z
-         * 1z =  0x 1z 3w + 0z 1w 3x + 0w 1x 3z
-         *      -0w 1z 3x - 0z 1x 3w - 0x 1w 3z
-         * 1w =  0x 1z 2w + 0z 1w 2x + 0w 1x 2z
-         *      -0w 1z 2x - 0z 1x 2w - 0x 1w 2z
-         * 
-         * Row 2:
-         * 2x =  1x 2y 3w + 1y 2w 3x + 1w 2x 3y
-         *      -1w 2y 3x - 1y 2x 3w - 1x 2w 3y
-         * 2y =  0x 2y 3w + 0y 2w 3x + 0w 2x 3y
-         *      -0w 2y 3x - 0y 2x 3w - 0x 2w 3y
-         * 2z =  0x 1y 3w + 0y 1w 3x + 0w 1x 3y
-         *      -0w 1y 3x - 0y 1x 3w - 0x 1w 3y
-         * 2w =  0x 1y 2w + 0y 1w 2x + 0w 1x 2y
-         *      -0w 1y 2x - 0y 1x 2w - 0x 1w 2y
-         * 
-         * Row 3:
-         * 3x =  1x 2y 3z + 1y 2z 3x + 1z 2x 3y
-         *      -1z 2y 3x - 1y 2x 3z - 1x 2z 3y
-         * 3y =  0x 2y 3z + 0y 2z 3x + 0z 2x 3y
-         *      -0z 2y 3x - 0y 2x 3z - 0x 2z 3y
-         * 3z =  0x 1y 3z + 0y 1z 3x + 0z 1x 3y
-         *      -0z 1y 3x - 0y 1x 3z - 0x 1z 3y
-         * 1w =  0x 1y 2z + 0y 1z 2x + 0z 1x 2y
-         *      -0z 1y 2x - 0y 1x 2z - 0x 1z 2y
-         * 
-         * Plug all the values into a single matrix to compute the cofactor matrix of any 4x4 matrix
-         * Warning: The values above are TRANSPOSED in comparison to my default layout
-         */
-        return s_mat4(
-            //row 0
-            vec4(
-                 (rows[1].y * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].y + rows[1].w * rows[2].y * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].y - rows[1].z * rows[2].y * rows[3].w - rows[1].y * rows[2].w * rows[3].z),
-                -(rows[1].x * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].x - rows[1].z * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].z),
-                 (rows[1].x * rows[2].y * rows[3].w + rows[1].y * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].y
-                  -rows[1].w * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].y),
-                -(rows[1].x * rows[2].y * rows[3].z + rows[1].y * rows[2].z * rows[3].x + rows[1].z * rows[2].x * rows[3].y
-                  -rows[1].z * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].z - rows[1].x * rows[2].z * rows[3].y)
-            ),
-            //row 1
-            vec4(
-                -(rows[0].y * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].y + rows[0].w * rows[2].y * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].y - rows[0].z * rows[2].y * rows[3].w - rows[0].y * rows[2].w * rows[3].z),
-                 (rows[0].x * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].x - rows[0].z * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].z),
-                -(rows[0].x * rows[2].y * rows[3].w + rows[0].y * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].y
-                  -rows[0].w * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].y),
-                 (rows[0].x * rows[2].y * rows[3].z + rows[0].y * rows[2].z * rows[3].x + rows[0].z * rows[2].x * rows[3].y
-                  -rows[0].z * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].z - rows[0].x * rows[2].z * rows[3].y)
-            ),
-            //row 2
-            vec4(
-                 (rows[0].y * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].y + rows[0].w * rows[1].y * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].y - rows[0].z * rows[1].y * rows[3].w - rows[0].y * rows[1].w * rows[3].z),
-                -(rows[0].x * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].x - rows[0].z * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].z),
-                 (rows[0].x * rows[1].y * rows[3].w + rows[0].y * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].y
-                  -rows[0].w * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[3].z + rows[0].y * rows[1].z * rows[3].x + rows[0].z * rows[1].x * rows[3].y
-                  -rows[0].z * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].z - rows[0].x * rows[1].z * rows[3].y)
-            ),
-            //row 3
-            vec4(
-                -(rows[0].y * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].y + rows[0].w * rows[1].y * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].y - rows[0].z * rows[1].y * rows[2].w - rows[0].y * rows[1].w * rows[2].z),
-                 (rows[0].x * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].x - rows[0].z * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].z),
-                -(rows[0].x * rows[1].y * rows[2].w + rows[0].y * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].y
-                  -rows[0].w * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].y),
-                 (rows[0].x * rows[1].y * rows[2].z + rows[0].y * rows[1].z * rows[2].x + rows[0].z * rows[1].x * rows[2].y
-                  -rows[0].z * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].z - rows[0].x * rows[1].z * rows[2].y)
-            )
-        );
-    };
+    inline constexpr s_mat4 cofactors() const noexcept
+    {return adjugate().transpose();}
 
     /**
      * @brief get the transpose of the matrix
@@ -451,8 +437,8 @@ typedef struct s_mat4
     inline constexpr s_mat4 transpose() const noexcept {
         return s_mat4(
             vec4(rows[0].x, rows[1].x, rows[2].x, rows[3].x),
-            vec4(rows[0].y, rows[1].y, rows[2].y, rows[3].y), 
-            vec4(rows[0].z, rows[1].z, rows[2].z, rows[3].z), 
+            vec4(rows[0].y, rows[1].y, rows[2].y, rows[3].y),
+            vec4(rows[0].z, rows[1].z, rows[2].z, rows[3].z),
             vec4(rows[0].w, rows[1].w, rows[2].w, rows[3].w)
         );
     }
@@ -463,51 +449,65 @@ typedef struct s_mat4
      * @return constexpr s_mat4 the adjugate matrix of this matrix
      */
     inline constexpr s_mat4 adjugate() const noexcept {
-        //same as the cofactor computation, but rows and columns are swapped
+        /**
+         * The element in the ith row and jth column of the adjugate is the cofactor of the element in the jth row and ith column.
+         * The 3x3 minor of that cofactor keeps all rows except j, it is expanded along its top row (row 1 for j = 0, else row 0).
+         * The remaining two rows of the minor are the rows 2 and 3 (j = 0 and j = 1), 1 and 3 (j = 2) or 1 and 2 (j = 3).
+         * 
+         * So every element is made of three 2x2 sub-determinants of one of these row pairs. There are only 18 different
+         * sub-determinants (3 row pairs with 6 column pairs each), they are computed once and shared between all elements.
+         * inverse() uses exactly the same steps, so the SIMD and the scalar implementation produce the same results.
+         */
+        //2x2 sub-determinants of the rows 2 and 3, the numbers are the columns of the sub-matrix
+        float a01 = rows[2].x * rows[3].y - rows[2].y * rows[3].x;
+        float a02 = rows[2].x * rows[3].z - rows[2].z * rows[3].x;
+        float a03 = rows[2].x * rows[3].w - rows[2].w * rows[3].x;
+        float a12 = rows[2].y * rows[3].z - rows[2].z * rows[3].y;
+        float a13 = rows[2].y * rows[3].w - rows[2].w * rows[3].y;
+        float a23 = rows[2].z * rows[3].w - rows[2].w * rows[3].z;
+        //2x2 sub-determinants of the rows 1 and 3
+        float b01 = rows[1].x * rows[3].y - rows[1].y * rows[3].x;
+        float b02 = rows[1].x * rows[3].z - rows[1].z * rows[3].x;
+        float b03 = rows[1].x * rows[3].w - rows[1].w * rows[3].x;
+        float b12 = rows[1].y * rows[3].z - rows[1].z * rows[3].y;
+        float b13 = rows[1].y * rows[3].w - rows[1].w * rows[3].y;
+        float b23 = rows[1].z * rows[3].w - rows[1].w * rows[3].z;
+        //2x2 sub-determinants of the rows 1 and 2
+        float c01 = rows[1].x * rows[2].y - rows[1].y * rows[2].x;
+        float c02 = rows[1].x * rows[2].z - rows[1].z * rows[2].x;
+        float c03 = rows[1].x * rows[2].w - rows[1].w * rows[2].x;
+        float c12 = rows[1].y * rows[2].z - rows[1].z * rows[2].y;
+        float c13 = rows[1].y * rows[2].w - rows[1].w * rows[2].y;
+        float c23 = rows[1].z * rows[2].w - rows[1].w * rows[2].z;
+
         return s_mat4(
-            //row 0
+            //row 0 (minors without column 0)
             vec4(
-                  (rows[1].y * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].y + rows[1].w * rows[2].y * rows[3].z
-                   -rows[1].w * rows[2].z * rows[3].y - rows[1].z * rows[2].y * rows[3].w - rows[1].y * rows[2].w * rows[3].z),
-                -(rows[0].y * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].y + rows[0].w * rows[2].y * rows[3].z
-                   -rows[0].w * rows[2].z * rows[3].y - rows[0].z * rows[2].y * rows[3].w - rows[0].y * rows[2].w * rows[3].z),
-                  (rows[0].y * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].y + rows[0].w * rows[1].y * rows[3].z
-                   -rows[0].w * rows[1].z * rows[3].y - rows[0].z * rows[1].y * rows[3].w - rows[0].y * rows[1].w * rows[3].z),
-                -(rows[0].y * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].y + rows[0].w * rows[1].y * rows[2].z
-                   -rows[0].w * rows[1].z * rows[2].y - rows[0].z * rows[1].y * rows[2].w - rows[0].y * rows[1].w * rows[2].z)
+                 ((rows[1].y * a23 - rows[1].z * a13) + rows[1].w * a12),
+                -((rows[0].y * a23 - rows[0].z * a13) + rows[0].w * a12),
+                 ((rows[0].y * b23 - rows[0].z * b13) + rows[0].w * b12),
+                -((rows[0].y * c23 - rows[0].z * c13) + rows[0].w * c12)
             ),
-            //row 1
+            //row 1 (minors without column 1)
             vec4(
-                -(rows[1].x * rows[2].z * rows[3].w + rows[1].z * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].z
-                  -rows[1].w * rows[2].z * rows[3].x - rows[1].z * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].z),
-                 (rows[0].x * rows[2].z * rows[3].w + rows[0].z * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].z
-                  -rows[0].w * rows[2].z * rows[3].x - rows[0].z * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].z),
-                -(rows[0].x * rows[1].z * rows[3].w + rows[0].z * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].z
-                  -rows[0].w * rows[1].z * rows[3].x - rows[0].z * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].z),
-                 (rows[0].x * rows[1].z * rows[2].w + rows[0].z * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].z
-                  -rows[0].w * rows[1].z * rows[2].x - rows[0].z * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].z)
+                -((rows[1].x * a23 - rows[1].z * a03) + rows[1].w * a02),
+                 ((rows[0].x * a23 - rows[0].z * a03) + rows[0].w * a02),
+                -((rows[0].x * b23 - rows[0].z * b03) + rows[0].w * b02),
+                 ((rows[0].x * c23 - rows[0].z * c03) + rows[0].w * c02)
             ),
-            //row 2
+            //row 2 (minors without column 2)
             vec4(
-                 (rows[1].x * rows[2].y * rows[3].w + rows[1].y * rows[2].w * rows[3].x + rows[1].w * rows[2].x * rows[3].y
-                  -rows[1].w * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].w - rows[1].x * rows[2].w * rows[3].y),
-                -(rows[0].x * rows[2].y * rows[3].w + rows[0].y * rows[2].w * rows[3].x + rows[0].w * rows[2].x * rows[3].y
-                  -rows[0].w * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].w - rows[0].x * rows[2].w * rows[3].y),
-                 (rows[0].x * rows[1].y * rows[3].w + rows[0].y * rows[1].w * rows[3].x + rows[0].w * rows[1].x * rows[3].y
-                  -rows[0].w * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].w - rows[0].x * rows[1].w * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[2].w + rows[0].y * rows[1].w * rows[2].x + rows[0].w * rows[1].x * rows[2].y
-                  -rows[0].w * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].w - rows[0].x * rows[1].w * rows[2].y)
+                 ((rows[1].x * a13 - rows[1].y * a03) + rows[1].w * a01),
+                -((rows[0].x * a13 - rows[0].y * a03) + rows[0].w * a01),
+                 ((rows[0].x * b13 - rows[0].y * b03) + rows[0].w * b01),
+                -((rows[0].x * c13 - rows[0].y * c03) + rows[0].w * c01)
             ),
-            //row 3
+            //row 3 (minors without column 3)
             vec4(
-                -(rows[1].x * rows[2].y * rows[3].z + rows[1].y * rows[2].z * rows[3].x + rows[1].z * rows[2].x * rows[3].y
-                  -rows[1].z * rows[2].y * rows[3].x - rows[1].y * rows[2].x * rows[3].z - rows[1].x * rows[2].z * rows[3].y),
-                 (rows[0].x * rows[2].y * rows[3].z + rows[0].y * rows[2].z * rows[3].x + rows[0].z * rows[2].x * rows[3].y
-                  -rows[0].z * rows[2].y * rows[3].x - rows[0].y * rows[2].x * rows[3].z - rows[0].x * rows[2].z * rows[3].y),
-                -(rows[0].x * rows[1].y * rows[3].z + rows[0].y * rows[1].z * rows[3].x + rows[0].z * rows[1].x * rows[3].y
-                  -rows[0].z * rows[1].y * rows[3].x - rows[0].y * rows[1].x * rows[3].z - rows[0].x * rows[1].z * rows[3].y),
-                 (rows[0].x * rows[1].y * rows[2].z + rows[0].y * rows[1].z * rows[2].x + rows[0].z * rows[1].x * rows[2].y
-                  -rows[0].z * rows[1].y * rows[2].x - rows[0].y * rows[1].x * rows[2].z - rows[0].x * rows[1].z * rows[2].y)
+                -((rows[1].x * a12 - rows[1].y * a02) + rows[1].z * a01),
+                 ((rows[0].x * a12 - rows[0].y * a02) + rows[0].z * a01),
+                -((rows[0].x * b12 - rows[0].y * b02) + rows[0].z * b01),
+                 ((rows[0].x * c12 - rows[0].y * c02) + rows[0].z * c01)
             )
         );
     }
@@ -515,13 +515,186 @@ typedef struct s_mat4
     /**
      * @brief calculate the inverse of the matrix
      * 
+     * The inverse is the adjugate divided by the determinant. The determinant is computed from the first column of the adjugate,
+     * so all 2x2 sub-determinants are only computed once.
+     * 
      * @return s_mat4 the inverse matrix
      */
     inline s_mat4 inverse() const noexcept {
-        //cache the inverse determinant
-        float inv_det = 1.f / determinant();
-        //return a matrix where all elements are swapped correctly and scaled by the inverse determinant
-        return cofactors() * inv_det;
+        #if GLGE_MATH_USE_SIMD
+        //the same steps as adjugate(), but every lane computes a different column of a row of the adjugate
+        __m128 a = rows[0].simd;
+        __m128 b = rows[1].simd;
+        __m128 c = rows[2].simd;
+        __m128 d = rows[3].simd;
+
+        //for every column k of the matrix p holds the top rows (c, c, b, b) and q the bottom rows (d, d, d, c) of the
+        //row pairs of the 2x2 sub-determinants
+        __m128 p0 = _mm_shuffle_ps(c, b, _MM_SHUFFLE(0,0,0,0));
+        __m128 p1 = _mm_shuffle_ps(c, b, _MM_SHUFFLE(1,1,1,1));
+        __m128 p2 = _mm_shuffle_ps(c, b, _MM_SHUFFLE(2,2,2,2));
+        __m128 p3 = _mm_shuffle_ps(c, b, _MM_SHUFFLE(3,3,3,3));
+        __m128 q0 = _mm_shuffle_ps(d, c, _MM_SHUFFLE(0,0,0,0));
+        __m128 q1 = _mm_shuffle_ps(d, c, _MM_SHUFFLE(1,1,1,1));
+        __m128 q2 = _mm_shuffle_ps(d, c, _MM_SHUFFLE(2,2,2,2));
+        __m128 q3 = _mm_shuffle_ps(d, c, _MM_SHUFFLE(3,3,3,3));
+        q0 = _mm_shuffle_ps(q0, q0, _MM_SHUFFLE(2,0,0,0));
+        q1 = _mm_shuffle_ps(q1, q1, _MM_SHUFFLE(2,0,0,0));
+        q2 = _mm_shuffle_ps(q2, q2, _MM_SHUFFLE(2,0,0,0));
+        q3 = _mm_shuffle_ps(q3, q3, _MM_SHUFFLE(2,0,0,0));
+
+        //2x2 sub-determinants for all column pairs, lane 0 and 1 of the rows 2 and 3, lane 2 of the rows 1 and 3 and lane 3 of the rows 1 and 2
+        __m128 s01 = _mm_sub_ps(_mm_mul_ps(p0, q1), _mm_mul_ps(p1, q0));
+        __m128 s02 = _mm_sub_ps(_mm_mul_ps(p0, q2), _mm_mul_ps(p2, q0));
+        __m128 s03 = _mm_sub_ps(_mm_mul_ps(p0, q3), _mm_mul_ps(p3, q0));
+        __m128 s12 = _mm_sub_ps(_mm_mul_ps(p1, q2), _mm_mul_ps(p2, q1));
+        __m128 s13 = _mm_sub_ps(_mm_mul_ps(p1, q3), _mm_mul_ps(p3, q1));
+        __m128 s23 = _mm_sub_ps(_mm_mul_ps(p2, q3), _mm_mul_ps(p3, q2));
+
+        //the rows the minors are expanded along (b, a, a, a) for every column k
+        __m128 v0 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(0,0,0,0));
+        __m128 v1 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(1,1,1,1));
+        __m128 v2 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(2,2,2,2));
+        __m128 v3 = _mm_shuffle_ps(b, a, _MM_SHUFFLE(3,3,3,3));
+        v0 = _mm_shuffle_ps(v0, v0, _MM_SHUFFLE(2,2,2,0));
+        v1 = _mm_shuffle_ps(v1, v1, _MM_SHUFFLE(2,2,2,0));
+        v2 = _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(2,2,2,0));
+        v3 = _mm_shuffle_ps(v3, v3, _MM_SHUFFLE(2,2,2,0));
+
+        //expand the minors and apply the checkerboard signs of the cofactors
+        __m128 signEven = _mm_setr_ps(1.f, -1.f, 1.f, -1.f);
+        __m128 signOdd = _mm_setr_ps(-1.f, 1.f, -1.f, 1.f);
+        __m128 r0 = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(v1, s23), _mm_mul_ps(v2, s13)), _mm_mul_ps(v3, s12)), signEven);
+        __m128 r1 = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(v0, s23), _mm_mul_ps(v2, s03)), _mm_mul_ps(v3, s02)), signOdd);
+        __m128 r2 = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(v0, s13), _mm_mul_ps(v1, s03)), _mm_mul_ps(v3, s01)), signEven);
+        __m128 r3 = _mm_mul_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(v0, s12), _mm_mul_ps(v1, s02)), _mm_mul_ps(v2, s01)), signOdd);
+
+        //the determinant is the dot product of the top row and the first column of the adjugate
+        __m128 col = _mm_shuffle_ps(_mm_shuffle_ps(r0, r1, _MM_SHUFFLE(0,0,0,0)), _mm_shuffle_ps(r2, r3, _MM_SHUFFLE(0,0,0,0)), _MM_SHUFFLE(2,0,2,0));
+        __m128 det = _mm_mul_ps(a, col);
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2,3,0,1)));
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1,0,3,2)));
+        __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.f), det);
+
+        return s_mat4(
+            vec4(_mm_mul_ps(r0, inv_det)),
+            vec4(_mm_mul_ps(r1, inv_det)),
+            vec4(_mm_mul_ps(r2, inv_det)),
+            vec4(_mm_mul_ps(r3, inv_det))
+        );
+        #else
+        s_mat4 adj = adjugate();
+        //the determinant is the dot product of the top row and the first column of the adjugate
+        float inv_det = 1.f / ((rows[0].x * adj.rows[0].x + rows[0].y * adj.rows[1].x) + (rows[0].z * adj.rows[2].x + rows[0].w * adj.rows[3].x));
+        return adj * inv_det;
+        #endif
+    }
+
+    /**
+     * @brief calculate the inverse of an affine matrix
+     * 
+     * The bottom row must be (0, 0, 0, 1). Only the upper 3x3 part is inverted, the translation is rotated by that inverse and negated.
+     * This is a lot cheaper than inverse(), the bottom row of the input is not read.
+     * 
+     * @return s_mat4 the inverse matrix
+     */
+    inline s_mat4 inverseAffine() const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        __m128 a = rows[0].simd;
+        __m128 b = rows[1].simd;
+        __m128 c = rows[2].simd;
+        //the columns of the inverse of the 3x3 part are the cross products of the rows (the w lanes cancel out to 0)
+        __m128 x = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(b, b, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1))));
+        __m128 y = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1))));
+        __m128 z = _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,1,0,2))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3,1,0,2)), _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1))));
+        //the determinant is the dot product of the top row and the first column
+        __m128 det = _mm_mul_ps(a, x);
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(2,3,0,1)));
+        det = _mm_add_ps(det, _mm_shuffle_ps(det, det, _MM_SHUFFLE(1,0,3,2)));
+        __m128 inv_det = _mm_div_ps(_mm_set1_ps(1.f), det);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3))),
+                                         _mm_mul_ps(y, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3)))),
+                              _mm_mul_ps(z, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,3,3,3))));
+        t = _mm_xor_ps(t, _mm_set1_ps(-0.f));
+        //x, y, z and t are the columns of the result
+        _MM_TRANSPOSE4_PS(x, y, z, t);
+        return s_mat4(
+            vec4(_mm_mul_ps(x, inv_det)),
+            vec4(_mm_mul_ps(y, inv_det)),
+            vec4(_mm_mul_ps(z, inv_det)),
+            vec4(0.f, 0.f, 0.f, 1.f)
+        );
+        #else
+        //the columns of the inverse of the 3x3 part are the cross products of the rows
+        vec3 x(rows[1].y * rows[2].z - rows[1].z * rows[2].y, rows[1].z * rows[2].x - rows[1].x * rows[2].z, rows[1].x * rows[2].y - rows[1].y * rows[2].x);
+        vec3 y(rows[2].y * rows[0].z - rows[2].z * rows[0].y, rows[2].z * rows[0].x - rows[2].x * rows[0].z, rows[2].x * rows[0].y - rows[2].y * rows[0].x);
+        vec3 z(rows[0].y * rows[1].z - rows[0].z * rows[1].y, rows[0].z * rows[1].x - rows[0].x * rows[1].z, rows[0].x * rows[1].y - rows[0].y * rows[1].x);
+        float inv_det = 1.f / ((rows[0].x * x.x + rows[0].y * x.y) + rows[0].z * x.z);
+        //the new translation is the negated translation transformed by the (not yet scaled) inverse
+        vec3 t = (x * rows[0].w + y * rows[1].w) + z * rows[2].w;
+        return s_mat4(
+            x.x * inv_det, y.x * inv_det, z.x * inv_det, -t.x * inv_det,
+            x.y * inv_det, y.y * inv_det, z.y * inv_det, -t.y * inv_det,
+            x.z * inv_det, y.z * inv_det, z.z * inv_det, -t.z * inv_det,
+            0.f, 0.f, 0.f, 1.f
+        );
+        #endif
+    }
+
+    /**
+     * @brief calculate the inverse of a rigid matrix
+     * 
+     * The upper 3x3 part must be a pure rotation (orthonormal) and the bottom row must be (0, 0, 0, 1). The rotation is
+     * transposed and the translation is rotated by the transposed rotation and negated.
+     * 
+     * @return s_mat4 the inverse matrix
+     */
+    inline s_mat4 inverseRigid() const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        __m128 a = rows[0].simd;
+        __m128 b = rows[1].simd;
+        __m128 c = rows[2].simd;
+        //the new translation is the negated translation transformed by the transposed rotation
+        __m128 t = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,3,3,3))),
+                                         _mm_mul_ps(b, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,3,3,3)))),
+                              _mm_mul_ps(c, _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,3,3,3))));
+        t = _mm_xor_ps(t, _mm_set1_ps(-0.f));
+        //transposing the rows with the new translation as the bottom row moves the translation to the last column
+        _MM_TRANSPOSE4_PS(a, b, c, t);
+        return s_mat4(vec4(a), vec4(b), vec4(c), vec4(0.f, 0.f, 0.f, 1.f));
+        #else
+        //the new translation is the negated translation transformed by the transposed rotation
+        vec3 t = (vec3(rows[0].x, rows[0].y, rows[0].z) * rows[0].w + vec3(rows[1].x, rows[1].y, rows[1].z) * rows[1].w)
+                 + vec3(rows[2].x, rows[2].y, rows[2].z) * rows[2].w;
+        return s_mat4(
+            rows[0].x, rows[1].x, rows[2].x, -t.x,
+            rows[0].y, rows[1].y, rows[2].y, -t.y,
+            rows[0].z, rows[1].z, rows[2].z, -t.z,
+            0.f, 0.f, 0.f, 1.f
+        );
+        #endif
+    }
+
+    /**
+     * @brief calculate the inverse of a matrix made of a uniform scale, a rotation and a translation
+     * 
+     * The upper 3x3 part must be a rotation multiplied by a single scale factor and the bottom row must be (0, 0, 0, 1).
+     * Like inverseRigid(), but the result is divided by the squared scale, which is read from the length of the top row.
+     * 
+     * @return s_mat4 the inverse matrix
+     */
+    inline s_mat4 inverseUniformScale() const noexcept {
+        //the squared length of any row of the 3x3 part is the squared scale
+        float inv_s2 = 1.f / ((rows[0].x * rows[0].x + rows[0].y * rows[0].y) + rows[0].z * rows[0].z);
+        s_mat4 r = inverseRigid();
+        r.rows[0] *= inv_s2;
+        r.rows[1] *= inv_s2;
+        r.rows[2] *= inv_s2;
+        return r;
     }
 
     #endif
@@ -693,9 +866,173 @@ mat4 mat4_traspose(const mat4* mat);
  */
 mat4 mat4_inverse(const mat4* mat);
 
-//end a potential C-Section
+/**
+ * @brief compute the inverse of an affine matrix (the bottom row is (0, 0, 0, 1))
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return mat4 the inverse matrix
+ */
+mat4 mat4_inverseAffine(const mat4* mat);
+
+/**
+ * @brief compute the inverse of a rigid matrix (rotation and translation only)
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return mat4 the inverse matrix
+ */
+mat4 mat4_inverseRigid(const mat4* mat);
+
+/**
+ * @brief compute the inverse of a matrix made of a uniform scale, a rotation and a translation
+ * 
+ * @param mat a constant pointer to a matrix to compute the inverse of
+ * @return mat4 the inverse matrix
+ */
+mat4 mat4_inverseUniformScale(const mat4* mat);
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * Multiple matrices are inverted at once if the CPU supports wide registers. The results are bit-identical to mat4_inverse. 
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param n the amount of matrices to invert
+ */
+void mat4_inverseArray(const mat4* in, mat4* out, size_t n);
+
+/**
+ * @brief apply a matrix to an array of 4D vectors
+ * 
+ * The matrix is kept in registers for the whole array and multiple vectors are transformed per iteration. If the output is larger 
+ * than GLGE_MATH_STREAMING_THRESHOLD it is written with non-temporal stores. The results are bit-identical to mat4_apply. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the vectors to transform
+ * @param out a pointer to the array to write the transformed vectors to (may be the same as in)
+ * @param n the amount of vectors to transform
+ */
+void mat4_applyArray(const mat4* mat, const vec4* in, vec4* out, size_t n);
+
+/**
+ * @brief transform an array of 3D points by a matrix
+ * 
+ * The points are extended with a w of 1, so the translation is applied. The w component of the result is discarded, 
+ * no perspective divide is done. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param n the amount of points to transform
+ */
+void mat4_transformPoints(const mat4* mat, const vec3* in, vec3* out, size_t n);
+
+/**
+ * @brief transform an array of 3D directions by a matrix
+ * 
+ * The directions are extended with a w of 0, so the translation is not applied. The w component of the result is discarded. 
+ * 
+ * @param mat a constant pointer to the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param n the amount of directions to transform
+ */
+void mat4_transformDirections(const mat4* mat, const vec3* in, vec3* out, size_t n);
+
+//end a potential C-Section and add the C++ specific functions
 #if __cplusplus
 }
+
+/**
+ * @brief transform an array of 4D vectors by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the vectors to transform
+ * @param out a pointer to the array to write the transformed vectors to (may be the same as in)
+ * @param count the amount of vectors to transform
+ */
+inline void transform(const mat4& mat, const vec4* in, vec4* out, size_t count) noexcept
+{mat4_applyArray(&mat, in, out, count);}
+
+/**
+ * @brief transform an array of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the points to transform
+ * @param out a pointer to the array to write the transformed points to (may be the same as in)
+ * @param count the amount of points to transform
+ */
+inline void transformPoints(const mat4& mat, const vec3* in, vec3* out, size_t count) noexcept
+{mat4_transformPoints(&mat, in, out, count);}
+
+/**
+ * @brief transform an array of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in a constant pointer to the directions to transform
+ * @param out a pointer to the array to write the transformed directions to (may be the same as in)
+ * @param count the amount of directions to transform
+ */
+inline void transformDirections(const mat4& mat, const vec3* in, vec3* out, size_t count) noexcept
+{mat4_transformDirections(&mat, in, out, count);}
+
+/**
+ * @brief compute the inverse of every matrix in an array
+ * 
+ * @param in a constant pointer to the matrices to invert
+ * @param out a pointer to the array to write the inverse matrices to (may be the same as in)
+ * @param count the amount of matrices to invert
+ */
+inline void inverse(const mat4* in, mat4* out, size_t count) noexcept
+{mat4_inverseArray(in, out, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief transform a span of 4D vectors by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the vectors to transform
+ * @param out the span to write the transformed vectors to, only as many elements as both spans hold are transformed
+ */
+inline void transform(const mat4& mat, std::span<const vec4> in, std::span<vec4> out) noexcept
+{mat4_applyArray(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 3D points (w = 1) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the points to transform
+ * @param out the span to write the transformed points to, only as many elements as both spans hold are transformed
+ */
+inline void transformPoints(const mat4& mat, std::span<const vec3> in, std::span<vec3> out) noexcept
+{mat4_transformPoints(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief transform a span of 3D directions (w = 0) by a matrix
+ * 
+ * @param mat the matrix to apply
+ * @param in the directions to transform
+ * @param out the span to write the transformed directions to, only as many elements as both spans hold are transformed
+ */
+inline void transformDirections(const mat4& mat, std::span<const vec3> in, std::span<vec3> out) noexcept
+{mat4_transformDirections(&mat, in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief compute the inverse of every matrix in a span
+ * 
+ * @param in the matrices to invert
+ * @param out the span to write the inverse matrices to, only as many elements as both spans hold are inverted
+ */
+inline void inverse(std::span<const mat4> in, std::span<mat4> out) noexcept
+{mat4_inverseArray(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
+
 #endif
 
 #endif
\ No newline at end of file
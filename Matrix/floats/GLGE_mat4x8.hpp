@@ -0,0 +1,194 @@
+/**
+ * @file GLGE_mat4x8.hpp
+ * @author DM8AT
+ * @brief define a C++ only wide 4x4 float matrix that holds 8 matrices transposed (one wide float per element)
+ * 
+ * The wide matrix is meant for AoSoA (array of structures of arrays) programming together with the wide vectors:
+ * a loop transforms 8 vectors by 8 different matrices per iteration.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_MAT_4x4_X8_
+#define _GLGE_FLOAT_MAT_4x4_X8_
+
+//only available for C++
+#if __cplusplus
+
+//include the 4x4 float matrix
+#include "GLGE_mat4.h"
+//include the wide vectors
+#include "../../Vector/floats/GLGE_vec4x8.hpp"
+
+/**
+ * @brief store 8 4x4 float matrices with one wide float per element
+ */
+typedef struct s_mat4x8 {
+
+    //the matrix is made of 4 rows where each row is a wide 4D vector
+    vec4x8 rows[4];
+
+    /**
+     * @brief Construct a new mat4x8
+     * all lanes are the identity matrix
+     */
+    inline s_mat4x8() noexcept : s_mat4x8(mat4()) {}
+
+    /**
+     * @brief Construct a new mat4x8
+     * 
+     * @param r0 the top rows of the matrices
+     * @param r1 the upper-middle rows of the matrices
+     * @param r2 the lower-middle rows of the matrices
+     * @param r3 the bottom rows of the matrices
+     */
+    inline s_mat4x8(const vec4x8& r0, const vec4x8& r1, const vec4x8& r2, const vec4x8& r3) noexcept
+     : rows{r0,r1,r2,r3}
+    {}
+
+    /**
+     * @brief Construct a new mat4x8
+     * 
+     * @param mat the matrix to store in all lanes
+     */
+    inline s_mat4x8(const mat4& mat) noexcept
+     : rows{mat.rows[0], mat.rows[1], mat.rows[2], mat.rows[3]}
+    {}
+
+    /**
+     * @brief load 8 matrices from an array of 4x4 matrices
+     * 
+     * @param p a pointer to the 8 matrices
+     * @return s_mat4x8 the wide matrix holding the 8 matrices
+     */
+    static inline s_mat4x8 load(const mat4* p) noexcept {
+        s_mat4x8 r;
+        for (int i = 0; i < 8; ++i) {r.set(i, p[i]);}
+        return r;
+    }
+
+    /**
+     * @brief store the 8 matrices to an array of 4x4 matrices
+     * 
+     * @param p a pointer to write the 8 matrices to
+     */
+    inline void store(mat4* p) const noexcept {
+        for (int i = 0; i < 8; ++i) {p[i] = (*this)[i];}
+    }
+
+    /**
+     * @brief get a single matrix
+     * 
+     * @param i the index of the lane
+     * @return mat4 the matrix stored in the lane
+     */
+    inline mat4 operator[](int i) const noexcept
+    {return mat4(rows[0][i], rows[1][i], rows[2][i], rows[3][i]);}
+
+    /**
+     * @brief set a single matrix
+     * 
+     * @param i the index of the lane
+     * @param mat the new matrix for the lane
+     */
+    inline void set(int i, const mat4& mat) noexcept {
+        rows[0].set(i, mat.rows[0]);
+        rows[1].set(i, mat.rows[1]);
+        rows[2].set(i, mat.rows[2]);
+        rows[3].set(i, mat.rows[3]);
+    }
+
+} mat4x8;
+
+/**
+ * @brief transform wide 4D vectors by wide 4x4 matrices
+ * 
+ * @param mat the matrices
+ * @param v the vectors
+ * @return vec4x8 the transformed vectors of all lanes
+ */
+inline vec4x8 operator*(const mat4x8& mat, const vec4x8& v) noexcept
+{return vec4x8(dot(mat.rows[0], v), dot(mat.rows[1], v), dot(mat.rows[2], v), dot(mat.rows[3], v));}
+
+/**
+ * @brief multiply two wide 4x4 matrices
+ * 
+ * @param a the left matrices
+ * @param b the right matrices
+ * @return mat4x8 the products of all lanes
+ */
+inline mat4x8 operator*(const mat4x8& a, const mat4x8& b) noexcept {
+    mat4x8 r;
+    for (int i = 0; i < 4; ++i) {
+        const vec4x8& row = a.rows[i];
+        r.rows[i] = fma(vec4x8(row.w, row.w, row.w, row.w), b.rows[3],
+                    fma(vec4x8(row.z, row.z, row.z, row.z), b.rows[2],
+                    fma(vec4x8(row.y, row.y, row.y, row.y), b.rows[1], row.x * b.rows[0])));
+    }
+    return r;
+}
+
+/**
+ * @brief transpose all lanes of a wide 4x4 matrix
+ * 
+ * @param mat the matrices to transpose
+ * @return mat4x8 the transposed matrices
+ */
+inline mat4x8 transpose(const mat4x8& mat) noexcept {
+    return mat4x8(vec4x8(mat.rows[0].x, mat.rows[1].x, mat.rows[2].x, mat.rows[3].x),
+                  vec4x8(mat.rows[0].y, mat.rows[1].y, mat.rows[2].y, mat.rows[3].y),
+                  vec4x8(mat.rows[0].z, mat.rows[1].z, mat.rows[2].z, mat.rows[3].z),
+                  vec4x8(mat.rows[0].w, mat.rows[1].w, mat.rows[2].w, mat.rows[3].w));
+}
+
+/**
+ * @brief transform wide 3D points by wide 4x4 matrices
+ * 
+ * The w component of the points is 1 and no perspective divide is done
+ * 
+ * @param mat the matrices
+ * @param p the points
+ * @return vec3x8 the transformed points of all lanes
+ */
+inline vec3x8 transformPoint(const mat4x8& mat, const vec3x8& p) noexcept {
+    return vec3x8(fma(mat.rows[0].z, p.z, fma(mat.rows[0].y, p.y, fma(mat.rows[0].x, p.x, mat.rows[0].w))),
+                  fma(mat.rows[1].z, p.z, fma(mat.rows[1].y, p.y, fma(mat.rows[1].x, p.x, mat.rows[1].w))),
+                  fma(mat.rows[2].z, p.z, fma(mat.rows[2].y, p.y, fma(mat.rows[2].x, p.x, mat.rows[2].w))));
+}
+
+/**
+ * @brief transform wide 3D directions by wide 4x4 matrices
+ * 
+ * The w component of the directions is 0, so the translation is ignored
+ * 
+ * @param mat the matrices
+ * @param d the directions
+ * @return vec3x8 the transformed directions of all lanes
+ */
+inline vec3x8 transformDirection(const mat4x8& mat, const vec3x8& d) noexcept {
+    return vec3x8(fma(mat.rows[0].z, d.z, fma(mat.rows[0].y, d.y, mat.rows[0].x * d.x)),
+                  fma(mat.rows[1].z, d.z, fma(mat.rows[1].y, d.y, mat.rows[1].x * d.x)),
+                  fma(mat.rows[2].z, d.z, fma(mat.rows[2].y, d.y, mat.rows[2].x * d.x)));
+}
+
+/**
+ * @brief select the lanes of two wide 4x4 matrices using a mask
+ * 
+ * @param m the mask to select with
+ * @param a the matrices to use where the mask is set
+ * @param b the matrices to use where the mask is not set
+ * @return mat4x8 the selected matrices
+ */
+inline mat4x8 select(const mask8& m, const mat4x8& a, const mat4x8& b) noexcept {
+    return mat4x8(select(m, a.rows[0], b.rows[0]), select(m, a.rows[1], b.rows[1]),
+                  select(m, a.rows[2], b.rows[2]), select(m, a.rows[3], b.rows[3]));
+}
+
+#endif
+
+#endif
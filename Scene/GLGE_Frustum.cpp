@@ -0,0 +1,58 @@
+/**
+ * @file GLGE_Frustum.cpp
+ * @author DM8AT
+ * @brief implement the plane extraction and the culling of the frustums
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the frustums
+#include "GLGE_Frustum.h"
+//include the batch kernels
+#include "../Kernels/GLGE_KernelTable.hpp"
+//include the square root
+#include <math.h>
+
+/**
+ * @brief normalize a plane so its normal has a length of 1
+ * 
+ * @param p the plane to normalize
+ * @return vec4 the normalized plane
+ */
+static vec4 normalizePlane(const vec4& p) noexcept {
+    float inv = 1.f / sqrtf((p.x * p.x + p.y * p.y) + p.z * p.z);
+    return vec4(p.x * inv, p.y * inv, p.z * inv, p.w * inv);
+}
+
+s_Frustum::s_Frustum(const mat4& viewProj, bool zeroToOneDepth) noexcept {
+    //a point is inside if -w <= x <= w (same for y and z), so every plane is the last row plus or minus another row
+    const vec4* r = viewProj.rows;
+    planes[0] = normalizePlane(vec4(r[3].x + r[0].x, r[3].y + r[0].y, r[3].z + r[0].z, r[3].w + r[0].w));
+    planes[1] = normalizePlane(vec4(r[3].x - r[0].x, r[3].y - r[0].y, r[3].z - r[0].z, r[3].w - r[0].w));
+    planes[2] = normalizePlane(vec4(r[3].x + r[1].x, r[3].y + r[1].y, r[3].z + r[1].z, r[3].w + r[1].w));
+    planes[3] = normalizePlane(vec4(r[3].x - r[1].x, r[3].y - r[1].y, r[3].z - r[1].z, r[3].w - r[1].w));
+    //for a depth between 0 and w the near plane is only 0 <= z
+    planes[4] = normalizePlane(zeroToOneDepth ? r[2] : vec4(r[3].x + r[2].x, r[3].y + r[2].y, r[3].z + r[2].z, r[3].w + r[2].w));
+    planes[5] = normalizePlane(vec4(r[3].x - r[2].x, r[3].y - r[2].y, r[3].z - r[2].z, r[3].w - r[2].w));
+}
+
+Frustum frustum_fromMat4(const mat4* viewProj, bool zeroToOneDepth) {return Frustum(*viewProj, zeroToOneDepth);}
+
+bool frustum_testSphere(const Frustum* f, const vec4* sphere) {return f->testSphere(*sphere);}
+
+bool frustum_testAABB(const Frustum* f, const vec3* min, const vec3* max) {return f->testAABB(*min, *max);}
+
+size_t frustum_cullSpheres(const Frustum* f, const vec4* spheres, size_t n, uint32_t* visible)
+{return glge::kernel::table().cullSpheres((const float*)f->planes, (const float*)spheres, n, visible, true);}
+
+size_t frustum_cullSpheresMask(const Frustum* f, const vec4* spheres, size_t n, uint32_t* mask)
+{return glge::kernel::table().cullSpheres((const float*)f->planes, (const float*)spheres, n, mask, false);}
+
+size_t frustum_cullAABBs(const Frustum* f, const vec3* mins, const vec3* maxs, size_t n, uint32_t* visible)
+{return glge::kernel::table().cullAABBs((const float*)f->planes, (const float*)mins, (const float*)maxs, n, visible, true);}
+
+size_t frustum_cullAABBsMask(const Frustum* f, const vec3* mins, const vec3* maxs, size_t n, uint32_t* mask)
+{return glge::kernel::table().cullAABBs((const float*)f->planes, (const float*)mins, (const float*)maxs, n, mask, false);}
\ No newline at end of file
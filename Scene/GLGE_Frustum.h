@@ -0,0 +1,247 @@
+/**
+ * @file GLGE_Frustum.h
+ * @author DM8AT
+ * @brief define a view frustum that is used to find the bounding volumes a camera can see
+ * 
+ * The 6 planes of the frustum are extracted from a view-projection matrix by adding and subtracting its rows
+ * (Gribb-Hartmann). A volume is culled if it is completely behind one of the planes, volumes that intersect the corners
+ * of the frustum may be reported as visible even if they are outside. The batch functions test multiple spheres or
+ * boxes at once if the CPU supports wide registers and write the indices of the visible volumes or one bit per volume.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FRUSTUM_
+#define _GLGE_FRUSTUM_
+
+//include the vectors for the planes and the bounding volumes
+#include "../Vector/floats/GLGE_vec3.h"
+#include "../Vector/floats/GLGE_vec4.h"
+//include the 4x4 matrices for the view-projection matrix
+#include "../Matrix/floats/GLGE_mat4.h"
+//include the fixed size integers for the indices and the bitmasks
+#include <stdint.h>
+//include the size type
+#include <stddef.h>
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store the 6 planes of a view frustum
+ * 
+ * Every plane stores its normal in x, y and z and its distance in w. The normals point into the frustum and are
+ * normalized, so dot(normal, p) + w is the signed distance of the point p to the plane.
+ * The planes are stored in the order left, right, bottom, top, near, far.
+ */
+typedef struct s_Frustum {
+
+    //the planes of the frustum
+    vec4 planes[6];
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Frustum
+     * 
+     * All planes are 0, so every volume is visible
+     */
+    inline constexpr s_Frustum() noexcept
+     : planes{}
+    {}
+
+    /**
+     * @brief Construct a new Frustum from a view-projection matrix
+     * 
+     * @param viewProj the matrix that transforms world space to clip space
+     * @param zeroToOneDepth true : the depth in clip space is between 0 and w (Direct3D, Vulkan) | false : the depth is between -w and w (OpenGL)
+     */
+    s_Frustum(const mat4& viewProj, bool zeroToOneDepth = false) noexcept;
+
+    /**
+     * @brief check if a sphere is at least partially inside of the frustum
+     * 
+     * @param sphere the center of the sphere in x, y and z and the radius in w
+     * @return true : the sphere may be visible
+     * @return false : the sphere is completely outside of the frustum
+     */
+    inline bool testSphere(const vec4& sphere) const noexcept {
+        for (size_t i = 0; i < 6; ++i) {
+            const vec4& p = planes[i];
+            if (((sphere.x * p.x + sphere.y * p.y) + sphere.z * p.z) + p.w < -sphere.w) {return false;}
+        }
+        return true;
+    }
+
+    /**
+     * @brief check if an axis aligned box is at least partially inside of the frustum
+     * 
+     * Only the corner that is furthest along the normal of a plane is tested against the plane
+     * 
+     * @param min the minimal corner of the box
+     * @param max the maximal corner of the box
+     * @return true : the box may be visible
+     * @return false : the box is completely outside of the frustum
+     */
+    inline bool testAABB(const vec3& min, const vec3& max) const noexcept {
+        for (size_t i = 0; i < 6; ++i) {
+            const vec4& p = planes[i];
+            float x = (p.x >= 0.f) ? max.x : min.x;
+            float y = (p.y >= 0.f) ? max.y : min.y;
+            float z = (p.z >= 0.f) ? max.z : min.z;
+            if (((x * p.x + y * p.y) + z * p.z) + p.w < 0.f) {return false;}
+        }
+        return true;
+    }
+
+    #endif
+
+} Frustum;
+
+/**
+ * @brief extract the frustum of a view-projection matrix
+ * 
+ * @param viewProj a pointer to the matrix that transforms world space to clip space
+ * @param zeroToOneDepth true : the depth in clip space is between 0 and w (Direct3D, Vulkan) | false : the depth is between -w and w (OpenGL)
+ * @return Frustum the frustum with normalized planes
+ */
+Frustum frustum_fromMat4(const mat4* viewProj, bool zeroToOneDepth);
+
+/**
+ * @brief check if a sphere is at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param sphere a pointer to the center of the sphere in x, y and z and the radius in w
+ * @return true : the sphere may be visible
+ * @return false : the sphere is completely outside of the frustum
+ */
+bool frustum_testSphere(const Frustum* f, const vec4* sphere);
+
+/**
+ * @brief check if an axis aligned box is at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param min a pointer to the minimal corner of the box
+ * @param max a pointer to the maximal corner of the box
+ * @return true : the box may be visible
+ * @return false : the box is completely outside of the frustum
+ */
+bool frustum_testAABB(const Frustum* f, const vec3* min, const vec3* max);
+
+/**
+ * @brief find all spheres of an array that are at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param spheres a pointer to the spheres, the center in x, y and z and the radius in w
+ * @param n the amount of spheres
+ * @param visible a pointer to write the indices of the visible spheres to in ascending order, it must have room for n indices
+ * @return size_t the amount of visible spheres
+ */
+size_t frustum_cullSpheres(const Frustum* f, const vec4* spheres, size_t n, uint32_t* visible);
+
+/**
+ * @brief mark all spheres of an array that are at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param spheres a pointer to the spheres, the center in x, y and z and the radius in w
+ * @param n the amount of spheres
+ * @param mask a pointer to (n + 31) / 32 words, bit i % 32 of word i / 32 is set if sphere i is visible. Unused bits are cleared
+ * @return size_t the amount of visible spheres
+ */
+size_t frustum_cullSpheresMask(const Frustum* f, const vec4* spheres, size_t n, uint32_t* mask);
+
+/**
+ * @brief find all axis aligned boxes of an array that are at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param mins a pointer to the minimal corner of every box
+ * @param maxs a pointer to the maximal corner of every box
+ * @param n the amount of boxes
+ * @param visible a pointer to write the indices of the visible boxes to in ascending order, it must have room for n indices
+ * @return size_t the amount of visible boxes
+ */
+size_t frustum_cullAABBs(const Frustum* f, const vec3* mins, const vec3* maxs, size_t n, uint32_t* visible);
+
+/**
+ * @brief mark all axis aligned boxes of an array that are at least partially inside of a frustum
+ * 
+ * @param f a pointer to the frustum
+ * @param mins a pointer to the minimal corner of every box
+ * @param maxs a pointer to the maximal corner of every box
+ * @param n the amount of boxes
+ * @param mask a pointer to (n + 31) / 32 words, bit i % 32 of word i / 32 is set if box i is visible. Unused bits are cleared
+ * @return size_t the amount of visible boxes
+ */
+size_t frustum_cullAABBsMask(const Frustum* f, const vec3* mins, const vec3* maxs, size_t n, uint32_t* mask);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief find all spheres of an array that are at least partially inside of a frustum
+ * 
+ * @param f the frustum
+ * @param spheres a pointer to the spheres, the center in x, y and z and the radius in w
+ * @param count the amount of spheres
+ * @param visible a pointer to write the indices of the visible spheres to, it must have room for count indices
+ * @return size_t the amount of visible spheres
+ */
+inline size_t cullSpheres(const Frustum& f, const vec4* spheres, size_t count, uint32_t* visible) noexcept
+{return frustum_cullSpheres(&f, spheres, count, visible);}
+
+/**
+ * @brief find all axis aligned boxes of an array that are at least partially inside of a frustum
+ * 
+ * @param f the frustum
+ * @param mins a pointer to the minimal corner of every box
+ * @param maxs a pointer to the maximal corner of every box
+ * @param count the amount of boxes
+ * @param visible a pointer to write the indices of the visible boxes to, it must have room for count indices
+ * @return size_t the amount of visible boxes
+ */
+inline size_t cullAABBs(const Frustum& f, const vec3* mins, const vec3* maxs, size_t count, uint32_t* visible) noexcept
+{return frustum_cullAABBs(&f, mins, maxs, count, visible);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief find all spheres of a span that are at least partially inside of a frustum
+ * 
+ * @param f the frustum
+ * @param spheres the spheres, the center in x, y and z and the radius in w
+ * @param visible the span to write the indices of the visible spheres to, it must be at least as large as spheres
+ * @return size_t the amount of visible spheres
+ */
+inline size_t cullSpheres(const Frustum& f, std::span<const vec4> spheres, std::span<uint32_t> visible) noexcept
+{return frustum_cullSpheres(&f, spheres.data(), spheres.size(), visible.data());}
+
+/**
+ * @brief find all axis aligned boxes of two spans that are at least partially inside of a frustum
+ * 
+ * @param f the frustum
+ * @param mins the minimal corner of every box
+ * @param maxs the maximal corner of every box, it must be at least as large as mins
+ * @param visible the span to write the indices of the visible boxes to, it must be at least as large as mins
+ * @return size_t the amount of visible boxes
+ */
+inline size_t cullAABBs(const Frustum& f, std::span<const vec3> mins, std::span<const vec3> maxs, std::span<uint32_t> visible) noexcept
+{return frustum_cullAABBs(&f, mins.data(), maxs.data(), mins.size(), visible.data());}
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,176 @@
+/**
+ * @file GLGE_Hierarchy.cpp
+ * @author DM8AT
+ * @brief implement the propagation of the world matrices of a hierarchy
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the hierarchy
+#include "GLGE_Hierarchy.h"
+//include the batch kernels
+#include "../Kernels/GLGE_KernelTable.hpp"
+//include the threading of the batch functions
+#include "../Kernels/GLGE_Parallel.hpp"
+//include memset
+#include <string.h>
+//include vectors for the temporary arrays of the build
+#include <vector>
+
+//the amount of nodes per chunk. Large enough that the threads don't fight over the chunk counter, small enough that 
+//the levels near the roots are still split between multiple threads
+#define GLGE_HIERARCHY_CHUNK 1024
+
+s_Hierarchy::~s_Hierarchy() noexcept
+{hierarchy_free(this);}
+
+bool s_Hierarchy::build(const uint32_t* _parents, const mat3x4* _locals, size_t count, uint32_t* order) noexcept
+{return hierarchy_build(this, _parents, _locals, count, order);}
+
+void s_Hierarchy::setLocal(uint32_t node, const mat3x4& local) noexcept
+{hierarchy_setLocal(this, node, &local);}
+
+void s_Hierarchy::propagate(uint32_t threads) noexcept
+{hierarchy_propagate(this, threads);}
+
+bool hierarchy_build(Hierarchy* h, const uint32_t* parents, const mat3x4* locals, size_t n, uint32_t* order) {
+    hierarchy_free(h);
+    //the indices must fit into the parent indices without hitting the root marker
+    if (n >= GLGE_HIERARCHY_ROOT) {return false;}
+    for (size_t i = 0; i < n; ++i) 
+    {if ((parents[i] != GLGE_HIERARCHY_ROOT) && (parents[i] >= n)) {return false;}}
+
+    //the sorted order of the input nodes and the first node of every level
+    std::vector<uint32_t> sorted;
+    std::vector<size_t> levels;
+    std::vector<uint32_t> newIndex;
+    try {
+        //list the children of every node next to each other (counting sort by parent)
+        std::vector<size_t> firstChild(n + 1, 0);
+        for (size_t i = 0; i < n; ++i) 
+        {if (parents[i] != GLGE_HIERARCHY_ROOT) {++firstChild[parents[i] + 1];}}
+        for (size_t i = 0; i < n; ++i) 
+        {firstChild[i + 1] += firstChild[i];}
+        std::vector<uint32_t> children(firstChild[n]);
+        std::vector<size_t> fill(firstChild.begin(), firstChild.end() - 1);
+        for (size_t i = 0; i < n; ++i) 
+        {if (parents[i] != GLGE_HIERARCHY_ROOT) {children[fill[parents[i]]++] = (uint32_t)i;}}
+
+        //breadth first from the roots, every level appends the children of the previous level
+        sorted.reserve(n);
+        for (size_t i = 0; i < n; ++i) 
+        {if (parents[i] == GLGE_HIERARCHY_ROOT) {sorted.push_back((uint32_t)i);}}
+        levels.push_back(0);
+        while (levels.back() < sorted.size()) {
+            size_t begin = levels.back();
+            size_t end = sorted.size();
+            levels.push_back(end);
+            for (size_t i = begin; i < end; ++i) {
+                for (size_t c = firstChild[sorted[i]]; c < firstChild[sorted[i] + 1]; ++c) 
+                {sorted.push_back(children[c]);}
+            }
+        }
+        newIndex.resize(n);
+    } catch (...) {
+        return false;
+    }
+    //nodes that are not reachable from a root are part of a cycle
+    if (sorted.size() != n) {return false;}
+
+    //allocate the arrays
+    h->parents = (uint32_t*)glge_alignedAlloc((n ? n : 1) * sizeof(uint32_t), GLGE_MATH_SOA_ALIGNMENT);
+    h->locals = (mat3x4*)glge_alignedAlloc((n ? n : 1) * sizeof(mat3x4), GLGE_MATH_SOA_ALIGNMENT);
+    h->worlds = (mat3x4*)glge_alignedAlloc((n ? n : 1) * sizeof(mat3x4), GLGE_MATH_SOA_ALIGNMENT);
+    h->dirty = (uint8_t*)glge_alignedAlloc((n ? n : 1), GLGE_MATH_SOA_ALIGNMENT);
+    h->levels = (size_t*)glge_alignedAlloc(levels.size() * sizeof(size_t), GLGE_MATH_SOA_ALIGNMENT);
+    if (!h->parents || !h->locals || !h->worlds || !h->dirty || !h->levels) {
+        hierarchy_free(h);
+        return false;
+    }
+
+    //move the nodes to their sorted positions
+    for (size_t i = 0; i < n; ++i) 
+    {newIndex[sorted[i]] = (uint32_t)i;}
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t p = parents[sorted[i]];
+        h->parents[i] = (p == GLGE_HIERARCHY_ROOT) ? GLGE_HIERARCHY_ROOT : newIndex[p];
+        h->locals[i] = locals[sorted[i]];
+    }
+    if (order) {memcpy(order, newIndex.data(), n * sizeof(uint32_t));}
+    memcpy(h->levels, levels.data(), levels.size() * sizeof(size_t));
+    //the last entry is only the end of the last level
+    h->levelCount = levels.size() - 1;
+    h->size = n;
+    //all world matrices must be computed by the first propagation
+    memset(h->dirty, 1, n);
+    h->firstDirty = 0;
+    return true;
+}
+
+void hierarchy_free(Hierarchy* h) {
+    glge_alignedFree(h->parents);
+    glge_alignedFree(h->locals);
+    glge_alignedFree(h->worlds);
+    glge_alignedFree(h->dirty);
+    glge_alignedFree(h->levels);
+    h->parents = NULL;
+    h->locals = NULL;
+    h->worlds = NULL;
+    h->dirty = NULL;
+    h->levels = NULL;
+    h->size = 0;
+    h->levelCount = 0;
+    h->firstDirty = 0;
+}
+
+void hierarchy_setLocal(Hierarchy* h, uint32_t node, const mat3x4* local) {
+    h->locals[node] = *local;
+    hierarchy_markDirty(h, node);
+}
+
+void hierarchy_markDirty(Hierarchy* h, uint32_t node) {
+    h->dirty[node] = 1;
+    //binary search for the level of the node, it is the last level that starts at or before the node
+    size_t lo = 0, hi = h->levelCount;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (h->levels[mid] <= node) {lo = mid;}
+        else {hi = mid;}
+    }
+    if (lo < h->firstDirty) {h->firstDirty = lo;}
+}
+
+void hierarchy_propagate(Hierarchy* h, uint32_t threads) {
+    if (h->firstDirty >= h->levelCount) {return;}
+    const glge::kernel::KernelTable& table = glge::kernel::table();
+    size_t first = h->firstDirty;
+    glge::parallel::forRanges(h->levelCount - first, h->levels + first, GLGE_HIERARCHY_CHUNK, threads, [&](size_t begin, size_t end) {
+        //the first level only holds the roots, their world matrix is the local matrix
+        if (h->parents[begin] == GLGE_HIERARCHY_ROOT) {
+            for (size_t i = begin; i < end; ++i) 
+            {if (h->dirty[i]) {h->worlds[i] = h->locals[i];}}
+            return;
+        }
+        //a node changes if its local matrix or its parent changed. The parents are in a finished level, so the flags 
+        //are passed down to the next level
+        for (size_t i = begin; i < end; ++i) 
+        {h->dirty[i] |= h->dirty[h->parents[i]];}
+        //multiply the runs of changed nodes with the world matrices of their parents
+        size_t i = begin;
+        while (i < end) {
+            while ((i < end) && !h->dirty[i]) {++i;}
+            size_t run = i;
+            while ((i < end) && h->dirty[i]) {++i;}
+            if (i > run) 
+            {table.affineMultiplyIndexed((const float*)h->worlds, h->parents + run, (const float*)(h->locals + run), (float*)(h->worlds + run), i - run);}
+        }
+    });
+    //all world matrices are up to date
+    memset(h->dirty + h->levels[first], 0, h->size - h->levels[first]);
+    h->firstDirty = h->levelCount;
+}
+
+mat3x4 hierarchy_getWorld(const Hierarchy* h, uint32_t node) {return h->worlds[node];}
\ No newline at end of file
@@ -0,0 +1,193 @@
+/**
+ * @file GLGE_Hierarchy.h
+ * @author DM8AT
+ * @brief define a hierarchy of nodes that computes the world matrices of all nodes from their local matrices
+ * 
+ * The world matrix of a node is the world matrix of its parent times its local matrix. The nodes are stored in flat
+ * arrays sorted by their depth (breadth first), so all parents of a level are finished before the level is processed.
+ * The levels are split into chunks that are processed by multiple threads and every chunk computes multiple world
+ * matrices at once if the CPU supports wide registers. Only the nodes that changed and the nodes below them are updated.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_HIERARCHY_
+#define _GLGE_HIERARCHY_
+
+//include the affine matrices for the local and the world matrices
+#include "../Matrix/floats/GLGE_mat3x4.h"
+//include the fixed size integers for the node indices
+#include <stdint.h>
+//include the size type
+#include <stddef.h>
+
+//the parent index of the nodes that have no parent
+#define GLGE_HIERARCHY_ROOT 0xFFFFFFFFu
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store a hierarchy of nodes sorted by their depth
+ * 
+ * The root nodes are the first level, then all children of the roots follow and so on. The children of a node are
+ * stored next to each other, so the parents of a level are read in order.
+ * In C the hierarchy must be zero-initialized before it is used and freed using hierarchy_free.
+ */
+typedef struct s_Hierarchy {
+
+    //the index of the parent of every node, GLGE_HIERARCHY_ROOT for the roots. A parent is always stored before its children
+    uint32_t* parents;
+    //the local matrix of every node, relative to its parent
+    mat3x4* locals;
+    //the world matrix of every node, only valid after hierarchy_propagate
+    mat3x4* worlds;
+    //1 for every node whose local matrix changed since the last propagation, else 0
+    uint8_t* dirty;
+    //the first node of every level followed by the amount of nodes (levelCount + 1 entries)
+    size_t* levels;
+    //the amount of nodes
+    size_t size;
+    //the amount of levels
+    size_t levelCount;
+    //the first level that contains a changed node, levelCount if no node changed
+    size_t firstDirty;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new empty hierarchy
+     */
+    inline constexpr s_Hierarchy() noexcept
+     : parents(NULL), locals(NULL), worlds(NULL), dirty(NULL), levels(NULL), size(0), levelCount(0), firstDirty(0)
+    {}
+
+    /**
+     * @brief Destroy the hierarchy
+     */
+    ~s_Hierarchy() noexcept;
+
+    //the hierarchy owns its arrays, so it can't be copied
+    s_Hierarchy(const s_Hierarchy&) = delete;
+    s_Hierarchy& operator=(const s_Hierarchy&) = delete;
+
+    /**
+     * @brief replace the nodes of the hierarchy
+     * 
+     * @param _parents a pointer to the parent of every node (GLGE_HIERARCHY_ROOT for the roots), the nodes may be in any order
+     * @param _locals a pointer to the local matrix of every node
+     * @param count the amount of nodes
+     * @param order a pointer to write the index of every node in the hierarchy to (count entries) or NULL
+     * @return true : the hierarchy was built
+     * @return false : a parent index is invalid, the parents form a cycle or the memory could not be allocated. The hierarchy is empty
+     */
+    bool build(const uint32_t* _parents, const mat3x4* _locals, size_t count, uint32_t* order = NULL) noexcept;
+
+    /**
+     * @brief change the local matrix of a node, it and all nodes below it are updated by the next propagation
+     * 
+     * @param node the index of the node in the hierarchy
+     * @param local the new local matrix
+     */
+    void setLocal(uint32_t node, const mat3x4& local) noexcept;
+
+    /**
+     * @brief compute the world matrices of all nodes that changed and of all nodes below them
+     * 
+     * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+     */
+    void propagate(uint32_t threads = 0) noexcept;
+
+    /**
+     * @brief get the world matrix of a node
+     * 
+     * @param node the index of the node in the hierarchy
+     * @return const mat3x4& the world matrix computed by the last propagation
+     */
+    inline const mat3x4& getWorld(uint32_t node) const noexcept {return worlds[node];}
+
+    /**
+     * @brief get the local matrix of a node
+     * 
+     * @param node the index of the node in the hierarchy
+     * @return const mat3x4& the local matrix
+     */
+    inline const mat3x4& getLocal(uint32_t node) const noexcept {return locals[node];}
+
+    #endif
+
+} Hierarchy;
+
+/**
+ * @brief replace the nodes of a hierarchy
+ * 
+ * The nodes are sorted breadth first, all nodes start as changed so the first propagation computes all world matrices
+ * 
+ * @param h a pointer to the hierarchy to fill
+ * @param parents a pointer to the parent of every node (GLGE_HIERARCHY_ROOT for the roots), the nodes may be in any order
+ * @param locals a pointer to the local matrix of every node
+ * @param n the amount of nodes
+ * @param order a pointer to write the index of every node in the hierarchy to (n entries) or NULL
+ * @return true : the hierarchy was built
+ * @return false : a parent index is invalid, the parents form a cycle or the memory could not be allocated. The hierarchy is empty
+ */
+bool hierarchy_build(Hierarchy* h, const uint32_t* parents, const mat3x4* locals, size_t n, uint32_t* order);
+
+/**
+ * @brief free the memory of a hierarchy, it is empty afterwards
+ * 
+ * @param h a pointer to the hierarchy to free
+ */
+void hierarchy_free(Hierarchy* h);
+
+/**
+ * @brief change the local matrix of a node
+ * 
+ * @param h a pointer to the hierarchy
+ * @param node the index of the node in the hierarchy
+ * @param local a pointer to the new local matrix
+ */
+void hierarchy_setLocal(Hierarchy* h, uint32_t node, const mat3x4* local);
+
+/**
+ * @brief mark the local matrix of a node as changed after it was written directly
+ * 
+ * @param h a pointer to the hierarchy
+ * @param node the index of the node in the hierarchy
+ */
+void hierarchy_markDirty(Hierarchy* h, uint32_t node);
+
+/**
+ * @brief compute the world matrices of all nodes that changed and of all nodes below them
+ * 
+ * The levels from the first changed level on are processed in order. Inside a level the runs of changed nodes are
+ * multiplied with the world matrices of their parents using the batched affine product.
+ * 
+ * @param h a pointer to the hierarchy
+ * @param threads the amount of threads to use, 0 to use one thread per hardware thread
+ */
+void hierarchy_propagate(Hierarchy* h, uint32_t threads);
+
+/**
+ * @brief get the world matrix of a node
+ * 
+ * @param h a pointer to the hierarchy
+ * @param node the index of the node in the hierarchy
+ * @return mat3x4 the world matrix computed by the last propagation
+ */
+mat3x4 hierarchy_getWorld(const Hierarchy* h, uint32_t node);
+
+//end a potential C-Section
+#if __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,37 @@
+/**
+ * @file GLGE_Transform.cpp
+ * @author DM8AT
+ * @brief implement the C function binding for the transforms
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the transforms
+#include "GLGE_Transform.h"
+
+Transform transform_create(const vec3* position, const Quaternion* rotation, const vec3* scale) {return Transform(*position, *rotation, *scale);}
+
+void transform_setPosition(Transform* t, const vec3* position) {t->setPosition(*position);}
+
+void transform_setRotation(Transform* t, const Quaternion* rotation) {t->setRotation(*rotation);}
+
+void transform_setScale(Transform* t, const vec3* scale) {t->setScale(*scale);}
+
+void transform_update(Transform* t) {t->update();}
+
+mat3x4 transform_getMatrix(Transform* t) {return t->getMatrix();}
+
+mat3x4 transform_getInverse(Transform* t) {return t->getInverse();}
+
+mat4 transform_getMat4(Transform* t) {return t->getMat4();}
+
+mat4 transform_getInverseMat4(Transform* t) {return t->getInverseMat4();}
+
+void transform_flushArray(Transform* t, size_t n) {
+    //most transforms don't change every frame, so only the flag is read for them
+    for (size_t i = 0; i < n; ++i) 
+    {if (t[i].dirty) {t[i].update();}}
+}
\ No newline at end of file
@@ -0,0 +1,317 @@
+/**
+ * @file GLGE_Transform.h
+ * @author DM8AT
+ * @brief define a transformation made of a translation, a rotation and a scale (TRS)
+ * 
+ * A transform builds its affine matrix and the inverse of that matrix only when they are requested after a part of the
+ * transform changed. The matrices are cached in the transform, so reading them multiple times per frame is free. The
+ * inverse is built directly from the parts of the transform, which is a lot cheaper than inverting the matrix.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_TRANSFORM_
+#define _GLGE_TRANSFORM_
+
+//include the vectors for the translation and the scale
+#include "../Vector/floats/GLGE_vec3.h"
+//include quaternions for the rotation
+#include "../Imaginary/Quaternions/Quaternion.h"
+//include the affine matrices for the cached matrices
+#include "../Matrix/floats/GLGE_mat3x4.h"
+//include the 4x4 matrices for the conversions
+#include "../Matrix/floats/GLGE_mat4.h"
+
+//make all functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store a transformation that scales first, then rotates and translates last
+ * 
+ * The parts should be changed using the setters. If they are written directly, dirty must be set to true, else the
+ * cached matrices are not rebuilt.
+ */
+typedef struct s_Transform {
+
+    //the translation, it is applied last
+    vec3 position;
+    //the normalized rotation, it is applied after the scale
+    Quaternion rotation;
+    //the scale along the local axes, it is applied first. No axis may be scaled by 0, else there is no inverse
+    vec3 scale;
+    //the cached matrix of the transformation, only valid if dirty is false
+    mat3x4 matrix;
+    //the cached inverse of the matrix, only valid if dirty is false
+    mat3x4 inverse;
+    //true : the cached matrices are outdated | false : the cached matrices match the parts of the transform
+    bool dirty;
+
+    //check for C++ to implement the C++ interface
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new Transform
+     * 
+     * Initializes the transform to the identity transformation
+     */
+    s_Transform() noexcept
+     : position(0.f), rotation(), scale(1.f), matrix(), inverse(), dirty(false)
+    {}
+
+    /**
+     * @brief Construct a new Transform
+     * 
+     * @param _position the translation of the transform
+     * @param _rotation the normalized rotation of the transform
+     * @param _scale the scale of the transform
+     */
+    s_Transform(const vec3& _position, const Quaternion& _rotation, const vec3& _scale = vec3(1.f)) noexcept
+     : position(_position), rotation(_rotation), scale(_scale), matrix(), inverse(), dirty(true)
+    {}
+
+    /**
+     * @brief change the translation of the transform
+     * 
+     * @param _position the new translation
+     */
+    inline void setPosition(const vec3& _position) noexcept {position = _position; dirty = true;}
+
+    /**
+     * @brief change the rotation of the transform
+     * 
+     * @param _rotation the new normalized rotation
+     */
+    inline void setRotation(const Quaternion& _rotation) noexcept {rotation = _rotation; dirty = true;}
+
+    /**
+     * @brief change the scale of the transform
+     * 
+     * @param _scale the new scale
+     */
+    inline void setScale(const vec3& _scale) noexcept {scale = _scale; dirty = true;}
+
+    /**
+     * @brief move the transform
+     * 
+     * @param offset the offset to add to the translation
+     */
+    inline void translate(const vec3& offset) noexcept {position = position + offset; dirty = true;}
+
+    /**
+     * @brief rotate the transform, the new rotation is applied after the current rotation
+     * 
+     * @param delta the normalized rotation to add
+     */
+    inline void rotate(const Quaternion& delta) noexcept {rotation = delta * rotation; dirty = true;}
+
+    /**
+     * @brief get the translation of the transform
+     * 
+     * @return const vec3& the translation
+     */
+    inline const vec3& getPosition() const noexcept {return position;}
+
+    /**
+     * @brief get the rotation of the transform
+     * 
+     * @return const Quaternion& the rotation
+     */
+    inline const Quaternion& getRotation() const noexcept {return rotation;}
+
+    /**
+     * @brief get the scale of the transform
+     * 
+     * @return const vec3& the scale
+     */
+    inline const vec3& getScale() const noexcept {return scale;}
+
+    /**
+     * @brief check if the cached matrices must be rebuilt
+     * 
+     * @return true : the cached matrices are outdated
+     * @return false : the cached matrices are up to date
+     */
+    inline bool isDirty() const noexcept {return dirty;}
+
+    /**
+     * @brief rebuild the cached matrices if a part of the transform changed
+     * 
+     * The columns of the rotation matrix are scaled by the scale and the translation is the last column. The inverse
+     * is the transposed rotation with the rows divided by the scale, the translation is transformed by it and negated.
+     */
+    inline void update() noexcept {
+        if (!dirty) {return;}
+        mat3 r = rotation.toMat3();
+        matrix = mat3x4(
+            r.rows[0].x * scale.x, r.rows[0].y * scale.y, r.rows[0].z * scale.z, position.x,
+            r.rows[1].x * scale.x, r.rows[1].y * scale.y, r.rows[1].z * scale.z, position.y,
+            r.rows[2].x * scale.x, r.rows[2].y * scale.y, r.rows[2].z * scale.z, position.z
+        );
+        //the rows of the inverse are the columns of the rotation divided by the scale
+        vec3 s(1.f / scale.x, 1.f / scale.y, 1.f / scale.z);
+        vec3 x(r.rows[0].x * s.x, r.rows[1].x * s.x, r.rows[2].x * s.x);
+        vec3 y(r.rows[0].y * s.y, r.rows[1].y * s.y, r.rows[2].y * s.y);
+        vec3 z(r.rows[0].z * s.z, r.rows[1].z * s.z, r.rows[2].z * s.z);
+        inverse = mat3x4(
+            x.x, x.y, x.z, -((x.x * position.x + x.y * position.y) + x.z * position.z),
+            y.x, y.y, y.z, -((y.x * position.x + y.y * position.y) + y.z * position.z),
+            z.x, z.y, z.z, -((z.x * position.x + z.y * position.y) + z.z * position.z)
+        );
+        dirty = false;
+    }
+
+    /**
+     * @brief get the matrix of the transformation, it is rebuilt if the transform changed
+     * 
+     * @return const mat3x4& the cached matrix
+     */
+    inline const mat3x4& getMatrix() noexcept {update(); return matrix;}
+
+    /**
+     * @brief get the inverse matrix of the transformation, it is rebuilt if the transform changed
+     * 
+     * @return const mat3x4& the cached inverse matrix
+     */
+    inline const mat3x4& getInverse() noexcept {update(); return inverse;}
+
+    /**
+     * @brief get the matrix of the transformation as a 4x4 matrix
+     * 
+     * @return mat4 the matrix with the bottom row (0, 0, 0, 1)
+     */
+    inline mat4 getMat4() noexcept {return getMatrix().toMat4();}
+
+    /**
+     * @brief get the inverse matrix of the transformation as a 4x4 matrix
+     * 
+     * @return mat4 the inverse matrix with the bottom row (0, 0, 0, 1)
+     */
+    inline mat4 getInverseMat4() noexcept {return getInverse().toMat4();}
+
+    #endif
+
+} Transform;
+
+/**
+ * @brief create a new transform
+ * 
+ * @param position a pointer to the translation
+ * @param rotation a pointer to the normalized rotation
+ * @param scale a pointer to the scale
+ * @return Transform the new transform, its matrices are built when they are requested
+ */
+Transform transform_create(const vec3* position, const Quaternion* rotation, const vec3* scale);
+
+/**
+ * @brief change the translation of a transform
+ * 
+ * @param t a pointer to the transform to change
+ * @param position a pointer to the new translation
+ */
+void transform_setPosition(Transform* t, const vec3* position);
+
+/**
+ * @brief change the rotation of a transform
+ * 
+ * @param t a pointer to the transform to change
+ * @param rotation a pointer to the new normalized rotation
+ */
+void transform_setRotation(Transform* t, const Quaternion* rotation);
+
+/**
+ * @brief change the scale of a transform
+ * 
+ * @param t a pointer to the transform to change
+ * @param scale a pointer to the new scale
+ */
+void transform_setScale(Transform* t, const vec3* scale);
+
+/**
+ * @brief rebuild the cached matrices of a transform if it changed
+ * 
+ * @param t a pointer to the transform to update
+ */
+void transform_update(Transform* t);
+
+/**
+ * @brief get the matrix of a transform, it is rebuilt if the transform changed
+ * 
+ * @param t a pointer to the transform
+ * @return mat3x4 the matrix of the transformation
+ */
+mat3x4 transform_getMatrix(Transform* t);
+
+/**
+ * @brief get the inverse matrix of a transform, it is rebuilt if the transform changed
+ * 
+ * @param t a pointer to the transform
+ * @return mat3x4 the inverse matrix of the transformation
+ */
+mat3x4 transform_getInverse(Transform* t);
+
+/**
+ * @brief get the matrix of a transform as a 4x4 matrix
+ * 
+ * @param t a pointer to the transform
+ * @return mat4 the matrix of the transformation
+ */
+mat4 transform_getMat4(Transform* t);
+
+/**
+ * @brief get the inverse matrix of a transform as a 4x4 matrix
+ * 
+ * @param t a pointer to the transform
+ * @return mat4 the inverse matrix of the transformation
+ */
+mat4 transform_getInverseMat4(Transform* t);
+
+/**
+ * @brief rebuild the cached matrices of all transforms in an array that changed
+ * 
+ * Call this once per frame after all transforms are changed, so the matrices can be read later without checking the
+ * transforms again
+ * 
+ * @param t a pointer to the transforms to update
+ * @param n the amount of transforms
+ */
+void transform_flushArray(Transform* t, size_t n);
+
+//end a potential C-Section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief rebuild the cached matrices of all transforms in an array that changed
+ * 
+ * @param t a pointer to the transforms to update
+ * @param count the amount of transforms
+ */
+inline void flush(Transform* t, size_t count) noexcept
+{transform_flushArray(t, count);}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief rebuild the cached matrices of all transforms in a span that changed
+ * 
+ * @param t the transforms to update
+ */
+inline void flush(std::span<Transform> t) noexcept
+{transform_flushArray(t.data(), t.size());}
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+/**
+ * @file GLGE_Test_Cross.cpp
+ * @author DM8AT
+ * @brief check the cross products of the 3D vectors against the right handed axes
+ *
+ * The cross product of two axes is the third axis (x * y = z, y * z = x, z * x = y). The scalar cross products of all
+ * 3D vector types and the batched cross product of vec3SoA with every supported instruction set must agree on them.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the output
+#include <cstdio>
+
+//the amount of failed checks
+static int failures = 0;
+
+//the pairs of vectors to multiply and their cross products, the axes and their reverse order followed by a general pair
+static const float as[][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {0, 1, 0}, {0, 0, 1}, {1, 0, 0}, {1, 2, 3}};
+static const float bs[][3] = {{0, 1, 0}, {0, 0, 1}, {1, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {4, 5, 6}};
+static const float cs[][3] = {{0, 0, 1}, {1, 0, 0}, {0, 1, 0}, {0, 0, -1}, {-1, 0, 0}, {0, -1, 0}, {-3, 6, -3}};
+//the amount of pairs
+#define PAIR_COUNT (sizeof(as) / sizeof(as[0]))
+
+/**
+ * @brief check if a cross product is the expected vector
+ *
+ * @param name the name of the check
+ * @param i the index of the pair
+ * @param x the x component of the cross product
+ * @param y the y component of the cross product
+ * @param z the z component of the cross product
+ */
+static void expect(const char* name, size_t i, double x, double y, double z) {
+    if (x != cs[i][0] || y != cs[i][1] || z != cs[i][2]) {
+        printf("FAILED %s of pair %zu : got (%g, %g, %g), expected (%g, %g, %g)\n", name, i, x, y, z, cs[i][0], cs[i][1], cs[i][2]);
+        ++failures;
+    }
+}
+
+int main() {
+    for (size_t i = 0; i < PAIR_COUNT; ++i) {
+        vec3 v = cross(vec3(as[i][0], as[i][1], as[i][2]), vec3(bs[i][0], bs[i][1], bs[i][2]));
+        expect("vec3", i, v.x, v.y, v.z);
+        dvec3 d = cross(dvec3(as[i][0], as[i][1], as[i][2]), dvec3(bs[i][0], bs[i][1], bs[i][2]));
+        expect("dvec3", i, d.x, d.y, d.z);
+        ivec3 n = cross(ivec3((int32_t)as[i][0], (int32_t)as[i][1], (int32_t)as[i][2]), ivec3((int32_t)bs[i][0], (int32_t)bs[i][1], (int32_t)bs[i][2]));
+        expect("ivec3", i, n.x, n.y, n.z);
+    }
+    //unsigned vectors can only hold the products of the axes in right handed order
+    for (size_t i = 0; i < 3; ++i) {
+        uivec3 u = cross(uivec3((uint32_t)as[i][0], (uint32_t)as[i][1], (uint32_t)as[i][2]), uivec3((uint32_t)bs[i][0], (uint32_t)bs[i][1], (uint32_t)bs[i][2]));
+        expect("uivec3", i, u.x, u.y, u.z);
+    }
+
+    //the batched cross product must match the scalar one with every instruction set
+    vec3SoA a(PAIR_COUNT), b(PAIR_COUNT);
+    for (size_t i = 0; i < PAIR_COUNT; ++i) {
+        a.set(i, vec3(as[i][0], as[i][1], as[i][2]));
+        b.set(i, vec3(bs[i][0], bs[i][1], bs[i][2]));
+    }
+    for (int l = GLGE_SIMD_LEVEL_SCALAR; l <= (int)glge_getSupportedSIMDLevel(); ++l) {
+        glge_setSIMDLevel((SIMDLevel)l);
+        vec3SoA c = cross(a, b);
+        for (size_t i = 0; i < PAIR_COUNT; ++i) {
+            vec3 v = c[i];
+            expect(glge_getSIMDLevelName((SIMDLevel)l), i, v.x, v.y, v.z);
+        }
+    }
+    glge_resetSIMDLevel();
+
+    if (failures) {printf("%d checks failed\n", failures);}
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file GLGE_Test_MathFunctions.cpp
+ * @author DM8AT
+ * @brief check the special values of the transcendental functions with every supported instruction set
+ * 
+ * The sine and the tangent keep the sign of a zero angle and atan2 returns the diagonal angles for two infinities,
+ * like the functions of the C math library. Angles close to a multiple of pi/2 and pow keep their documented accuracy, angles
+ * that are too large for the argument reduction match the C math library.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the output
+#include <cstdio>
+//include the largest floats and doubles
+#include <cfloat>
+
+//the amount of values of the array functions, not a multiple of any pack width so the remaining elements are tested as well
+#define TEST_COUNT 11
+
+//the amount of failed checks
+static int failures = 0;
+
+/**
+ * @brief check if a result is the expected value, zeros must have the same sign and NaNs must be NaN
+ * 
+ * @param name the name of the check
+ * @param level the name of the instruction set
+ * @param got the computed value
+ * @param expected the expected value
+ * @param tolerance the largest allowed relative difference
+ */
+static void expect(const char* name, const char* level, double got, double expected, double tolerance) {
+    bool ok;
+    if (expected != expected) {ok = got != got;}
+    else if (expected == 0.) {ok = (got == 0.) && (std::signbit(got) == std::signbit(expected));}
+    else {ok = std::fabs(got - expected) <= tolerance * std::fabs(expected);}
+    if (!ok) {
+        printf("FAILED %s (%s) : got %.17g, expected %.17g\n", name, level, got, expected);
+        ++failures;
+    }
+}
+
+int main() {
+    //angles that are too large for the argument reduction, they are computed by the C math library for every instruction set
+    const float bigs[] = {1e6f, -1e10f, 1e30f, FLT_MAX, -FLT_MAX, INFINITY};
+    const double dbigs[] = {1e6, -1e10, 1e30, 1e100, DBL_MAX, -DBL_MAX, INFINITY};
+    const size_t bigCount = sizeof(bigs) / sizeof(bigs[0]);
+    const size_t dbigCount = sizeof(dbigs) / sizeof(dbigs[0]);
+    const float ys[] = {INFINITY, INFINITY, -INFINITY, -INFINITY, NAN, 1.f, 2.f, -3.f};
+    const float xs[] = {INFINITY, -INFINITY, INFINITY, -INFINITY, 1.f, NAN, 2.f, -3.f};
+    const size_t pairs = sizeof(ys) / sizeof(ys[0]);
+
+    for (int l = GLGE_SIMD_LEVEL_SCALAR; l <= (int)glge_getSupportedSIMDLevel(); ++l) {
+        glge_setSIMDLevel((SIMDLevel)l);
+        const char* level = glge_getSIMDLevelName((SIMDLevel)l);
+
+        //the sign of a zero angle is kept by the sine and the tangent
+        for (float zero : {0.f, -0.f}) {
+            float in[TEST_COUNT], out[TEST_COUNT], cs[TEST_COUNT];
+            double din[TEST_COUNT], dout[TEST_COUNT], dcs[TEST_COUNT];
+            for (size_t i = 0; i < TEST_COUNT; ++i) {in[i] = zero; din[i] = zero;}
+            glge_sinArray(in, out, TEST_COUNT);
+            for (size_t i = 0; i < TEST_COUNT; ++i) {expect("sinArray of a zero", level, out[i], zero, 0.);}
+            glge_tanArray(in, out, TEST_COUNT);
+            for (size_t i = 0; i < TEST_COUNT; ++i) {expect("tanArray of a zero", level, out[i], zero, 0.);}
+            glge_sincosArray(in, out, cs, TEST_COUNT);
+            for (size_t i = 0; i < TEST_COUNT; ++i) {
+                expect("sincosArray sine of a zero", level, out[i], zero, 0.);
+                expect("sincosArray cosine of a zero", level, cs[i], 1., 0.);
+            }
+            glge_dsinArray(din, dout, TEST_COUNT);
+            for (size_t i = 0; i < TEST_COUNT; ++i) {expect("dsinArray of a zero", level, dout[i], zero, 0.);}
+            glge_dsincosArray(din, dout, dcs, TEST_COUNT);
+            for (size_t i = 0; i < TEST_COUNT; ++i) {expect("dsincosArray sine of a zero", level, dout[i], zero, 0.);}
+        }
+
+        //the infinities are on the diagonals, NaNs are passed through
+        float y[TEST_COUNT], x[TEST_COUNT], out[TEST_COUNT];
+        double dy[TEST_COUNT], dx[TEST_COUNT], dout[TEST_COUNT];
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            y[i] = ys[i % pairs]; x[i] = xs[i % pairs];
+            dy[i] = y[i]; dx[i] = x[i];
+        }
+        glge_atan2Array(y, x, out, TEST_COUNT);
+        glge_datan2Array(dy, dx, dout, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            expect("atan2Array", level, out[i], std::atan2((double)y[i], (double)x[i]), 1e-6);
+            expect("datan2Array", level, dout[i], std::atan2(dy[i], dx[i]), 1e-15);
+        }
+
+        //the reduction of angles close to a multiple of pi/2 must be exact even without FMA3, pow must not lose the 
+        //rounding of y * log(x)
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            x[i] = (i & 1) ? -9.42477798f : 9.42477798f;
+            y[i] = 62.5788078f;
+            dx[i] = (i & 1) ? -9.42477796076938 : 9.42477796076938;
+        }
+        glge_sinArray(x, out, TEST_COUNT);
+        glge_dsinArray(dx, dout, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            expect("sinArray close to 3pi", level, out[i], std::sin((double)x[i]), 2.5e-7);
+            expect("dsinArray close to 3pi", level, dout[i], (double)sinl(dx[i]), 6e-16);
+        }
+        for (size_t i = 0; i < TEST_COUNT; ++i) {x[i] = -16.5910778f;}
+        glge_powArray(y, x, out, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {expect("powArray", level, out[i], std::pow((double)y[i], (double)x[i]), 1.2e-7);}
+
+        //large angles must match the C math library exactly, every pack mixes them with a small angle
+        float cs[TEST_COUNT];
+        double dcs[TEST_COUNT];
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            x[i] = (i % 3 == 2) ? 0.5f : bigs[i % bigCount];
+            dx[i] = (i % 3 == 2) ? 0.5 : dbigs[i % dbigCount];
+        }
+        glge_sincosArray(x, out, cs, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            expect("sincosArray sine of a large angle", level, out[i], std::sin(x[i]), (i % 3 == 2) ? 2.5e-7 : 0.);
+            expect("sincosArray cosine of a large angle", level, cs[i], std::cos(x[i]), (i % 3 == 2) ? 2.5e-7 : 0.);
+        }
+        glge_tanArray(x, out, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i)
+        {expect("tanArray of a large angle", level, out[i], std::sin(x[i]) / std::cos(x[i]), (i % 3 == 2) ? 5e-7 : 0.);}
+        glge_dsincosArray(dx, dout, dcs, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {
+            expect("dsincosArray sine of a large angle", level, dout[i], std::sin(dx[i]), (i % 3 == 2) ? 6e-16 : 0.);
+            expect("dsincosArray cosine of a large angle", level, dcs[i], std::cos(dx[i]), (i % 3 == 2) ? 6e-16 : 0.);
+        }
+    }
+    glge_resetSIMDLevel();
+
+    //the functions for single values use the same kernels
+    expect("sin(-0)", "single", glge::sin(-0.f), -0., 0.);
+    expect("sin(-0) of doubles", "single", glge::sin(-0.), -0., 0.);
+    expect("tan(-0)", "single", glge::tan(-0.f), -0., 0.);
+    for (size_t i = 0; i < bigCount; ++i) {
+        float s, c;
+        glge::sincos(bigs[i], s, c);
+        expect("sin of a large angle", "single", glge::sin(bigs[i]), std::sin(bigs[i]), 0.);
+        expect("cos of a large angle", "single", glge::cos(bigs[i]), std::cos(bigs[i]), 0.);
+        expect("sincos sine of a large angle", "single", s, std::sin(bigs[i]), 0.);
+        expect("sincos cosine of a large angle", "single", c, std::cos(bigs[i]), 0.);
+    }
+    for (size_t i = 0; i < dbigCount; ++i) {
+        expect("sin of a large double angle", "single", glge::sin(dbigs[i]), std::sin(dbigs[i]), 0.);
+        expect("cos of a large double angle", "single", glge::cos(dbigs[i]), std::cos(dbigs[i]), 0.);
+    }
+    for (size_t i = 0; i < pairs; ++i) {
+        expect("atan2", "single", glge::atan2(ys[i], xs[i]), std::atan2((double)ys[i], (double)xs[i]), 1e-6);
+        expect("atan2 of doubles", "single", glge::atan2((double)ys[i], (double)xs[i]), std::atan2((double)ys[i], (double)xs[i]), 1e-15);
+    }
+
+    if (failures) {printf("%d checks failed\n", failures);}
+    return failures ? 1 : 0;
+}
\ No newline at end of file
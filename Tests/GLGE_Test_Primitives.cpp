@@ -0,0 +1,75 @@
+/**
+ * @file GLGE_Test_Primitives.cpp
+ * @author DM8AT
+ * @brief check the ray and box intersections for rays that start on a face of the box and run along it
+ * 
+ * Such a ray is parallel to a slab and starts on one of its bounds, so a distance of the slab test is 0 * infinity.
+ * The single intersection and the batch intersection of every supported instruction set must report a hit at 0.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the output
+#include <cstdio>
+
+//the amount of failed checks
+static int failures = 0;
+
+/**
+ * @brief check a ray against a box, once on its own and once in a batch with every instruction set
+ * 
+ * @param name the name of the check
+ * @param r the ray
+ * @param b the box
+ * @param hit true if the ray must hit the box
+ * @param dist the expected distance if the ray hits the box
+ */
+static void check(const char* name, const ray3& r, const aabb3& b, bool hit, float dist) {
+    float t = -1.f;
+    bool single = r.intersect(b, INFINITY, &t);
+    if (single != hit || (hit && t != dist)) {
+        printf("FAILED %s : single intersection returned %d at %g\n", name, single, t);
+        ++failures;
+    }
+
+    //put the box into every lane and into the remaining boxes of a batch
+    aabb3 boxes[11];
+    for (size_t i = 0; i < 11; ++i) {boxes[i] = b;}
+    for (int l = GLGE_SIMD_LEVEL_SCALAR; l <= (int)glge_getSupportedSIMDLevel(); ++l) {
+        glge_setSIMDLevel((SIMDLevel)l);
+        float ts[11];
+        size_t count = intersect(r, boxes, 11, ts);
+        for (size_t i = 0; i < 11; ++i) {
+            bool batch = ts[i] < INFINITY;
+            if (batch != hit || (hit && ts[i] != dist)) {
+                printf("FAILED %s : box %zu of the batch returned %g (%s)\n", name, i, ts[i], glge_getSIMDLevelName((SIMDLevel)l));
+                ++failures;
+            }
+        }
+        if (count != (hit ? 11u : 0u)) {
+            printf("FAILED %s : the batch counted %zu hits (%s)\n", name, count, glge_getSIMDLevelName((SIMDLevel)l));
+            ++failures;
+        }
+    }
+    glge_resetSIMDLevel();
+}
+
+int main() {
+    aabb3 unit(vec3(0.f, 0.f, 0.f), vec3(1.f, 1.f, 1.f));
+    check("corner, along the x axis", ray3(vec3(0.f, 0.f, 0.f), vec3(1.f, 0.f, 0.f)), unit, true, 0.f);
+    check("on the minimal y face, along the x axis", ray3(vec3(0.5f, 0.f, 0.5f), vec3(1.f, 0.f, 0.f)), unit, true, 0.f);
+    check("on the maximal y face, along the x axis", ray3(vec3(0.5f, 1.f, 0.5f), vec3(1.f, 0.f, 0.f)), unit, true, 0.f);
+    check("on the minimal y face, along the negative x axis", ray3(vec3(0.5f, 0.f, 0.5f), vec3(-1.f, -0.f, 0.f)), unit, true, 0.f);
+    check("in front of the minimal x face, along the y axis", ray3(vec3(0.f, -2.f, 0.f), vec3(0.f, 1.f, 0.f)), unit, true, 2.f);
+    check("beside the minimal y face, along the x axis", ray3(vec3(0.5f, -0.5f, 0.5f), vec3(1.f, 0.f, 0.f)), unit, false, 0.f);
+    check("beside the maximal y face, along the x axis", ray3(vec3(0.5f, 1.5f, 0.5f), vec3(1.f, 0.f, 0.f)), unit, false, 0.f);
+
+    if (failures) {printf("%d checks failed\n", failures);}
+    return failures ? 1 : 0;
+}
\ No newline at end of file
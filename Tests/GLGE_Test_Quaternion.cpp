@@ -0,0 +1,60 @@
+/**
+ * @file GLGE_Test_Quaternion.cpp
+ * @author DM8AT
+ * @brief check the quaternions created from euler angles against the product of the three axis rotations
+ * 
+ * A quaternion created from the euler angle (x, y, z) must rotate like the matrix Rz(z) * Ry(y) * Rx(x), so roll is
+ * applied first and yaw last.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the output
+#include <cstdio>
+
+//the largest allowed difference of a matrix element
+#define TEST_TOLERANCE 1e-5f
+
+/**
+ * @brief create the product of the rotations around the x, y and z axis
+ * 
+ * @param euler the angles around the x, y and z axis in radians
+ * @return mat4 the matrix Rz * Ry * Rx
+ */
+static mat4 eulerMatrix(const vec3& euler) {
+    float cx = std::cos(euler.x), sx = std::sin(euler.x);
+    float cy = std::cos(euler.y), sy = std::sin(euler.y);
+    float cz = std::cos(euler.z), sz = std::sin(euler.z);
+    mat4 rx(vec4(1, 0, 0, 0), vec4(0, cx, -sx, 0), vec4(0, sx, cx, 0), vec4(0, 0, 0, 1));
+    mat4 ry(vec4(cy, 0, sy, 0), vec4(0, 1, 0, 0), vec4(-sy, 0, cy, 0), vec4(0, 0, 0, 1));
+    mat4 rz(vec4(cz, -sz, 0, 0), vec4(sz, cz, 0, 0), vec4(0, 0, 1, 0), vec4(0, 0, 0, 1));
+    return rz * ry * rx;
+}
+
+int main() {
+    int failures = 0;
+    const vec3 angles[] = {
+        vec3(0.3f, 0.f, 0.f), vec3(0.f, 0.3f, 0.f), vec3(0.f, 0.f, 0.3f),
+        vec3(0.3f, 0.5f, 0.f), vec3(0.f, 0.5f, 0.7f), vec3(0.3f, 0.f, 0.7f),
+        vec3(0.3f, 0.5f, 0.7f), vec3(-1.2f, 0.9f, 2.5f), vec3(3.f, -1.4f, -0.1f)
+    };
+    for (const vec3& e : angles) {
+        mat4 q = Quaternion(e).toMat4();
+        mat4 m = eulerMatrix(e);
+        float diff = 0.f;
+        for (size_t i = 0; i < 16; ++i) {diff = std::fmax(diff, std::fabs(q.m[i] - m.m[i]));}
+        if (!(diff <= TEST_TOLERANCE)) {
+            printf("FAILED euler angle (%g, %g, %g) : the matrices differ by %g\n", e.x, e.y, e.z, diff);
+            ++failures;
+        }
+    }
+
+    if (failures) {printf("%d checks failed\n", failures);}
+    return failures ? 1 : 0;
+}
\ No newline at end of file
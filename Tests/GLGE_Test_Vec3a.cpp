@@ -0,0 +1,62 @@
+/**
+ * @file GLGE_Test_Vec3a.cpp
+ * @author DM8AT
+ * @brief check that the hidden element of the padded 3D vectors stays 0 when they are normalized
+ *
+ * Normalizing a vector of length 0 divides 0 by 0, the visible elements are NaN like for vec3 but the hidden element must
+ * still be 0. This is checked for the single vectors and for the arrays with every supported instruction set.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+//include the library
+#include "../GLGEMath.h"
+//include the output
+#include <cstdio>
+
+//the amount of vectors of the arrays, not a multiple of any pack width so the remaining vectors are tested as well
+#define TEST_COUNT 11
+
+//the amount of failed checks
+static int failures = 0;
+
+/**
+ * @brief check if the hidden element of a vector is a positive 0
+ *
+ * @param name the name of the check
+ * @param level the name of the instruction set
+ * @param v the vector to check
+ */
+static void expectPadding(const char* name, const char* level, const vec3a& v) {
+    if (v.pad != 0.f || std::signbit(v.pad)) {
+        printf("FAILED %s (%s) : the hidden element is %g\n", name, level, v.pad);
+        ++failures;
+    }
+}
+
+int main() {
+    //every third vector has a length of 0, the others are normalized as usual
+    vec3a in[TEST_COUNT], out[TEST_COUNT];
+    for (size_t i = 0; i < TEST_COUNT; ++i) {in[i] = (i % 3 == 0) ? vec3a(0.f) : vec3a((float)i, 2.f, -3.f);}
+
+    expectPadding("normalize of a zero vector", "single", normalize<glge::Precision::Exact>(vec3a(0.f)));
+    expectPadding("fast normalize of a zero vector", "single", normalize<glge::Precision::Fast>(vec3a(0.f)));
+    expectPadding("vec3a_normalize of a zero vector", "single", vec3a_normalize(vec3a(0.f)));
+
+    for (int l = GLGE_SIMD_LEVEL_SCALAR; l <= (int)glge_getSupportedSIMDLevel(); ++l) {
+        glge_setSIMDLevel((SIMDLevel)l);
+        const char* level = glge_getSIMDLevelName((SIMDLevel)l);
+        normalize<glge::Precision::Exact>(in, out, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {expectPadding("normalize of an array", level, out[i]);}
+        normalize<glge::Precision::Fast>(in, out, TEST_COUNT);
+        for (size_t i = 0; i < TEST_COUNT; ++i) {expectPadding("fast normalize of an array", level, out[i]);}
+    }
+    glge_resetSIMDLevel();
+
+    if (failures) {printf("%d checks failed\n", failures);}
+    return failures ? 1 : 0;
+}
@@ -23,3 +23,5 @@ dvec2 dvec2_multiply(dvec2 v, dvec2 u) {return v * u;}
 dvec2 dvec2_divide(dvec2 v, dvec2 u) {return v / u;}
 
 double dvec2_dot(dvec2 v, dvec2 u) {return dot(v, u);}
+
+dvec2 dvec2_fma(dvec2 v, dvec2 u, dvec2 w) {return fma(v, u, w);}
@@ -247,6 +247,19 @@ dvec2 dvec2_divide(dvec2 v, dvec2 u);
  */
 double dvec2_dot(dvec2 v, dvec2 u);
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec2 the sum of the product and w
+ */
+dvec2 dvec2_fma(dvec2 v, dvec2 u, dvec2 w);
+
 //end a potential C section and add the C++ specific functions
 #if __cplusplus
 }
@@ -261,22 +274,55 @@ double dvec2_dot(dvec2 v, dvec2 u);
 inline std::ostream& operator<< (std::ostream& os, const s_dvec2& v) noexcept
 {return os << "(" << v.x << ", " << v.y << ")";}
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec2 the sum of the product and w
+ */
+inline dvec2 fma(const dvec2& v, const dvec2& u, const dvec2& w) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_FMA
+    return _mm_fmadd_pd(v.simd, u.simd, w.simd);
+    #else
+    return _mm_add_pd(_mm_mul_pd(v.simd, u.simd), w.simd);
+    #endif
+    #else
+    return dvec2(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y));
+    #endif
+}
+
 /**
  * @brief calculate the dot product of two 2D double vectors
  * 
+ * The fused version is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+ * 
  * @param v the first double vector
  * @param u the second double vector
  * @return const double the dot product of both vectors
  */
+#if GLGE_MATH_ALLOW_FMA
+inline GLGE_MATH_SIMD_CONSTEXPR double dot(const dvec2& v, const dvec2& u) noexcept {
+    //std::fma can't be evaluated at compile time, so constant evaluation uses the unfused sum
+    if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return v.x * u.x + v.y * u.y;}
+    return glge::fma(v.y, u.y, v.x * u.x);
+}
+#else
 inline constexpr double dot(const dvec2& v, const dvec2& u) noexcept {return v.x * u.x + v.y * u.y;}
+#endif
 
 /**
  * @brief calculate the length of a 2D double vector
  * 
  * @param v a constant reference to the vector to calculate the length of
- * @return constexpr float the length of the vector
+ * @return double the length of the vector
  */
-inline float length(const dvec2& v) noexcept {return glge::sqrt((float)(v.x*v.x + v.y*v.y));}
+inline double length(const dvec2& v) noexcept {return glge::sqrt(dot(v, v));}
 
 /**
  * @brief calculate a vector that points in the same direction 
@@ -24,4 +24,6 @@ dvec3 dvec3_divide(dvec3 v, dvec3 u) {return v / u;}
 
 double dvec3_dot(dvec3 v, dvec3 u) {return dot(v, u);}
 
+dvec3 dvec3_fma(dvec3 v, dvec3 u, dvec3 w) {return fma(v, u, w);}
+
 dvec3 dvec3_cross(dvec3 v, dvec3 u) {return cross(v, u);}
@@ -259,6 +259,19 @@ dvec3 dvec3_divide(dvec3 v, dvec3 u);
  */
 double dvec3_dot(dvec3 v, dvec3 u);
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec3 the sum of the product and w
+ */
+dvec3 dvec3_fma(dvec3 v, dvec3 u, dvec3 w);
+
 /**
  * @brief calculate the cross product of two 3D double vectors
  * 
@@ -282,14 +295,47 @@ dvec3 dvec3_cross(dvec3 v, dvec3 u);
 inline std::ostream& operator<<(std::ostream& os, const s_dvec3& u) noexcept
 {return os << "(" << u.x << ", " << u.y << ", " << u.z << ")";}
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec3 the sum of the product and w
+ */
+inline dvec3 fma(const dvec3& v, const dvec3& u, const dvec3& w) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_FMA
+    return dvec3(_mm_fmadd_pd(v.lower, u.lower, w.lower), glge::fma(v.z, u.z, w.z));
+    #else
+    return dvec3(_mm_add_pd(_mm_mul_pd(v.lower, u.lower), w.lower), glge::fma(v.z, u.z, w.z));
+    #endif
+    #else
+    return dvec3(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y), glge::fma(v.z, u.z, w.z));
+    #endif
+}
+
 /**
  * @brief calculate the dot product of two 2D double vectors
  * 
+ * The fused version is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+ * 
  * @param v the first double vector
  * @param u the second double vector
  * @return const double the dot product of both vectors
  */
+#if GLGE_MATH_ALLOW_FMA
+inline GLGE_MATH_SIMD_CONSTEXPR double dot(const dvec3& v, const dvec3& u) noexcept {
+    //std::fma can't be evaluated at compile time, so constant evaluation uses the unfused sum
+    if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return v.x * u.x + v.y * u.y + v.z * u.z;}
+    return glge::fma(v.z, u.z, glge::fma(v.y, u.y, v.x * u.x));
+}
+#else
 inline constexpr double dot(const dvec3& v, const dvec3& u) noexcept {return v.x * u.x + v.y * u.y + v.z * u.z;}
+#endif
 
 /**
  * @brief calculate the cross product between two 3D vectors
@@ -298,15 +344,15 @@ inline constexpr double dot(const dvec3& v, const dvec3& u) noexcept {return v.x
  * @param u the second vector
  * @return const dvec3 the cross product (vector product) of both vectors
  */
-inline constexpr dvec3 cross(const dvec3& v, const dvec3& u) noexcept {return dvec3(v.y*u.z - v.z*u.y, v.x*u.z - v.z*u.x, v.x*u.y - v.y*u.x);}
+inline constexpr dvec3 cross(const dvec3& v, const dvec3& u) noexcept {return dvec3(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);}
 
 /**
  * @brief calculate the length of a 3D double vector
  * 
  * @param v a constant reference to the vector to calculate the length of
- * @return constexpr float the length of the vector
+ * @return double the length of the vector
  */
-inline float length(const dvec3& v) noexcept {return glge::sqrt((float)(v.x*v.x + v.y*v.y + v.z*v.z));}
+inline double length(const dvec3& v) noexcept {return glge::sqrt(dot(v, v));}
 
 /**
  * @brief calculate a vector that points in the same direction 
@@ -31,3 +31,7 @@ void dvec4_multiplyTo(dvec4* a, dvec4 b) {*a *= b;}
 void dvec4_divideBy(dvec4* a, dvec4 b) {*a /= b;}
 
 double dvec4_dot(dvec4 v, dvec4 u) {return dot(v, u);}
+
+dvec4 dvec4_fma(dvec4 v, dvec4 u, dvec4 w) {return fma(v, u, w);}
+
+dvec4 dvec4_sqrt(dvec4 v) {return sqrt(v);}
@@ -453,6 +453,27 @@ void dvec4_divideBy(dvec4* a, dvec4 b);
  */
 double dvec4_dot(dvec4 v, dvec4 u);
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec4 the sum of the product and w
+ */
+dvec4 dvec4_fma(dvec4 v, dvec4 u, dvec4 w);
+
+/**
+ * @brief compute the squareroot of every element of a vector
+ * 
+ * @param v the vector to compute the squareroots of
+ * @return dvec4 the squareroots of the elements
+ */
+dvec4 dvec4_sqrt(dvec4 v);
+
 //end a potential C section and add the C++ specific functions
 #if __cplusplus
 }
@@ -467,22 +488,77 @@ double dvec4_dot(dvec4 v, dvec4 u);
 inline std::ostream& operator<<(std::ostream& os, const s_dvec4& u) noexcept
 {return os << "(" << u.x << ", " << u.y << ", " << u.z << ", " << u.w << ")";}
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return dvec4 the sum of the product and w
+ */
+inline dvec4 fma(const dvec4& v, const dvec4& u, const dvec4& w) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2 && GLGE_MATH_ALLOW_FMA
+    return _mm256_fmadd_pd(v.simd, u.simd, w.simd);
+    #elif GLGE_MATH_ALLOW_AVX2
+    return _mm256_add_pd(_mm256_mul_pd(v.simd, u.simd), w.simd);
+    #elif GLGE_MATH_ALLOW_FMA
+    return dvec4(_mm_fmadd_pd(v.lower, u.lower, w.lower), _mm_fmadd_pd(v.upper, u.upper, w.upper));
+    #else
+    return dvec4(_mm_add_pd(_mm_mul_pd(v.lower, u.lower), w.lower), _mm_add_pd(_mm_mul_pd(v.upper, u.upper), w.upper));
+    #endif
+    #else
+    return dvec4(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y), glge::fma(v.z, u.z, w.z), glge::fma(v.w, u.w, w.w));
+    #endif
+}
+
+/**
+ * @brief compute the squareroot of every element of a vector
+ * 
+ * @param v the vector to compute the squareroots of
+ * @return dvec4 the squareroots of the elements
+ */
+inline dvec4 sqrt(const dvec4& v) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return glge::sqrt(v.simd);
+    #else
+    return dvec4(glge::sqrt(v.lower), glge::sqrt(v.upper));
+    #endif
+    #else
+    return dvec4(glge::sqrt(v.x), glge::sqrt(v.y), glge::sqrt(v.z), glge::sqrt(v.w));
+    #endif
+}
+
 /**
  * @brief calculate the dot product of two 2D double vectors
  * 
+ * The fused version is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+ * 
  * @param v the first double vector
  * @param u the second double vector
  * @return const double the dot product of both vectors
  */
+#if GLGE_MATH_ALLOW_FMA
+inline GLGE_MATH_SIMD_CONSTEXPR double dot(const dvec4& v, const dvec4& u) noexcept {
+    //std::fma can't be evaluated at compile time, so constant evaluation uses the unfused sum
+    if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return v.x * u.x + v.y * u.y + v.z * u.z + v.w * u.w;}
+    return glge::fma(v.w, u.w, glge::fma(v.z, u.z, glge::fma(v.y, u.y, v.x * u.x)));
+}
+#else
 inline constexpr double dot(const dvec4& v, const dvec4& u) noexcept {return v.x * u.x + v.y * u.y + v.z * u.z + v.w * u.w;}
+#endif
 
 /**
  * @brief calculate the length of a 3D vector
  * 
  * @param v a constant reference to the vector to calculate the length of
- * @return constexpr float the length of the vector
+ * @return double the length of the vector
  */
-inline float length(const dvec4& v) noexcept {return glge::sqrt((float)(v.x*v.x + v.y*v.y + v.z*v.z + v.w*v.w));}
+inline double length(const dvec4& v) noexcept {return glge::sqrt(dot(v, v));}
 
 /**
  * @brief calculate a vector that points in the same direction 
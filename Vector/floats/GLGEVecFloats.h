@@ -19,5 +19,12 @@
 #include "GLGE_vec3.h"
 //include float 4D vectors
 #include "GLGE_vec4.h"
+//include padded float 3D vectors
+#include "GLGE_vec3a.h"
+
+//include the structure of arrays containers
+#include "GLGE_vec2SoA.h"
+#include "GLGE_vec3SoA.h"
+#include "GLGE_vec4SoA.h"
 
 #endif
\ No newline at end of file
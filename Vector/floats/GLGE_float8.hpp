@@ -0,0 +1,576 @@
+/**
+ * @file GLGE_float8.hpp
+ * @author DM8AT
+ * @brief define a C++ only wide float that holds 8 lanes, the base for the wide (AoSoA) vector and matrix types
+ * 
+ * With AVX2 a float8 is a single __m256 register, with SSE it is made of two __m128 registers and without SIMD it is
+ * a plain array of 8 floats. All functions behave the same for all three variants.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_8_
+#define _GLGE_FLOAT_8_
+
+//only available for C++
+#if __cplusplus
+
+//include the settings
+#include "../../GLGEMath_Settings.h"
+//include the common functions for the square root
+#include "../../GLGE_Common.h"
+//include output streams for printing
+#include <iostream>
+
+//if SIMD is requested, include SIMD intrinsics
+#if GLGE_MATH_USE_SIMD
+#if GLGE_MATH_ALLOW_AVX2
+#include <immintrin.h>
+#else
+#include <xmmintrin.h>
+#endif
+#endif
+
+/**
+ * @brief store 8 booleans as the result of a comparison of two wide floats
+ * 
+ * For SIMD a true lane has all bits set and a false lane has no bits set
+ */
+struct alignas(32) mask8 {
+
+    /**
+     * @brief store the actual data for the mask
+     */
+    #if GLGE_MATH_USE_SIMD
+    union {
+        #if GLGE_MATH_ALLOW_AVX2
+        //store the lanes in a single AVX register
+        __m256 simd;
+        #else
+        //store the lanes in two SSE registers
+        struct {
+            __m128 lower;
+            __m128 upper;
+        };
+        #endif
+    };
+    #else
+    //store the lanes as booleans
+    bool vals[8];
+    #endif
+
+    /**
+     * @brief Construct a new mask8
+     * 
+     * @param b the value for all lanes
+     */
+    inline mask8(bool b = false) noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        simd = b ? _mm256_castsi256_ps(_mm256_set1_epi32(-1)) : _mm256_setzero_ps();
+        #else
+        lower = upper = b ? _mm_cmpeq_ps(_mm_setzero_ps(), _mm_setzero_ps()) : _mm_setzero_ps();
+        #endif
+        #else
+        for (int i = 0; i < 8; ++i) {vals[i] = b;}
+        #endif
+    }
+
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    /**
+     * @brief Construct a new mask8
+     * 
+     * @param _simd the register holding the lanes
+     */
+    inline mask8(const __m256& _simd) noexcept : simd(_simd) {}
+    #else
+    /**
+     * @brief Construct a new mask8
+     * 
+     * @param _lower the register holding the lanes 0 to 3
+     * @param _upper the register holding the lanes 4 to 7
+     */
+    inline mask8(const __m128& _lower, const __m128& _upper) noexcept : lower(_lower), upper(_upper) {}
+    #endif
+    #endif
+
+    /**
+     * @brief get the lanes of the mask as bits
+     * 
+     * @return int a bit field where bit i is set if lane i is true
+     */
+    inline int bits() const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        return _mm256_movemask_ps(simd);
+        #else
+        return _mm_movemask_ps(lower) | (_mm_movemask_ps(upper) << 4);
+        #endif
+        #else
+        int b = 0;
+        for (int i = 0; i < 8; ++i) {b |= vals[i] << i;}
+        return b;
+        #endif
+    }
+
+    /**
+     * @brief check a single lane of the mask
+     * 
+     * @param i the index of the lane
+     * @return true : the lane is set
+     * @return false : the lane is not set
+     */
+    inline bool operator[](int i) const noexcept {return (bits() >> i) & 1;}
+
+};
+
+/**
+ * @brief combine two masks using a logical and
+ */
+inline mask8 operator&(const mask8& a, const mask8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_and_ps(a.simd, b.simd);
+    #else
+    return mask8(_mm_and_ps(a.lower, b.lower), _mm_and_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] && b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief combine two masks using a logical or
+ */
+inline mask8 operator|(const mask8& a, const mask8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_or_ps(a.simd, b.simd);
+    #else
+    return mask8(_mm_or_ps(a.lower, b.lower), _mm_or_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] || b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief combine two masks using a logical exclusive or
+ */
+inline mask8 operator^(const mask8& a, const mask8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_xor_ps(a.simd, b.simd);
+    #else
+    return mask8(_mm_xor_ps(a.lower, b.lower), _mm_xor_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] != b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief invert all lanes of a mask
+ */
+inline mask8 operator~(const mask8& a) noexcept {return a ^ mask8(true);}
+
+/**
+ * @brief check if any lane of a mask is set
+ */
+inline bool any(const mask8& m) noexcept {return m.bits() != 0;}
+
+/**
+ * @brief check if all lanes of a mask are set
+ */
+inline bool all(const mask8& m) noexcept {return m.bits() == 0xFF;}
+
+/**
+ * @brief check if no lane of a mask is set
+ */
+inline bool none(const mask8& m) noexcept {return m.bits() == 0;}
+
+/**
+ * @brief store 8 floats that are processed together
+ */
+struct alignas(32) float8 {
+
+    /**
+     * @brief store the actual data for the wide float
+     */
+    union {
+        //store the values of all lanes
+        float vals[8];
+
+        //only add the SIMD stuff if SIMD is enabled
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        //store the lanes in a single AVX register
+        __m256 simd;
+        #else
+        //store the lanes in two SSE registers
+        struct {
+            __m128 lower;
+            __m128 upper;
+        };
+        #endif
+        #endif
+    };
+
+    /**
+     * @brief Construct a new float8
+     * all lanes are 0
+     */
+    inline float8() noexcept : float8(0.f) {}
+
+    /**
+     * @brief Construct a new float8
+     * 
+     * @param f the value for all lanes
+     */
+    inline float8(float f) noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        simd = _mm256_set1_ps(f);
+        #else
+        lower = upper = _mm_set1_ps(f);
+        #endif
+        #else
+        for (int i = 0; i < 8; ++i) {vals[i] = f;}
+        #endif
+    }
+
+    /**
+     * @brief Construct a new float8
+     * 
+     * @param f0 - f7 the values for the lanes 0 to 7
+     */
+    inline float8(float f0, float f1, float f2, float f3, float f4, float f5, float f6, float f7) noexcept
+     : vals{f0,f1,f2,f3,f4,f5,f6,f7}
+    {}
+
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    /**
+     * @brief Construct a new float8
+     * 
+     * @param _simd the register holding the lanes
+     */
+    inline float8(const __m256& _simd) noexcept : simd(_simd) {}
+    #else
+    /**
+     * @brief Construct a new float8
+     * 
+     * @param _lower the register holding the lanes 0 to 3
+     * @param _upper the register holding the lanes 4 to 7
+     */
+    inline float8(const __m128& _lower, const __m128& _upper) noexcept : lower(_lower), upper(_upper) {}
+    #endif
+    #endif
+
+    /**
+     * @brief load 8 floats from memory
+     * 
+     * @param p a pointer to the floats, no alignment is required
+     * @return float8 the loaded floats
+     */
+    static inline float8 load(const float* p) noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        return _mm256_loadu_ps(p);
+        #else
+        return float8(_mm_loadu_ps(p), _mm_loadu_ps(p + 4));
+        #endif
+        #else
+        return float8(p[0], p[1], p[2], p[3], p[4], p[5], p[6], p[7]);
+        #endif
+    }
+
+    /**
+     * @brief store the 8 floats to memory
+     * 
+     * @param p a pointer to write the floats to, no alignment is required
+     */
+    inline void store(float* p) const noexcept {
+        #if GLGE_MATH_USE_SIMD
+        #if GLGE_MATH_ALLOW_AVX2
+        _mm256_storeu_ps(p, simd);
+        #else
+        _mm_storeu_ps(p, lower);
+        _mm_storeu_ps(p + 4, upper);
+        #endif
+        #else
+        for (int i = 0; i < 8; ++i) {p[i] = vals[i];}
+        #endif
+    }
+
+    /**
+     * @brief access a single lane
+     * 
+     * @param i the index of the lane
+     * @return float the value of the lane
+     */
+    inline float operator[](int i) const noexcept {return vals[i];}
+
+    /**
+     * @brief access a single lane
+     * 
+     * @param i the index of the lane
+     * @return float& a reference to the value of the lane
+     */
+    inline float& operator[](int i) noexcept {return vals[i];}
+
+    /**
+     * @brief add and assign another wide float to this one
+     */
+    inline float8& operator+=(const float8& f) noexcept;
+
+    /**
+     * @brief subtract and assign another wide float from this one
+     */
+    inline float8& operator-=(const float8& f) noexcept;
+
+    /**
+     * @brief multiply and assign another wide float to this one
+     */
+    inline float8& operator*=(const float8& f) noexcept;
+
+    /**
+     * @brief divide this wide float by another one
+     */
+    inline float8& operator/=(const float8& f) noexcept;
+
+};
+
+//the arithmetic functions only differ in the instruction used, so they share their body. The helpers are undefined below
+#if GLGE_MATH_USE_SIMD
+#if GLGE_MATH_ALLOW_AVX2
+#define GLGE_FLOAT8_BINARY(R, a, b, avx, sse, scalar) return R(avx(a.simd, b.simd))
+#define GLGE_FLOAT8_UNARY(R, a, avx, sse, scalar) return R(avx(a.simd))
+#else
+#define GLGE_FLOAT8_BINARY(R, a, b, avx, sse, scalar) return R(sse(a.lower, b.lower), sse(a.upper, b.upper))
+#define GLGE_FLOAT8_UNARY(R, a, avx, sse, scalar) return R(sse(a.lower), sse(a.upper))
+#endif
+#else
+#define GLGE_FLOAT8_BINARY(R, a, b, avx, sse, scalar) R r; for (int i = 0; i < 8; ++i) {r.vals[i] = scalar;} return r
+#define GLGE_FLOAT8_UNARY(R, a, avx, sse, scalar) R r; for (int i = 0; i < 8; ++i) {r.vals[i] = scalar;} return r
+#endif
+
+/**
+ * @brief add two wide floats together
+ */
+inline float8 operator+(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_add_ps, _mm_add_ps, a.vals[i] + b.vals[i]);}
+
+/**
+ * @brief subtract two wide floats
+ */
+inline float8 operator-(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_sub_ps, _mm_sub_ps, a.vals[i] - b.vals[i]);}
+
+/**
+ * @brief multiply two wide floats together
+ */
+inline float8 operator*(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_mul_ps, _mm_mul_ps, a.vals[i] * b.vals[i]);}
+
+/**
+ * @brief divide two wide floats
+ */
+inline float8 operator/(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_div_ps, _mm_div_ps, a.vals[i] / b.vals[i]);}
+
+/**
+ * @brief negate a wide float
+ */
+inline float8 operator-(const float8& a) noexcept {return float8(-0.f) - a;}
+
+inline float8& float8::operator+=(const float8& f) noexcept {return *this = *this + f;}
+inline float8& float8::operator-=(const float8& f) noexcept {return *this = *this - f;}
+inline float8& float8::operator*=(const float8& f) noexcept {return *this = *this * f;}
+inline float8& float8::operator/=(const float8& f) noexcept {return *this = *this / f;}
+
+/**
+ * @brief get the lane wise minimum of two wide floats
+ */
+inline float8 min(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_min_ps, _mm_min_ps, (b.vals[i] < a.vals[i]) ? b.vals[i] : a.vals[i]);}
+
+/**
+ * @brief get the lane wise maximum of two wide floats
+ */
+inline float8 max(const float8& a, const float8& b) noexcept
+{GLGE_FLOAT8_BINARY(float8, a, b, _mm256_max_ps, _mm_max_ps, (b.vals[i] > a.vals[i]) ? b.vals[i] : a.vals[i]);}
+
+/**
+ * @brief compute the square root of all lanes of a wide float
+ */
+inline float8 sqrt(const float8& a) noexcept
+{GLGE_FLOAT8_UNARY(float8, a, _mm256_sqrt_ps, _mm_sqrt_ps, glge::sqrt(a.vals[i]));}
+
+/**
+ * @brief compute the absolute value of all lanes of a wide float
+ */
+inline float8 abs(const float8& a) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_andnot_ps(_mm256_set1_ps(-0.f), a.simd);
+    #else
+    return float8(_mm_andnot_ps(_mm_set1_ps(-0.f), a.lower), _mm_andnot_ps(_mm_set1_ps(-0.f), a.upper));
+    #endif
+    #else
+    float8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = std::fabs(a.vals[i]);}
+    return r;
+    #endif
+}
+
+/**
+ * @brief compute a * b + c for all lanes
+ * 
+ * A single rounding (fused multiply-add) is used if AVX2 and FMA3 are enabled
+ */
+inline float8 fma(const float8& a, const float8& b, const float8& c) noexcept {
+    #if GLGE_MATH_USE_SIMD && GLGE_MATH_ALLOW_AVX2
+    #if GLGE_MATH_ALLOW_FMA
+    return _mm256_fmadd_ps(a.simd, b.simd, c.simd);
+    #else
+    return _mm256_add_ps(_mm256_mul_ps(a.simd, b.simd), c.simd);
+    #endif
+    #else
+    return a * b + c;
+    #endif
+}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator<(const float8& a, const float8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_cmp_ps(a.simd, b.simd, _CMP_LT_OQ);
+    #else
+    return mask8(_mm_cmplt_ps(a.lower, b.lower), _mm_cmplt_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] < b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator<=(const float8& a, const float8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_cmp_ps(a.simd, b.simd, _CMP_LE_OQ);
+    #else
+    return mask8(_mm_cmple_ps(a.lower, b.lower), _mm_cmple_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] <= b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator>(const float8& a, const float8& b) noexcept {return b < a;}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator>=(const float8& a, const float8& b) noexcept {return b <= a;}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator==(const float8& a, const float8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_cmp_ps(a.simd, b.simd, _CMP_EQ_OQ);
+    #else
+    return mask8(_mm_cmpeq_ps(a.lower, b.lower), _mm_cmpeq_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] == b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief compare two wide floats lane wise
+ */
+inline mask8 operator!=(const float8& a, const float8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_cmp_ps(a.simd, b.simd, _CMP_NEQ_UQ);
+    #else
+    return mask8(_mm_cmpneq_ps(a.lower, b.lower), _mm_cmpneq_ps(a.upper, b.upper));
+    #endif
+    #else
+    mask8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = a.vals[i] != b.vals[i];}
+    return r;
+    #endif
+}
+
+/**
+ * @brief select the lanes of two wide floats using a mask
+ * 
+ * @param m the mask to select with
+ * @param a the lanes to use where the mask is set
+ * @param b the lanes to use where the mask is not set
+ * @return float8 the selected lanes
+ */
+inline float8 select(const mask8& m, const float8& a, const float8& b) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_AVX2
+    return _mm256_blendv_ps(b.simd, a.simd, m.simd);
+    #else
+    return float8(_mm_or_ps(_mm_and_ps(m.lower, a.lower), _mm_andnot_ps(m.lower, b.lower)),
+                  _mm_or_ps(_mm_and_ps(m.upper, a.upper), _mm_andnot_ps(m.upper, b.upper)));
+    #endif
+    #else
+    float8 r;
+    for (int i = 0; i < 8; ++i) {r.vals[i] = m.vals[i] ? a.vals[i] : b.vals[i];}
+    return r;
+    #endif
+}
+
+//the lane wise helpers are only needed in this file
+#undef GLGE_FLOAT8_BINARY
+#undef GLGE_FLOAT8_UNARY
+
+/**
+ * @brief print a wide float into an output stream
+ * 
+ * @param os the output stream to fill
+ * @param f the wide float to put into the output stream
+ * @return std::ostream& the filled output stream
+ */
+inline std::ostream& operator<<(std::ostream& os, const float8& f) noexcept {
+    os << "(" << f.vals[0];
+    for (int i = 1; i < 8; ++i) {os << ", " << f.vals[i];}
+    return os << ")";
+}
+
+#endif
+
+#endif
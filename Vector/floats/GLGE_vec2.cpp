@@ -11,6 +11,8 @@
 
 //include 2D float vectors
 #include "GLGE_vec2.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
 
 vec2 vec2_add(vec2 v, vec2 u) {return v + u;}
 
@@ -23,3 +25,17 @@ vec2 vec2_multiply(vec2 v, vec2 u) {return v * u;}
 vec2 vec2_divide(vec2 v, vec2 u) {return v / u;}
 
 float vec2_dot(vec2 v, vec2 u) {return dot(v, u);}
+
+vec2 vec2_fma(vec2 v, vec2 u, vec2 w) {return fma(v, u, w);}
+
+void vec2_lengthArray(const vec2* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 2, false);}
+
+void vec2_lengthArrayFast(const vec2* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 2, true);}
+
+void vec2_normalizeArray(const vec2* in, vec2* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 2, false, false);}
+
+void vec2_normalizeArrayFast(const vec2* in, vec2* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 2, true, false);}
@@ -0,0 +1,160 @@
+/**
+ * @file GLGE_vec2SoA.cpp
+ * @author DM8AT
+ * @brief implement the structure of arrays container for 2D float vectors
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the 2D float vector container
+#include "GLGE_vec2SoA.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+//include memcpy and memset
+#include <string.h>
+
+//the amount of floats the capacity of a stream is rounded up to
+#define GLGE_SOA_PADDING (GLGE_MATH_SOA_ALIGNMENT / sizeof(float))
+
+s_vec2SoA::s_vec2SoA(size_t _size) noexcept
+ : s_vec2SoA()
+{vec2SoA_resize(this, _size);}
+
+s_vec2SoA::s_vec2SoA(const vec2* data, size_t count) noexcept
+ : s_vec2SoA()
+{vec2SoA_fromAoS(this, data, count);}
+
+s_vec2SoA::s_vec2SoA(const s_vec2SoA& other) noexcept
+ : s_vec2SoA()
+{*this = other;}
+
+s_vec2SoA::s_vec2SoA(s_vec2SoA&& other) noexcept
+ : s_vec2SoA()
+{*this = ((s_vec2SoA&&)other);}
+
+s_vec2SoA::~s_vec2SoA() noexcept
+{vec2SoA_free(this);}
+
+s_vec2SoA& s_vec2SoA::operator=(const s_vec2SoA& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    if (!vec2SoA_resize(this, other.size)) {return *this;}
+    for (size_t c = 0; c < 2; ++c) 
+    {memcpy(streams[c], other.streams[c], size * sizeof(float));}
+    return *this;
+}
+
+s_vec2SoA& s_vec2SoA::operator=(s_vec2SoA&& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    vec2SoA_free(this);
+    x = other.x; y = other.y;
+    size = other.size;
+    capacity = other.capacity;
+    other.x = NULL; other.y = NULL;
+    other.size = 0;
+    other.capacity = 0;
+    return *this;
+}
+
+bool s_vec2SoA::resize(size_t _size) noexcept
+{return vec2SoA_resize(this, _size);}
+
+bool vec2SoA_resize(vec2SoA* soa, size_t size) {
+    //grow the streams if the new size does not fit
+    if (size > soa->capacity) {
+        //at least double the capacity to keep repeated growing cheap and pad it to full registers
+        size_t capacity = (soa->capacity * 2 > size) ? soa->capacity * 2 : size;
+        capacity = (capacity + GLGE_SOA_PADDING - 1) & ~(GLGE_SOA_PADDING - 1);
+        //all streams share a single allocation
+        float* block = (float*)glge_alignedAlloc(capacity * 2 * sizeof(float), GLGE_MATH_SOA_ALIGNMENT);
+        if (!block) {return false;}
+        //copy the old elements and zero the padding
+        for (size_t c = 0; c < 2; ++c) {
+            float* stream = block + c*capacity;
+            if (soa->size) {memcpy(stream, soa->streams[c], soa->size * sizeof(float));}
+            memset(stream + soa->size, 0, (capacity - soa->size) * sizeof(float));
+        }
+        glge_alignedFree(soa->streams[0]);
+        for (size_t c = 0; c < 2; ++c) 
+        {soa->streams[c] = block + c*capacity;}
+        soa->capacity = capacity;
+    }
+    //else, zero the new elements in case a kernel wrote to the padding
+    else if (size > soa->size) {
+        for (size_t c = 0; c < 2; ++c) 
+        {memset(soa->streams[c] + soa->size, 0, (size - soa->size) * sizeof(float));}
+    }
+    soa->size = size;
+    return true;
+}
+
+void vec2SoA_free(vec2SoA* soa) {
+    //all streams share the allocation of the first stream
+    glge_alignedFree(soa->streams[0]);
+    soa->x = NULL;
+    soa->y = NULL;
+    soa->size = 0;
+    soa->capacity = 0;
+}
+
+bool vec2SoA_fromAoS(vec2SoA* soa, const vec2* data, size_t n) {
+    if (!vec2SoA_resize(soa, n)) {return false;}
+    glge::kernel::table().soaFromAoS((const float*)data, soa->streams, 2, n);
+    return true;
+}
+
+void vec2SoA_toAoS(const vec2SoA* soa, vec2* data) 
+{glge::kernel::table().soaToAoS(soa->streams, (float*)data, 2, soa->size);}
+
+vec2 vec2SoA_get(const vec2SoA* soa, size_t i) {return (*soa)[i];}
+
+void vec2SoA_set(vec2SoA* soa, size_t i, vec2 v) {soa->set(i, v);}
+
+/**
+ * @brief get the amount of vectors a function with two inputs processes and resize the output to it
+ * 
+ * @return size_t the amount of vectors to process (0 if the output could not be resized)
+ */
+static size_t vec2SoA_binarySize(const vec2SoA* a, const vec2SoA* b, vec2SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    return vec2SoA_resize(out, n) ? n : 0;
+}
+
+void vec2SoA_add(const vec2SoA* a, const vec2SoA* b, vec2SoA* out) {
+    size_t n = vec2SoA_binarySize(a, b, out);
+    glge::kernel::table().soaAdd(a->streams, b->streams, out->streams, 2, n);
+}
+
+void vec2SoA_subtract(const vec2SoA* a, const vec2SoA* b, vec2SoA* out) {
+    size_t n = vec2SoA_binarySize(a, b, out);
+    glge::kernel::table().soaSubtract(a->streams, b->streams, out->streams, 2, n);
+}
+
+void vec2SoA_multiply(const vec2SoA* a, const vec2SoA* b, vec2SoA* out) {
+    size_t n = vec2SoA_binarySize(a, b, out);
+    glge::kernel::table().soaMultiply(a->streams, b->streams, out->streams, 2, n);
+}
+
+void vec2SoA_fma(const vec2SoA* a, const vec2SoA* b, const vec2SoA* c, vec2SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    n = (n < c->size) ? n : c->size;
+    if (!vec2SoA_resize(out, n)) {return;}
+    glge::kernel::table().soaFma(a->streams, b->streams, c->streams, out->streams, 2, n);
+}
+
+void vec2SoA_dot(const vec2SoA* a, const vec2SoA* b, float* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    glge::kernel::table().soaDot(a->streams, b->streams, out, 2, n);
+}
+
+void vec2SoA_length(const vec2SoA* a, float* out) 
+{glge::kernel::table().soaLength(a->streams, out, 2, a->size);}
+
+void vec2SoA_normalize(const vec2SoA* a, vec2SoA* out) {
+    if (!vec2SoA_resize(out, a->size)) {return;}
+    glge::kernel::table().soaNormalize(a->streams, out->streams, 2, a->size);
+}
@@ -11,6 +11,8 @@
 
 //include the 3D float vector
 #include "GLGE_vec3.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
 
 vec3 vec3_add(vec3 v, vec3 u) {return v + u;}
 
@@ -24,4 +26,18 @@ vec3 vec3_divide(vec3 v, vec3 u) {return v / u;}
 
 float vec3_dot(vec3 v, vec3 u) {return dot(v, u);}
 
+vec3 vec3_fma(vec3 v, vec3 u, vec3 w) {return fma(v, u, w);}
+
 vec3 vec3_cross(vec3 v, vec3 u) {return cross(v, u);}
+
+void vec3_lengthArray(const vec3* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 3, false);}
+
+void vec3_lengthArrayFast(const vec3* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 3, true);}
+
+void vec3_normalizeArray(const vec3* in, vec3* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 3, false, false);}
+
+void vec3_normalizeArrayFast(const vec3* in, vec3* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 3, true, false);}
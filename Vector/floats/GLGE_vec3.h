@@ -229,6 +229,19 @@ vec3 vec3_divide(vec3 v, vec3 u);
  */
 float vec3_dot(vec3 v, vec3 u);
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec3 the sum of the product and w
+ */
+vec3 vec3_fma(vec3 v, vec3 u, vec3 w);
+
 /**
  * @brief calculate the cross product of two 3D float vectors
  * 
@@ -238,6 +251,46 @@ float vec3_dot(vec3 v, vec3 u);
  */
 vec3 vec3_cross(vec3 v, vec3 u);
 
+/**
+ * @brief compute the lengths of an array of 3D float vectors
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec3_lengthArray(const vec3* in, float* out, size_t n);
+
+/**
+ * @brief approximate the lengths of an array of 3D float vectors using the fast reciprocal square root
+ * 
+ * The relative error is below 4.5e-7, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec3_lengthArrayFast(const vec3* in, float* out, size_t n);
+
+/**
+ * @brief normalize an array of 3D float vectors
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec3_normalizeArray(const vec3* in, vec3* out, size_t n);
+
+/**
+ * @brief normalize an array of 3D float vectors using the fast reciprocal square root
+ * 
+ * The normalized vectors have a length within 5e-7 of 1, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec3_normalizeArrayFast(const vec3* in, vec3* out, size_t n);
+
 //end a potential C section and add the C++ specific functions
 #if __cplusplus
 }
@@ -252,14 +305,39 @@ vec3 vec3_cross(vec3 v, vec3 u);
 inline std::ostream& operator<<(std::ostream& os, const s_vec3& u) noexcept
 {return os << "(" << u.x << ", " << u.y << ", " << u.z << ")";}
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec3 the sum of the product and w
+ */
+inline vec3 fma(const vec3& v, const vec3& u, const vec3& w) noexcept {
+    return vec3(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y), glge::fma(v.z, u.z, w.z));
+}
+
 /**
  * @brief calculate the dot product of two 2D float vectors
  * 
+ * The fused version is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+ * 
  * @param v the first float vector
  * @param u the second float vector
  * @return const float the dot product of both vectors
  */
+#if GLGE_MATH_ALLOW_FMA
+inline GLGE_MATH_SIMD_CONSTEXPR float dot(const vec3& v, const vec3& u) noexcept {
+    //std::fma can't be evaluated at compile time, so constant evaluation uses the unfused sum
+    if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return v.x * u.x + v.y * u.y + v.z * u.z;}
+    return glge::fma(v.z, u.z, glge::fma(v.y, u.y, v.x * u.x));
+}
+#else
 inline constexpr float dot(const vec3& v, const vec3& u) noexcept {return v.x * u.x + v.y * u.y + v.z * u.z;}
+#endif
 
 /**
  * @brief calculate the cross product between two 3D vectors
@@ -268,23 +346,85 @@ inline constexpr float dot(const vec3& v, const vec3& u) noexcept {return v.x *
  * @param u the second vector
  * @return const vec3 the cross product (vector product) of both vectors
  */
-inline constexpr vec3 cross(const vec3& v, const vec3& u) noexcept {return vec3(v.y*u.z - v.z*u.y, v.x*u.z - v.z*u.x, v.x*u.y - v.y*u.x);}
+inline constexpr vec3 cross(const vec3& v, const vec3& u) noexcept {return vec3(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);}
 
 /**
  * @brief calculate the length of a 3D vector
  * 
+ * @tparam P the precision to use, Fast uses the approximate reciprocal square root (see glge::Precision)
  * @param v a constant reference to the vector to calculate the length of
- * @return constexpr float the length of the vector
+ * @return float the length of the vector
  */
-inline float length(const vec3& v) noexcept {return glge::sqrt(v.x*v.x + v.y*v.y + v.z*v.z);}
+template <glge::Precision P = glge::DefaultPrecision> inline float length(const vec3& v) noexcept {
+    float d = dot(v, v);
+    return (P == glge::Precision::Fast) ? d * glge::rsqrtFast(d) : glge::sqrt(d);
+}
 
 /**
  * @brief calculate a vector that points in the same direction 
  * 
+ * @tparam P the precision to use, Fast multiplies by the approximate reciprocal square root instead of dividing by the length (see glge::Precision)
  * @param v a vector to normalize
  * @return vec3 a vector pointing in the same direction as the input but with a length of 1
  */
-inline vec3 normalize(const vec3& v) noexcept {return v / length(v);}
+template <glge::Precision P = glge::DefaultPrecision> inline vec3 normalize(const vec3& v) noexcept {
+    if (P == glge::Precision::Fast) {return v * glge::rsqrtFast(dot(v, v));}
+    return v / length<glge::Precision::Exact>(v);
+}
+
+/**
+ * @brief compute the lengths of an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of count floats to write the lengths to
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(const vec3* in, float* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec3_lengthArrayFast(in, out, count);}
+    else {vec3_lengthArray(in, out, count);}
+}
+
+/**
+ * @brief normalize an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(const vec3* in, vec3* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec3_normalizeArrayFast(in, out, count);}
+    else {vec3_normalizeArray(in, out, count);}
+}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief compute the lengths of a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors
+ * @param out the span to write the lengths to, only as many elements as both spans hold are computed
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(std::span<const vec3> in, std::span<float> out) noexcept
+{length<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief normalize a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors to normalize
+ * @param out the span to write the normalized vectors to, only as many elements as both spans hold are normalized
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(std::span<const vec3> in, std::span<vec3> out) noexcept
+{normalize<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
 
 #endif
 
@@ -0,0 +1,166 @@
+/**
+ * @file GLGE_vec3SoA.cpp
+ * @author DM8AT
+ * @brief implement the structure of arrays container for 3D float vectors
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the 3D float vector container
+#include "GLGE_vec3SoA.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+//include memcpy and memset
+#include <string.h>
+
+//the amount of floats the capacity of a stream is rounded up to
+#define GLGE_SOA_PADDING (GLGE_MATH_SOA_ALIGNMENT / sizeof(float))
+
+s_vec3SoA::s_vec3SoA(size_t _size) noexcept
+ : s_vec3SoA()
+{vec3SoA_resize(this, _size);}
+
+s_vec3SoA::s_vec3SoA(const vec3* data, size_t count) noexcept
+ : s_vec3SoA()
+{vec3SoA_fromAoS(this, data, count);}
+
+s_vec3SoA::s_vec3SoA(const s_vec3SoA& other) noexcept
+ : s_vec3SoA()
+{*this = other;}
+
+s_vec3SoA::s_vec3SoA(s_vec3SoA&& other) noexcept
+ : s_vec3SoA()
+{*this = ((s_vec3SoA&&)other);}
+
+s_vec3SoA::~s_vec3SoA() noexcept
+{vec3SoA_free(this);}
+
+s_vec3SoA& s_vec3SoA::operator=(const s_vec3SoA& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    if (!vec3SoA_resize(this, other.size)) {return *this;}
+    for (size_t c = 0; c < 3; ++c) 
+    {memcpy(streams[c], other.streams[c], size * sizeof(float));}
+    return *this;
+}
+
+s_vec3SoA& s_vec3SoA::operator=(s_vec3SoA&& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    vec3SoA_free(this);
+    x = other.x; y = other.y; z = other.z;
+    size = other.size;
+    capacity = other.capacity;
+    other.x = NULL; other.y = NULL; other.z = NULL;
+    other.size = 0;
+    other.capacity = 0;
+    return *this;
+}
+
+bool s_vec3SoA::resize(size_t _size) noexcept
+{return vec3SoA_resize(this, _size);}
+
+bool vec3SoA_resize(vec3SoA* soa, size_t size) {
+    //grow the streams if the new size does not fit
+    if (size > soa->capacity) {
+        //at least double the capacity to keep repeated growing cheap and pad it to full registers
+        size_t capacity = (soa->capacity * 2 > size) ? soa->capacity * 2 : size;
+        capacity = (capacity + GLGE_SOA_PADDING - 1) & ~(GLGE_SOA_PADDING - 1);
+        //all streams share a single allocation
+        float* block = (float*)glge_alignedAlloc(capacity * 3 * sizeof(float), GLGE_MATH_SOA_ALIGNMENT);
+        if (!block) {return false;}
+        //copy the old elements and zero the padding
+        for (size_t c = 0; c < 3; ++c) {
+            float* stream = block + c*capacity;
+            if (soa->size) {memcpy(stream, soa->streams[c], soa->size * sizeof(float));}
+            memset(stream + soa->size, 0, (capacity - soa->size) * sizeof(float));
+        }
+        glge_alignedFree(soa->streams[0]);
+        for (size_t c = 0; c < 3; ++c) 
+        {soa->streams[c] = block + c*capacity;}
+        soa->capacity = capacity;
+    }
+    //else, zero the new elements in case a kernel wrote to the padding
+    else if (size > soa->size) {
+        for (size_t c = 0; c < 3; ++c) 
+        {memset(soa->streams[c] + soa->size, 0, (size - soa->size) * sizeof(float));}
+    }
+    soa->size = size;
+    return true;
+}
+
+void vec3SoA_free(vec3SoA* soa) {
+    //all streams share the allocation of the first stream
+    glge_alignedFree(soa->streams[0]);
+    soa->x = NULL;
+    soa->y = NULL;
+    soa->z = NULL;
+    soa->size = 0;
+    soa->capacity = 0;
+}
+
+bool vec3SoA_fromAoS(vec3SoA* soa, const vec3* data, size_t n) {
+    if (!vec3SoA_resize(soa, n)) {return false;}
+    glge::kernel::table().soaFromAoS((const float*)data, soa->streams, 3, n);
+    return true;
+}
+
+void vec3SoA_toAoS(const vec3SoA* soa, vec3* data) 
+{glge::kernel::table().soaToAoS(soa->streams, (float*)data, 3, soa->size);}
+
+vec3 vec3SoA_get(const vec3SoA* soa, size_t i) {return (*soa)[i];}
+
+void vec3SoA_set(vec3SoA* soa, size_t i, vec3 v) {soa->set(i, v);}
+
+/**
+ * @brief get the amount of vectors a function with two inputs processes and resize the output to it
+ * 
+ * @return size_t the amount of vectors to process (0 if the output could not be resized)
+ */
+static size_t vec3SoA_binarySize(const vec3SoA* a, const vec3SoA* b, vec3SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    return vec3SoA_resize(out, n) ? n : 0;
+}
+
+void vec3SoA_add(const vec3SoA* a, const vec3SoA* b, vec3SoA* out) {
+    size_t n = vec3SoA_binarySize(a, b, out);
+    glge::kernel::table().soaAdd(a->streams, b->streams, out->streams, 3, n);
+}
+
+void vec3SoA_subtract(const vec3SoA* a, const vec3SoA* b, vec3SoA* out) {
+    size_t n = vec3SoA_binarySize(a, b, out);
+    glge::kernel::table().soaSubtract(a->streams, b->streams, out->streams, 3, n);
+}
+
+void vec3SoA_multiply(const vec3SoA* a, const vec3SoA* b, vec3SoA* out) {
+    size_t n = vec3SoA_binarySize(a, b, out);
+    glge::kernel::table().soaMultiply(a->streams, b->streams, out->streams, 3, n);
+}
+
+void vec3SoA_fma(const vec3SoA* a, const vec3SoA* b, const vec3SoA* c, vec3SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    n = (n < c->size) ? n : c->size;
+    if (!vec3SoA_resize(out, n)) {return;}
+    glge::kernel::table().soaFma(a->streams, b->streams, c->streams, out->streams, 3, n);
+}
+
+void vec3SoA_dot(const vec3SoA* a, const vec3SoA* b, float* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    glge::kernel::table().soaDot(a->streams, b->streams, out, 3, n);
+}
+
+void vec3SoA_cross(const vec3SoA* a, const vec3SoA* b, vec3SoA* out) {
+    size_t n = vec3SoA_binarySize(a, b, out);
+    glge::kernel::table().soaCross(a->streams, b->streams, out->streams, n);
+}
+
+void vec3SoA_length(const vec3SoA* a, float* out) 
+{glge::kernel::table().soaLength(a->streams, out, 3, a->size);}
+
+void vec3SoA_normalize(const vec3SoA* a, vec3SoA* out) {
+    if (!vec3SoA_resize(out, a->size)) {return;}
+    glge::kernel::table().soaNormalize(a->streams, out->streams, 3, a->size);
+}
@@ -0,0 +1,361 @@
+/**
+ * @file GLGE_vec3SoA.h
+ * @author DM8AT
+ * @brief define a structure of arrays container for 3D float vectors
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_VEC3_SOA_
+#define _GLGE_FLOAT_VEC3_SOA_
+
+//include the 3D float vector for element access and conversion
+#include "GLGE_vec3.h"
+
+// make the C functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store many 3D float vectors as one array per axis (structure of arrays)
+ * 
+ * The streams of all axis are aligned to GLGE_MATH_SOA_ALIGNMENT and padded to a multiple of it, so the batch functions 
+ * process full registers (8 vectors per instruction for AVX2) without any scalar tail. 
+ * In C the container must be zero-initialized before it is used and freed using vec3SoA_free. 
+ */
+typedef struct s_vec3SoA {
+
+    /**
+     * @brief store the streams of the container
+     */
+    union {
+        //store the streams by axis
+        struct {
+            //the x values of all vectors
+            float* x;
+            //the y values of all vectors
+            float* y;
+            //the z values of all vectors
+            float* z;
+        };
+        //store the streams as an array
+        float* streams[3];
+    };
+
+    //the amount of vectors stored in the container
+    size_t size;
+    //the amount of vectors that fit into the streams without a re-allocation
+    size_t capacity;
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new empty vec3SoA
+     */
+    inline constexpr s_vec3SoA() noexcept : x(NULL), y(NULL), z(NULL), size(0), capacity(0) {}
+
+    /**
+     * @brief Construct a new vec3SoA
+     * 
+     * @param _size the amount of vectors to store, all vectors are set to 0
+     */
+    s_vec3SoA(size_t _size) noexcept;
+
+    /**
+     * @brief Construct a new vec3SoA from an array of 3D vectors
+     * 
+     * @param data a constant pointer to the vectors to store
+     * @param count the amount of vectors to store
+     */
+    s_vec3SoA(const vec3* data, size_t count) noexcept;
+
+    /**
+     * @brief Construct a new vec3SoA as a copy of another one
+     * 
+     * @param other the container to copy
+     */
+    s_vec3SoA(const s_vec3SoA& other) noexcept;
+
+    /**
+     * @brief Construct a new vec3SoA by taking the streams of another one
+     * 
+     * @param other the container to take the streams from, it is empty afterwards
+     */
+    s_vec3SoA(s_vec3SoA&& other) noexcept;
+
+    /**
+     * @brief Destroy the vec3SoA
+     */
+    ~s_vec3SoA() noexcept;
+
+    /**
+     * @brief copy another container into this one
+     * 
+     * @param other the container to copy
+     * @return s_vec3SoA& a reference to this container
+     */
+    s_vec3SoA& operator=(const s_vec3SoA& other) noexcept;
+
+    /**
+     * @brief take the streams of another container
+     * 
+     * @param other the container to take the streams from, it is empty afterwards
+     * @return s_vec3SoA& a reference to this container
+     */
+    s_vec3SoA& operator=(s_vec3SoA&& other) noexcept;
+
+    /**
+     * @brief change the amount of stored vectors
+     * 
+     * @param _size the new amount of vectors. New vectors are set to 0
+     * @return true : the container was resized
+     * @return false : the memory for the container could not be allocated, it was not changed
+     */
+    bool resize(size_t _size) noexcept;
+
+    /**
+     * @brief get a single vector from the container
+     * 
+     * @param i the index of the vector
+     * @return vec3 the vector at the index
+     */
+    inline vec3 operator[](size_t i) const noexcept {return vec3(x[i], y[i], z[i]);}
+
+    /**
+     * @brief set a single vector in the container
+     * 
+     * @param i the index of the vector
+     * @param v the new value for the vector
+     */
+    inline void set(size_t i, const vec3& v) noexcept {x[i] = v.x; y[i] = v.y; z[i] = v.z;}
+
+    #endif
+
+} vec3SoA;
+
+/**
+ * @brief change the amount of vectors stored in a container
+ * 
+ * @param soa a pointer to the container to resize
+ * @param size the new amount of vectors. New vectors are set to 0
+ * @return true : the container was resized
+ * @return false : the memory for the container could not be allocated, it was not changed
+ */
+bool vec3SoA_resize(vec3SoA* soa, size_t size);
+
+/**
+ * @brief free the memory of a container, it is empty afterwards
+ * 
+ * @param soa a pointer to the container to free
+ */
+void vec3SoA_free(vec3SoA* soa);
+
+/**
+ * @brief fill a container from an array of 3D vectors
+ * 
+ * @param soa a pointer to the container to fill
+ * @param data a constant pointer to the vectors to store
+ * @param n the amount of vectors to store
+ * @return true : the container was filled
+ * @return false : the memory for the container could not be allocated, it was not changed
+ */
+bool vec3SoA_fromAoS(vec3SoA* soa, const vec3* data, size_t n);
+
+/**
+ * @brief write all vectors of a container to an array of 3D vectors
+ * 
+ * @param soa a constant pointer to the container to read from
+ * @param data a pointer to an array with space for soa->size vectors
+ */
+void vec3SoA_toAoS(const vec3SoA* soa, vec3* data);
+
+/**
+ * @brief get a single vector from a container
+ * 
+ * @param soa a constant pointer to the container
+ * @param i the index of the vector
+ * @return vec3 the vector at the index
+ */
+vec3 vec3SoA_get(const vec3SoA* soa, size_t i);
+
+/**
+ * @brief set a single vector in a container
+ * 
+ * @param soa a pointer to the container
+ * @param i the index of the vector
+ * @param v the new value for the vector
+ */
+void vec3SoA_set(vec3SoA* soa, size_t i, vec3 v);
+
+/**
+ * @brief add the vectors of two containers together
+ * 
+ * Only as many vectors as both containers hold are processed, the output is resized to that amount
+ * 
+ * @param a a constant pointer to the first container
+ * @param b a constant pointer to the second container
+ * @param out a pointer to the container to write the sums to (may be a or b)
+ */
+void vec3SoA_add(const vec3SoA* a, const vec3SoA* b, vec3SoA* out);
+
+/**
+ * @brief subtract the vectors of two containers
+ * 
+ * Only as many vectors as both containers hold are processed, the output is resized to that amount
+ * 
+ * @param a a constant pointer to the container to subtract from
+ * @param b a constant pointer to the container to subtract
+ * @param out a pointer to the container to write the differences to (may be a or b)
+ */
+void vec3SoA_subtract(const vec3SoA* a, const vec3SoA* b, vec3SoA* out);
+
+/**
+ * @brief multiply the vectors of two containers element wise
+ * 
+ * Only as many vectors as both containers hold are processed, the output is resized to that amount
+ * 
+ * @param a a constant pointer to the first container
+ * @param b a constant pointer to the second container
+ * @param out a pointer to the container to write the products to (may be a or b)
+ */
+void vec3SoA_multiply(const vec3SoA* a, const vec3SoA* b, vec3SoA* out);
+
+/**
+ * @brief compute a * b + c for the vectors of three containers
+ * 
+ * A single rounding (fused multiply-add) is used if AVX2 is enabled
+ * Only as many vectors as all containers hold are processed, the output is resized to that amount
+ * 
+ * @param a a constant pointer to the first factor
+ * @param b a constant pointer to the second factor
+ * @param c a constant pointer to the summand
+ * @param out a pointer to the container to write the results to (may be a, b or c)
+ */
+void vec3SoA_fma(const vec3SoA* a, const vec3SoA* b, const vec3SoA* c, vec3SoA* out);
+
+/**
+ * @brief calculate the dot products of the vectors of two containers
+ * 
+ * @param a a constant pointer to the first container
+ * @param b a constant pointer to the second container
+ * @param out a pointer to an array with space for as many floats as both containers hold vectors
+ */
+void vec3SoA_dot(const vec3SoA* a, const vec3SoA* b, float* out);
+
+/**
+ * @brief calculate the cross products of the vectors of two containers
+ * 
+ * @param a a constant pointer to the first container
+ * @param b a constant pointer to the second container
+ * @param out a pointer to the container to write the cross products to (may be a or b)
+ */
+void vec3SoA_cross(const vec3SoA* a, const vec3SoA* b, vec3SoA* out);
+
+/**
+ * @brief calculate the lengths of the vectors of a container
+ * 
+ * @param a a constant pointer to the container
+ * @param out a pointer to an array with space for a->size floats
+ */
+void vec3SoA_length(const vec3SoA* a, float* out);
+
+/**
+ * @brief normalize all vectors of a container
+ * 
+ * @param a a constant pointer to the container
+ * @param out a pointer to the container to write the normalized vectors to (may be a)
+ */
+void vec3SoA_normalize(const vec3SoA* a, vec3SoA* out);
+
+//end a potential C section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief add the vectors of two containers together
+ * 
+ * @param a the first container
+ * @param b the second container
+ * @return vec3SoA a container holding the sums
+ */
+inline vec3SoA operator+(const vec3SoA& a, const vec3SoA& b) noexcept
+{vec3SoA out; vec3SoA_add(&a, &b, &out); return out;}
+
+/**
+ * @brief subtract the vectors of two containers
+ * 
+ * @param a the container to subtract from
+ * @param b the container to subtract
+ * @return vec3SoA a container holding the differences
+ */
+inline vec3SoA operator-(const vec3SoA& a, const vec3SoA& b) noexcept
+{vec3SoA out; vec3SoA_subtract(&a, &b, &out); return out;}
+
+/**
+ * @brief multiply the vectors of two containers element wise
+ * 
+ * @param a the first container
+ * @param b the second container
+ * @return vec3SoA a container holding the products
+ */
+inline vec3SoA operator*(const vec3SoA& a, const vec3SoA& b) noexcept
+{vec3SoA out; vec3SoA_multiply(&a, &b, &out); return out;}
+
+/**
+ * @brief compute a * b + c for the vectors of three containers
+ * 
+ * @param a the first factor
+ * @param b the second factor
+ * @param c the summand
+ * @return vec3SoA a container holding the results
+ */
+inline vec3SoA fma(const vec3SoA& a, const vec3SoA& b, const vec3SoA& c) noexcept
+{vec3SoA out; vec3SoA_fma(&a, &b, &c, &out); return out;}
+
+/**
+ * @brief calculate the dot products of the vectors of two containers
+ * 
+ * @param a the first container
+ * @param b the second container
+ * @param out a pointer to an array with space for as many floats as both containers hold vectors
+ */
+inline void dot(const vec3SoA& a, const vec3SoA& b, float* out) noexcept
+{vec3SoA_dot(&a, &b, out);}
+
+/**
+ * @brief calculate the cross products of the vectors of two containers
+ * 
+ * @param a the first container
+ * @param b the second container
+ * @return vec3SoA a container holding the cross products
+ */
+inline vec3SoA cross(const vec3SoA& a, const vec3SoA& b) noexcept
+{vec3SoA out; vec3SoA_cross(&a, &b, &out); return out;}
+
+/**
+ * @brief calculate the lengths of the vectors of a container
+ * 
+ * @param a the container
+ * @param out a pointer to an array with space for a.size floats
+ */
+inline void length(const vec3SoA& a, float* out) noexcept
+{vec3SoA_length(&a, out);}
+
+/**
+ * @brief normalize all vectors of a container
+ * 
+ * @param a the container
+ * @return vec3SoA a container holding the normalized vectors
+ */
+inline vec3SoA normalize(const vec3SoA& a) noexcept
+{vec3SoA out; vec3SoA_normalize(&a, &out); return out;}
+
+#endif
+
+#endif
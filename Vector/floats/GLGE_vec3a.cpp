@@ -0,0 +1,80 @@
+/**
+ * @file GLGE_vec3a.cpp
+ * @author DM8AT
+ * @brief implement the C binding for the padded 3D float vector
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the padded 3D float vector
+#include "GLGE_vec3a.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+
+vec3a vec3a_add(vec3a v, vec3a u) {return v + u;}
+
+vec3a vec3a_subtract(vec3a v, vec3a u) {return v - u;}
+
+vec3a vec3a_negate(vec3a v) {return -v;}
+
+vec3a vec3a_multiply(vec3a v, vec3a u) {return v * u;}
+
+vec3a vec3a_divide(vec3a v, vec3a u) {return v / u;}
+
+float vec3a_dot(vec3a v, vec3a u) {return dot(v, u);}
+
+vec3a vec3a_fma(vec3a v, vec3a u, vec3a w) {return fma(v, u, w);}
+
+vec3a vec3a_cross(vec3a v, vec3a u) {return cross(v, u);}
+
+float vec3a_length(vec3a v) {return length<glge::Precision::Exact>(v);}
+
+vec3a vec3a_normalize(vec3a v) {return normalize<glge::Precision::Exact>(v);}
+
+float vec3a_lengthFast(vec3a v) {return length<glge::Precision::Fast>(v);}
+
+vec3a vec3a_normalizeFast(vec3a v) {return normalize<glge::Precision::Fast>(v);}
+
+vec3a vec3a_fromVec3(vec3 v) {return vec3a(v);}
+
+vec3 vec3a_toVec3(vec3a v) {return v.toVec3();}
+
+void vec3a_unpackArray(const vec3* in, vec3a* out, size_t n) {
+    size_t i = 0;
+    #if GLGE_MATH_USE_SIMD
+    //load 4 floats and clear the one that belongs to the next vector, the last vector is converted on its own so nothing
+    //behind the input is read
+    const __m128 mask = vec3a::hiddenMask();
+    for (; i + 1 < n; ++i)
+    {out[i].simd = _mm_and_ps(_mm_loadu_ps(in[i].vals), mask);}
+    #endif
+    for (; i < n; ++i)
+    {out[i] = vec3a(in[i]);}
+}
+
+void vec3a_packArray(const vec3a* in, vec3* out, size_t n) {
+    size_t i = 0;
+    #if GLGE_MATH_USE_SIMD
+    //store all 4 floats, the hidden element is overwritten by the next vector. The last vector is stored on its own so 
+    //nothing behind the output is written
+    for (; i + 1 < n; ++i)
+    {_mm_storeu_ps(out[i].vals, in[i].simd);}
+    #endif
+    for (; i < n; ++i)
+    {out[i] = in[i].toVec3();}
+}
+
+void vec3a_lengthArray(const vec3a* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 4, false);}
+
+void vec3a_lengthArrayFast(const vec3a* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 4, true);}
+
+void vec3a_normalizeArray(const vec3a* in, vec3a* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 4, false, true);}
+
+void vec3a_normalizeArrayFast(const vec3a* in, vec3a* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 4, true, true);}
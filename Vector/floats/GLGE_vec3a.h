@@ -0,0 +1,656 @@
+/**
+ * @file GLGE_vec3a.h
+ * @author DM8AT
+ * @brief define an interface for 3D float vectors that are padded to 16 bytes
+ * 
+ * vec3 is only 12 bytes large, so it does not fit to an SSE register. vec3a stores a hidden fourth element, this way the
+ * vector is one SSE register and all operations are done with SIMD. The hidden element is always 0 and is ignored by the
+ * dot product, the length and all other reductions, so every function returns exactly the same values as the vec3 version
+ * as long as both are compiled with the same GLGE_MATH_ALLOW_FMA and the compiler does not contract the multiplications and
+ * additions of the vec3 code into fused multiply-adds on its own (-ffp-contract=off, the library itself is compiled this way).
+ * Use vec3 to store or upload large amounts of vectors and vec3a to compute with them, the array conversions between
+ * both are cheap.
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_VEC3A_
+#define _GLGE_FLOAT_VEC3A_
+
+//include the tight 3D vector for the conversions
+#include "GLGE_vec3.h"
+
+//if SIMD is requested, include SIMD intrinsics
+#include "../../GLGEMath_Settings.h"
+#if GLGE_MATH_USE_SIMD
+#include <xmmintrin.h>
+#endif
+
+// make the C functions available for C
+#if __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief store a 3D vector of floats padded to 16 bytes (aligned to 16 bytes if SIMD is enabled)
+ */
+typedef struct s_vec3a {
+
+    /**
+     * @brief store the actual data for the vector
+     */
+    union {
+        //store the values for all axis
+        struct {
+            float x;
+            float y;
+            float z;
+            //the hidden element, it is always 0
+            float pad;
+        };
+        //store the values for colors
+        struct {
+            float r;
+            float g;
+            float b;
+        };
+        //store the values as a float vector
+        float vals[3];
+
+        //only add the SIMD stuff if SIMD is enabled
+        #if GLGE_MATH_USE_SIMD
+        //store the values for SIMD processing
+        __m128 simd;
+        #endif
+    };
+
+    //for C++ add all member functions
+    #if __cplusplus
+
+    /**
+     * @brief Construct a new vec3a
+     * 
+     */
+    inline constexpr s_vec3a() : x(0), y(0), z(0), pad(0) {}
+
+    /**
+     * @brief Construct a new vec3a
+     * 
+     * @param _x the value for the x axis / red channel
+     * @param _y the value for the y axis / green channel
+     * @param _z the value for the z axis / blue channel
+     */
+    inline constexpr s_vec3a(float _x, float _y, float _z) : x(_x), y(_y), z(_z), pad(0) {}
+
+    /**
+     * @brief Construct a new vec3a
+     * 
+     * @param xyz the value for the x, y and z axis as well as for the red, green and blue channel
+     */
+    inline constexpr s_vec3a(float xyz) : x(xyz), y(xyz), z(xyz), pad(0) {}
+
+    /**
+     * @brief Construct a new vec3a
+     * 
+     * @param xy the values for the x and y axis / red and green channel
+     * @param _z the value for the z axis / blue channel
+     */
+    inline constexpr s_vec3a(const vec2& xy, float _z) : x(xy.x), y(xy.y), z(_z), pad(0) {}
+
+    /**
+     * @brief Construct a new vec3a from a tight 3D vector
+     * 
+     * @param v the vector to pad
+     */
+    inline constexpr s_vec3a(const vec3& v) : x(v.x), y(v.y), z(v.z), pad(0) {}
+
+    //only implement the SIMD constructor if SIMD is enabled
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief Construct a new vec3a
+     * 
+     * @param _simd the values for the simd processing, the last element must be 0
+     */
+    inline constexpr s_vec3a(const __m128& _simd) : simd(_simd) {}
+
+    #endif
+
+    /**
+     * @brief convert the vector to a tight 3D vector
+     * 
+     * @return vec3 the vector without the hidden element
+     */
+    inline constexpr vec3 toVec3() const noexcept
+    {return vec3(x, y, z);}
+
+    //implement the SIMD operators
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief add two 3D float vectors together
+     * 
+     * @param u the second vector to add to this one
+     * @return const s_vec3a the sum of both vectors
+     */
+    inline s_vec3a operator+(const s_vec3a& u) const noexcept
+    {return _mm_add_ps(simd, u.simd);}
+
+    /**
+     * @brief subtract two 3D float vectors
+     * 
+     * @param u the vector to subtract from this one
+     * @return const s_vec3a the difference of both vectors
+     */
+    inline s_vec3a operator-(const s_vec3a& u) const noexcept
+    {return _mm_sub_ps(simd, u.simd);}
+
+    /**
+     * @brief multiply two 3D float vectors together
+     * 
+     * @param u the vector to multiply to this one
+     * @return s_vec3a the product of both vectors
+     */
+    inline s_vec3a operator*(const s_vec3a& u) const noexcept
+    {return _mm_mul_ps(simd, u.simd);}
+
+    /**
+     * @brief divide one vector by another
+     * 
+     * @param u the vector to use as the denominator
+     * @return s_vec3a the fraction of both vectors
+     */
+    inline s_vec3a operator/(const s_vec3a& u) const noexcept
+    {return _mm_and_ps(_mm_div_ps(simd, u.simd), hiddenMask());}
+
+    /**
+     * @brief negate a 3D float vector
+     * 
+     * @return s_vec3a the negated vector
+     */
+    inline s_vec3a operator-(void) const noexcept
+    {return _mm_xor_ps(simd, _mm_setr_ps(-0.f, -0.f, -0.f, 0.f));}
+
+    #else //else, implement the not simd operators
+
+    /**
+     * @brief add two 3D float vectors together
+     * 
+     * @param u the second vector to add to this one
+     * @return const s_vec3a the sum of both vectors
+     */
+    inline constexpr s_vec3a operator+(const s_vec3a& u) const noexcept
+    {return s_vec3a(x + u.x, y + u.y, z + u.z);}
+
+    /**
+     * @brief subtract two 3D float vectors
+     * 
+     * @param u the vector to subtract from this one
+     * @return const s_vec3a the difference of both vectors
+     */
+    inline constexpr s_vec3a operator-(const s_vec3a& u) const noexcept
+    {return s_vec3a(x - u.x, y - u.y, z - u.z);}
+
+    /**
+     * @brief multiply two 3D float vectors together
+     * 
+     * @param u the vector to multiply to this one
+     * @return s_vec3a the product of both vectors
+     */
+    inline constexpr s_vec3a operator*(const s_vec3a& u) const noexcept
+    {return s_vec3a(x * u.x, y * u.y, z * u.z);}
+
+    /**
+     * @brief divide one vector by another
+     * 
+     * @param u the vector to use as the denominator
+     * @return s_vec3a the fraction of both vectors
+     */
+    inline constexpr s_vec3a operator/(const s_vec3a& u) const noexcept
+    {return s_vec3a(x / u.x, y / u.y, z / u.z);}
+
+    /**
+     * @brief negate a 3D float vector
+     * 
+     * @return s_vec3a the negated vector
+     */
+    inline constexpr s_vec3a operator-(void) const noexcept
+    {return s_vec3a(-x, -y, -z);}
+
+    #endif
+
+    /**
+     * @brief add another vector to this one
+     * 
+     * @param u the vector to add to this one
+     */
+    inline void operator+=(const s_vec3a& u) noexcept
+    {*this = *this + u;}
+
+    /**
+     * @brief subtract another vector from this one
+     * 
+     * @param u the vector to subtract from this one
+     */
+    inline void operator-=(const s_vec3a& u) noexcept
+    {*this = *this - u;}
+
+    /**
+     * @brief scale this vector by another vector
+     * 
+     * @param u the vector to scale this one with
+     */
+    inline void operator*=(const s_vec3a& u) noexcept
+    {*this = *this * u;}
+
+    /**
+     * @brief scale down this vector by another vector
+     * 
+     * @param u the vector to scale down this one with
+     */
+    inline void operator/=(const s_vec3a& u) noexcept
+    {*this = *this / u;}
+
+    //only add the SIMD helpers if SIMD is enabled
+    #if GLGE_MATH_USE_SIMD
+
+    /**
+     * @brief get a mask that keeps the three elements and clears the hidden element
+     * 
+     * @return __m128 the mask
+     */
+    static inline __m128 hiddenMask() noexcept
+    {return _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));}
+
+    #endif
+
+    #endif
+
+} vec3a;
+
+/**
+ * @brief add two padded 3D float vectors together
+ * 
+ * @param v the first vector
+ * @param u the second vector
+ * @return vec3a the sum of both vectors
+ */
+vec3a vec3a_add(vec3a v, vec3a u);
+
+/**
+ * @brief subtract two padded 3D float vectors
+ * 
+ * @param v the vector to subtract from
+ * @param u the vector to subtract from the other vector
+ * @return vec3a the difference of both vectors
+ */
+vec3a vec3a_subtract(vec3a v, vec3a u);
+
+/**
+ * @brief negate a padded 3D vector
+ * 
+ * @param v the vector to negate
+ * @return vec3a the negated vector
+ */
+vec3a vec3a_negate(vec3a v);
+
+/**
+ * @brief multiply two padded 3D float vectors together
+ * 
+ * @param v the first vector to multiply with
+ * @param u the second vector to multiply with
+ * @return vec3a the product of two vectors
+ */
+vec3a vec3a_multiply(vec3a v, vec3a u);
+
+/**
+ * @brief divide two padded 3D float vectors
+ * 
+ * @param v the 3D vector to use as nominator
+ * @param u the 3D vector to use as denominator
+ * @return vec3a the fraction of both vectors
+ */
+vec3a vec3a_divide(vec3a v, vec3a u);
+
+/**
+ * @brief calculate the dot product of two padded 3D float vectors
+ * 
+ * @param v the first vector
+ * @param u the second vector
+ * @return float the dot product of two 3D float vectors
+ */
+float vec3a_dot(vec3a v, vec3a u);
+
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h),
+ * else they are rounded on their own.
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec3a the sum of the product and w
+ */
+vec3a vec3a_fma(vec3a v, vec3a u, vec3a w);
+
+/**
+ * @brief calculate the cross product of two padded 3D float vectors
+ * 
+ * @param v the first vector
+ * @param u the second vector
+ * @return vec3a a vector perpendicular to the inputted vectors (or (0,0,0) if both vectors are congruential)
+ */
+vec3a vec3a_cross(vec3a v, vec3a u);
+
+/**
+ * @brief calculate the length of a padded 3D float vector
+ * 
+ * @param v the vector to calculate the length of
+ * @return float the length of the vector
+ */
+float vec3a_length(vec3a v);
+
+/**
+ * @brief calculate a vector that points in the same direction but has a length of 1
+ * 
+ * @param v the vector to normalize
+ * @return vec3a the normalized vector
+ */
+vec3a vec3a_normalize(vec3a v);
+
+/**
+ * @brief approximate the length of a padded 3D float vector using the fast reciprocal square root
+ * 
+ * The relative error is below 4.5e-7, see glge::Precision::Fast
+ * 
+ * @param v the vector to calculate the length of
+ * @return float the length of the vector
+ */
+float vec3a_lengthFast(vec3a v);
+
+/**
+ * @brief normalize a padded 3D float vector using the fast reciprocal square root
+ * 
+ * The normalized vector has a length within 5e-7 of 1, see glge::Precision::Fast
+ * 
+ * @param v the vector to normalize
+ * @return vec3a the normalized vector
+ */
+vec3a vec3a_normalizeFast(vec3a v);
+
+/**
+ * @brief pad a tight 3D float vector
+ * 
+ * @param v the vector to pad
+ * @return vec3a the padded vector
+ */
+vec3a vec3a_fromVec3(vec3 v);
+
+/**
+ * @brief remove the padding of a padded 3D float vector
+ * 
+ * @param v the vector to convert
+ * @return vec3 the tight vector
+ */
+vec3 vec3a_toVec3(vec3a v);
+
+/**
+ * @brief convert an array of tight 3D vectors to padded 3D vectors
+ * 
+ * @param in a constant pointer to the tight vectors
+ * @param out a pointer to write the padded vectors to (must not overlap with in)
+ * @param n the amount of vectors to convert
+ */
+void vec3a_unpackArray(const vec3* in, vec3a* out, size_t n);
+
+/**
+ * @brief convert an array of padded 3D vectors to tight 3D vectors, for example to store or upload them
+ * 
+ * @param in a constant pointer to the padded vectors
+ * @param out a pointer to write the tight vectors to (must not overlap with in)
+ * @param n the amount of vectors to convert
+ */
+void vec3a_packArray(const vec3a* in, vec3* out, size_t n);
+
+/**
+ * @brief compute the lengths of an array of padded 3D float vectors
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec3a_lengthArray(const vec3a* in, float* out, size_t n);
+
+/**
+ * @brief approximate the lengths of an array of padded 3D float vectors using the fast reciprocal square root
+ * 
+ * The relative error is below 4.5e-7, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec3a_lengthArrayFast(const vec3a* in, float* out, size_t n);
+
+/**
+ * @brief normalize an array of padded 3D float vectors
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec3a_normalizeArray(const vec3a* in, vec3a* out, size_t n);
+
+/**
+ * @brief normalize an array of padded 3D float vectors using the fast reciprocal square root
+ * 
+ * The normalized vectors have a length within 5e-7 of 1, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec3a_normalizeArrayFast(const vec3a* in, vec3a* out, size_t n);
+
+//end a potential C section and add the C++ specific functions
+#if __cplusplus
+}
+
+/**
+ * @brief print a padded 3D vector into an output stream
+ * 
+ * @param os the output output stream to fill
+ * @param u the 3D float vector to put into the output stream
+ * @return std::ostream& the filled output stream
+ */
+inline std::ostream& operator<<(std::ostream& os, const s_vec3a& u) noexcept
+{return os << "(" << u.x << ", " << u.y << ", " << u.z << ")";}
+
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h),
+ * else they are rounded on their own.
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec3a the sum of the product and w
+ */
+inline vec3a fma(const vec3a& v, const vec3a& u, const vec3a& w) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_FMA
+    return _mm_fmadd_ps(v.simd, u.simd, w.simd);
+    #else
+    return _mm_add_ps(_mm_mul_ps(v.simd, u.simd), w.simd);
+    #endif
+    #else
+    return vec3a(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y), glge::fma(v.z, u.z, w.z));
+    #endif
+}
+
+/**
+ * @brief calculate the dot product of two padded 3D float vectors
+ * 
+ * The products are summed up in the same order as the dot product of vec3, so both return exactly the same value if the
+ * vec3 version is not contracted by the compiler (see the description of this file).
+ * 
+ * @param v the first float vector
+ * @param u the second float vector
+ * @return float the dot product of both vectors
+ */
+inline float dot(const vec3a& v, const vec3a& u) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_FMA
+    //fuse the y and z products into the sum like the scalar version
+    __m128 r = _mm_mul_ss(v.simd, u.simd);
+    r = _mm_fmadd_ss(_mm_shuffle_ps(v.simd, v.simd, _MM_SHUFFLE(1,1,1,1)), _mm_shuffle_ps(u.simd, u.simd, _MM_SHUFFLE(1,1,1,1)), r);
+    r = _mm_fmadd_ss(_mm_shuffle_ps(v.simd, v.simd, _MM_SHUFFLE(2,2,2,2)), _mm_shuffle_ps(u.simd, u.simd, _MM_SHUFFLE(2,2,2,2)), r);
+    #else
+    //multiply all elements at once, then sum up the x, y and z lane
+    __m128 p = _mm_mul_ps(v.simd, u.simd);
+    __m128 r = _mm_add_ss(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(1,1,1,1)));
+    r = _mm_add_ss(r, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2,2,2,2)));
+    #endif
+    return _mm_cvtss_f32(r);
+    #else
+    return dot(vec3(v.x, v.y, v.z), vec3(u.x, u.y, u.z));
+    #endif
+}
+
+/**
+ * @brief calculate the cross product between two padded 3D vectors
+ * 
+ * @param v the first vector
+ * @param u the second vector
+ * @return vec3a the cross product (vector product) of both vectors
+ */
+inline vec3a cross(const vec3a& v, const vec3a& u) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    //v * u.yzx - v.yzx * u computes the cross product in the order z, x, y. The hidden elements cancel out to 0
+    __m128 c = _mm_sub_ps(_mm_mul_ps(v.simd, _mm_shuffle_ps(u.simd, u.simd, _MM_SHUFFLE(3,0,2,1))),
+                          _mm_mul_ps(_mm_shuffle_ps(v.simd, v.simd, _MM_SHUFFLE(3,0,2,1)), u.simd));
+    return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3,0,2,1));
+    #else
+    return vec3a(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);
+    #endif
+}
+
+/**
+ * @brief calculate the length of a padded 3D vector
+ * 
+ * @tparam P the precision to use, Fast uses the approximate reciprocal square root (see glge::Precision)
+ * @param v a constant reference to the vector to calculate the length of
+ * @return float the length of the vector
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline float length(const vec3a& v) noexcept {
+    float d = dot(v, v);
+    if (P == glge::Precision::Fast) {return d * glge::rsqrtFast(d);}
+    #if GLGE_MATH_USE_SIMD
+    return _mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(d)));
+    #else
+    return glge::sqrt(d);
+    #endif
+}
+
+/**
+ * @brief calculate a vector that points in the same direction
+ * 
+ * @tparam P the precision to use, Fast multiplies by the approximate reciprocal square root instead of dividing by the length (see glge::Precision)
+ * @param v a vector to normalize
+ * @return vec3a a vector pointing in the same direction as the input but with a length of 1
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline vec3a normalize(const vec3a& v) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    if (P == glge::Precision::Fast) {return _mm_mul_ps(v.simd, glge::rsqrtFast(_mm_set1_ps(dot(v, v))));}
+    //the division clears the hidden element, a length of 0 would make it 0 / 0
+    return v / vec3a(length<glge::Precision::Exact>(v));
+    #else
+    if (P == glge::Precision::Fast) {return v * vec3a(glge::rsqrtFast(dot(v, v)));}
+    return v / vec3a(length<glge::Precision::Exact>(v));
+    #endif
+}
+
+/**
+ * @brief compute the lengths of an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of count floats to write the lengths to
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(const vec3a* in, float* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec3a_lengthArrayFast(in, out, count);}
+    else {vec3a_lengthArray(in, out, count);}
+}
+
+/**
+ * @brief normalize an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(const vec3a* in, vec3a* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec3a_normalizeArrayFast(in, out, count);}
+    else {vec3a_normalizeArray(in, out, count);}
+}
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief compute the lengths of a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors
+ * @param out the span to write the lengths to, only as many elements as both spans hold are computed
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(std::span<const vec3a> in, std::span<float> out) noexcept
+{length<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief normalize a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors to normalize
+ * @param out the span to write the normalized vectors to, only as many elements as both spans hold are normalized
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(std::span<const vec3a> in, std::span<vec3a> out) noexcept
+{normalize<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
+
+/**
+ * @brief convert an array of tight 3D vectors to padded 3D vectors
+ * 
+ * @param in a constant pointer to the tight vectors
+ * @param out a pointer to write the padded vectors to (must not overlap with in)
+ * @param count the amount of vectors to convert
+ */
+inline void unpack(const vec3* in, vec3a* out, size_t count) noexcept
+{vec3a_unpackArray(in, out, count);}
+
+/**
+ * @brief convert an array of padded 3D vectors to tight 3D vectors
+ * 
+ * @param in a constant pointer to the padded vectors
+ * @param out a pointer to write the tight vectors to (must not overlap with in)
+ * @param count the amount of vectors to convert
+ */
+inline void pack(const vec3a* in, vec3* out, size_t count) noexcept
+{vec3a_packArray(in, out, count);}
+
+#endif
+
+#endif
@@ -0,0 +1,249 @@
+/**
+ * @file GLGE_vec3x8.hpp
+ * @author DM8AT
+ * @brief define a C++ only wide 3D float vector that holds 8 vectors transposed (one wide float per axis)
+ * 
+ * The wide vector is meant for AoSoA (array of structures of arrays) programming: a loop processes 8 vectors per iteration 
+ * using the same operators and functions as for a single vec3. 
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_VEC3_X8_
+#define _GLGE_FLOAT_VEC3_X8_
+
+//only available for C++
+#if __cplusplus
+
+//include the float 3D vector
+#include "GLGE_vec3.h"
+//include the wide float
+#include "GLGE_float8.hpp"
+//include the packs to convert from and to interleaved vectors
+#include "../../Kernels/GLGE_KernelPack.hpp"
+
+/**
+ * @brief store 8 3D float vectors with one wide float per axis
+ */
+typedef struct s_vec3x8 {
+
+    //the x values of all lanes
+    float8 x;
+    //the y values of all lanes
+    float8 y;
+    //the z values of all lanes
+    float8 z;
+
+    /**
+     * @brief Construct a new vec3x8
+     * all lanes are 0
+     */
+    inline s_vec3x8() noexcept {}
+
+    /**
+     * @brief Construct a new vec3x8
+     * 
+     * @param _x the values for the x axis
+     * @param _y the values for the y axis
+     * @param _z the values for the z axis
+     */
+    inline s_vec3x8(const float8& _x, const float8& _y, const float8& _z) noexcept : x(_x), y(_y), z(_z) {}
+
+    /**
+     * @brief Construct a new vec3x8
+     * 
+     * @param v the vector to store in all lanes
+     */
+    inline s_vec3x8(const vec3& v) noexcept : x(v.x), y(v.y), z(v.z) {}
+
+    /**
+     * @brief load 8 vectors from an array of 3D vectors
+     * 
+     * @param p a pointer to the 8 vectors
+     * @return s_vec3x8 the wide vector holding the 8 vectors
+     */
+    static inline s_vec3x8 load(const vec3* p) noexcept {
+        s_vec3x8 r;
+        //the pack width depends on the instruction set, so the vectors are converted one pack at a time
+        for (size_t k = 0; k < 8; k += glge::kernel::Pack::Width) {
+            glge::kernel::Pack px, py, pz;
+            glge::kernel::loadInterleaved(p[k].vals, px, py, pz);
+            glge::kernel::store(r.x.vals + k, px);
+            glge::kernel::store(r.y.vals + k, py);
+            glge::kernel::store(r.z.vals + k, pz);
+        }
+        return r;
+    }
+
+    /**
+     * @brief store the 8 vectors to an array of 3D vectors
+     * 
+     * @param p a pointer to write the 8 vectors to
+     */
+    inline void store(vec3* p) const noexcept {
+        for (size_t k = 0; k < 8; k += glge::kernel::Pack::Width) {
+            glge::kernel::storeInterleaved(p[k].vals, glge::kernel::load(x.vals + k), glge::kernel::load(y.vals + k), glge::kernel::load(z.vals + k));
+        }
+    }
+
+    /**
+     * @brief get a single vector
+     * 
+     * @param i the index of the lane
+     * @return vec3 the vector stored in the lane
+     */
+    inline vec3 operator[](int i) const noexcept {return vec3(x.vals[i], y.vals[i], z.vals[i]);}
+
+    /**
+     * @brief set a single vector
+     * 
+     * @param i the index of the lane
+     * @param v the new vector for the lane
+     */
+    inline void set(int i, const vec3& v) noexcept {x.vals[i] = v.x; y.vals[i] = v.y; z.vals[i] = v.z;}
+
+    /**
+     * @brief add and assign another wide vector to this one
+     */
+    inline s_vec3x8& operator+=(const s_vec3x8& u) noexcept {x += u.x; y += u.y; z += u.z; return *this;}
+
+    /**
+     * @brief subtract and assign another wide vector from this one
+     */
+    inline s_vec3x8& operator-=(const s_vec3x8& u) noexcept {x -= u.x; y -= u.y; z -= u.z; return *this;}
+
+    /**
+     * @brief multiply and assign another wide vector to this one
+     */
+    inline s_vec3x8& operator*=(const s_vec3x8& u) noexcept {x *= u.x; y *= u.y; z *= u.z; return *this;}
+
+    /**
+     * @brief divide this wide vector by another one
+     */
+    inline s_vec3x8& operator/=(const s_vec3x8& u) noexcept {x /= u.x; y /= u.y; z /= u.z; return *this;}
+
+    /**
+     * @brief multiply all axis with a wide float
+     */
+    inline s_vec3x8& operator*=(const float8& f) noexcept {x *= f; y *= f; z *= f; return *this;}
+
+    /**
+     * @brief divide all axis by a wide float
+     */
+    inline s_vec3x8& operator/=(const float8& f) noexcept {x /= f; y /= f; z /= f; return *this;}
+
+} vec3x8;
+
+/**
+ * @brief add two wide 3D vectors together
+ */
+inline vec3x8 operator+(const vec3x8& v, const vec3x8& u) noexcept {return vec3x8(v.x + u.x, v.y + u.y, v.z + u.z);}
+
+/**
+ * @brief subtract two wide 3D vectors
+ */
+inline vec3x8 operator-(const vec3x8& v, const vec3x8& u) noexcept {return vec3x8(v.x - u.x, v.y - u.y, v.z - u.z);}
+
+/**
+ * @brief multiply two wide 3D vectors together
+ */
+inline vec3x8 operator*(const vec3x8& v, const vec3x8& u) noexcept {return vec3x8(v.x * u.x, v.y * u.y, v.z * u.z);}
+
+/**
+ * @brief divide two wide 3D vectors
+ */
+inline vec3x8 operator/(const vec3x8& v, const vec3x8& u) noexcept {return vec3x8(v.x / u.x, v.y / u.y, v.z / u.z);}
+
+/**
+ * @brief scale a wide 3D vector
+ */
+inline vec3x8 operator*(const vec3x8& v, const float8& f) noexcept {return vec3x8(v.x * f, v.y * f, v.z * f);}
+
+/**
+ * @brief scale a wide 3D vector
+ */
+inline vec3x8 operator*(const float8& f, const vec3x8& v) noexcept {return vec3x8(f * v.x, f * v.y, f * v.z);}
+
+/**
+ * @brief divide a wide 3D vector by a wide float
+ */
+inline vec3x8 operator/(const vec3x8& v, const float8& f) noexcept {return vec3x8(v.x / f, v.y / f, v.z / f);}
+
+/**
+ * @brief negate a wide 3D vector
+ */
+inline vec3x8 operator-(const vec3x8& v) noexcept {return vec3x8(-v.x, -v.y, -v.z);}
+
+/**
+ * @brief compute v * u + c for all axis of wide 3D vectors
+ * 
+ * A single rounding (fused multiply-add) is used if AVX2 is enabled
+ */
+inline vec3x8 fma(const vec3x8& v, const vec3x8& u, const vec3x8& c) noexcept {return vec3x8(fma(v.x, u.x, c.x), fma(v.y, u.y, c.y), fma(v.z, u.z, c.z));}
+
+/**
+ * @brief calculate the dot products of two wide 3D vectors
+ * 
+ * @param v the first vectors
+ * @param u the second vectors
+ * @return float8 the dot products of all lanes
+ */
+inline float8 dot(const vec3x8& v, const vec3x8& u) noexcept {return fma(v.z, u.z, fma(v.y, u.y, v.x * u.x));}
+
+/**
+ * @brief calculate the cross products of two wide 3D vectors
+ * 
+ * @param v the first vectors
+ * @param u the second vectors
+ * @return vec3x8 the cross products of all lanes
+ */
+inline vec3x8 cross(const vec3x8& v, const vec3x8& u) noexcept
+{return vec3x8(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);}
+
+/**
+ * @brief calculate the lengths of a wide 3D vector
+ * 
+ * @param v the vectors to calculate the lengths of
+ * @return float8 the lengths of all lanes
+ */
+inline float8 length(const vec3x8& v) noexcept {return sqrt(dot(v, v));}
+
+/**
+ * @brief normalize all lanes of a wide 3D vector
+ * 
+ * @param v the vectors to normalize
+ * @return vec3x8 vectors pointing in the same directions as the inputs but with a length of 1
+ */
+inline vec3x8 normalize(const vec3x8& v) noexcept {return v / length(v);}
+
+/**
+ * @brief select the lanes of two wide 3D vectors using a mask
+ * 
+ * @param m the mask to select with
+ * @param v the vectors to use where the mask is set
+ * @param u the vectors to use where the mask is not set
+ * @return vec3x8 the selected vectors
+ */
+inline vec3x8 select(const mask8& m, const vec3x8& v, const vec3x8& u) noexcept {return vec3x8(select(m, v.x, u.x), select(m, v.y, u.y), select(m, v.z, u.z));}
+
+/**
+ * @brief print a wide 3D vector into an output stream
+ * 
+ * @param os the output stream to fill
+ * @param v the wide vector to put into the output stream
+ * @return std::ostream& the filled output stream
+ */
+inline std::ostream& operator<<(std::ostream& os, const vec3x8& v) noexcept {
+    os << "(" << v[0];
+    for (int i = 1; i < 8; ++i) {os << ", " << v[i];}
+    return os << ")";
+}
+
+#endif
+
+#endif
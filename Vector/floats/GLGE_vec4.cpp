@@ -11,6 +11,63 @@
 
 //include the 4D float vector
 #include "GLGE_vec4.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+//include the polynomial approximations of the transcendental functions
+#include "../../Kernels/GLGE_MathKernels.hpp"
+
+//the short name of the pack the math kernels are evaluated with
+typedef glge::kernel::Pack Pack;
+
+/**
+ * @brief load a vector into the first 4 lanes of a pack, the remaining lanes are 0
+ * 
+ * @param v the vector to load
+ * @return Pack the pack holding the elements of the vector
+ */
+static inline Pack toPack(const vec4& v) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 3
+    return {_mm256_insertf128_ps(_mm256_setzero_ps(), v.simd, 0)};
+    #elif GLGE_KERNEL_LEVEL >= 1
+    return {v.simd};
+    #else
+    return {v.x};
+    #endif
+}
+
+/**
+ * @brief store the first 4 lanes of a pack into a vector
+ * 
+ * @param p the pack to store
+ * @return vec4 the vector holding the first 4 lanes
+ */
+static inline vec4 toVec4(const Pack& p) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 3
+    return _mm256_castps256_ps128(p.v);
+    #elif GLGE_KERNEL_LEVEL >= 1
+    return p.v;
+    #else
+    return vec4(p.v, 0.f, 0.f, 0.f);
+    #endif
+}
+
+/**
+ * @brief apply a math kernel to the elements of one or two vectors
+ * 
+ * @tparam F the type of the function to apply to a pack of v and a pack of u
+ * @param v the first arguments
+ * @param u the second arguments
+ * @param f the function to apply
+ * @return vec4 the results
+ */
+template <typename F> static inline vec4 mapElements(const vec4& v, const vec4& u, F f) noexcept {
+    //without SIMD a pack only holds a single float
+    #if GLGE_KERNEL_LEVEL >= 1
+    return toVec4(f(toPack(v), toPack(u)));
+    #else
+    return vec4(f(toPack(v), toPack(u)).v, f({v.y}, {u.y}).v, f({v.z}, {u.z}).v, f({v.w}, {u.w}).v);
+    #endif
+}
 
 vec4 vec4_add(vec4 v, vec4 u) {return v + u;}
 
@@ -31,3 +88,60 @@ void vec4_multiplyTo(vec4* a, vec4 b) {*a *= b;}
 void vec4_divideBy(vec4* a, vec4 b) {*a /= b;}
 
 float vec4_dot(vec4 v, vec4 u) {return dot(v, u);}
+
+vec4 vec4_fma(vec4 v, vec4 u, vec4 w) {return fma(v, u, w);}
+
+vec4 vec4_sqrt(vec4 v) {return sqrt(v);}
+
+void vec4_lengthArray(const vec4* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 4, false);}
+
+void vec4_lengthArrayFast(const vec4* in, float* out, size_t n) 
+{glge::kernel::table().vecLength((const float*)in, out, n, 4, true);}
+
+void vec4_normalizeArray(const vec4* in, vec4* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 4, false, false);}
+
+void vec4_normalizeArrayFast(const vec4* in, vec4* out, size_t n) 
+{glge::kernel::table().vecNormalize((const float*)in, (float*)out, n, 4, true, false);}
+
+void sincos(const vec4& v, vec4& s, vec4& c) noexcept {
+    #if GLGE_KERNEL_LEVEL >= 1
+    Pack ps, pc;
+    glge::kernel::sincos(toPack(v), ps, pc);
+    s = toVec4(ps);
+    c = toVec4(pc);
+    #else
+    glge::kernel::sincosArray<Pack>(v.vals, s.vals, c.vals, 4);
+    #endif
+}
+
+vec4 sin(const vec4& v) noexcept {return mapElements(v, v, [](Pack x, Pack) {return glge::kernel::sin(x);});}
+
+vec4 cos(const vec4& v) noexcept {return mapElements(v, v, [](Pack x, Pack) {return glge::kernel::cos(x);});}
+
+vec4 tan(const vec4& v) noexcept {return mapElements(v, v, [](Pack x, Pack) {return glge::kernel::tan(x);});}
+
+vec4 atan2(const vec4& y, const vec4& x) noexcept {return mapElements(y, x, [](Pack a, Pack b) {return glge::kernel::atan2(a, b);});}
+
+vec4 exp(const vec4& v) noexcept {return mapElements(v, v, [](Pack x, Pack) {return glge::kernel::exp(x);});}
+
+vec4 log(const vec4& v) noexcept {return mapElements(v, v, [](Pack x, Pack) {return glge::kernel::log(x);});}
+
+vec4 pow(const vec4& v, const vec4& u) noexcept {return mapElements(v, u, [](Pack a, Pack b) {return glge::kernel::pow(a, b);});}
+
+void vec4_sincos(vec4 v, vec4* s, vec4* c) {sincos(v, *s, *c);}
+
+vec4 vec4_sin(vec4 v) {return sin(v);}
+
+vec4 vec4_cos(vec4 v) {return cos(v);}
+
+vec4 vec4_tan(vec4 v) {return tan(v);}
+
+vec4 vec4_atan2(vec4 y, vec4 x) {return atan2(y, x);}
+
+vec4 vec4_exp(vec4 v) {return exp(v);}
+
+vec4 vec4_log(vec4 v) {return log(v);}
+
+vec4 vec4_pow(vec4 v, vec4 u) {return pow(v, u);}
@@ -360,6 +360,136 @@ void vec4_divideBy(vec4* a, vec4 b);
  */
 float vec4_dot(vec4 v, vec4 u);
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec4 the sum of the product and w
+ */
+vec4 vec4_fma(vec4 v, vec4 u, vec4 w);
+
+/**
+ * @brief compute the squareroot of every element of a vector
+ * 
+ * @param v the vector to compute the squareroots of
+ * @return vec4 the squareroots of the elements
+ */
+vec4 vec4_sqrt(vec4 v);
+
+/**
+ * @brief compute the lengths of an array of 4D float vectors
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec4_lengthArray(const vec4* in, float* out, size_t n);
+
+/**
+ * @brief approximate the lengths of an array of 4D float vectors using the fast reciprocal square root
+ * 
+ * The relative error is below 4.5e-7, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of n floats to write the lengths to
+ * @param n the amount of vectors
+ */
+void vec4_lengthArrayFast(const vec4* in, float* out, size_t n);
+
+/**
+ * @brief normalize an array of 4D float vectors
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec4_normalizeArray(const vec4* in, vec4* out, size_t n);
+
+/**
+ * @brief normalize an array of 4D float vectors using the fast reciprocal square root
+ * 
+ * The normalized vectors have a length within 5e-7 of 1, see glge::Precision::Fast
+ * 
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param n the amount of vectors
+ */
+void vec4_normalizeArrayFast(const vec4* in, vec4* out, size_t n);
+
+/**
+ * @brief compute the sine and the cosine of every element of a vector at once
+ * 
+ * All 4 elements are evaluated together using SIMD, the accuracy is the same as the one of glge::sincos
+ * 
+ * @param v the angles in radians
+ * @param s a pointer to write the sines to
+ * @param c a pointer to write the cosines to
+ */
+void vec4_sincos(vec4 v, vec4* s, vec4* c);
+
+/**
+ * @brief compute the sine of every element of a vector (see vec4_sincos)
+ * 
+ * @param v the angles in radians
+ * @return vec4 the sines of the angles
+ */
+vec4 vec4_sin(vec4 v);
+
+/**
+ * @brief compute the cosine of every element of a vector (see vec4_sincos)
+ * 
+ * @param v the angles in radians
+ * @return vec4 the cosines of the angles
+ */
+vec4 vec4_cos(vec4 v);
+
+/**
+ * @brief compute the tangent of every element of a vector (see vec4_sincos)
+ * 
+ * @param v the angles in radians
+ * @return vec4 the tangents of the angles
+ */
+vec4 vec4_tan(vec4 v);
+
+/**
+ * @brief compute atan2 for every element of two vectors (see vec4_sincos)
+ * 
+ * @param y the y coordinates
+ * @param x the x coordinates
+ * @return vec4 the angles in radians in the range [-pi, pi]
+ */
+vec4 vec4_atan2(vec4 y, vec4 x);
+
+/**
+ * @brief compute e to the power of every element of a vector (see vec4_sincos)
+ * 
+ * @param v the exponents
+ * @return vec4 e to the power of the elements
+ */
+vec4 vec4_exp(vec4 v);
+
+/**
+ * @brief compute the natural logarithm of every element of a vector (see vec4_sincos)
+ * 
+ * @param v the values to compute the logarithm of
+ * @return vec4 the logarithms of the elements
+ */
+vec4 vec4_log(vec4 v);
+
+/**
+ * @brief raise every element of a vector to the power of the element of another vector (see vec4_sincos)
+ * 
+ * @param v the bases (must not be negative)
+ * @param u the exponents
+ * @return vec4 the powers
+ */
+vec4 vec4_pow(vec4 v, vec4 u);
+
 //end a potential C section and add the C++ specific functions
 #if __cplusplus
 }
@@ -374,30 +504,191 @@ float vec4_dot(vec4 v, vec4 u);
 inline std::ostream& operator<<(std::ostream& os, const s_vec4& u) noexcept
 {return os << "(" << u.x << ", " << u.y << ", " << u.z << ", " << u.w << ")";}
 
+/**
+ * @brief compute v * u + w for every element
+ * 
+ * The multiplication and the addition are fused into a single rounding if GLGE_MATH_ALLOW_FMA is 1 (see GLGEMath_Settings.h), 
+ * else they are rounded on their own. 
+ * 
+ * @param v the first factor
+ * @param u the second factor
+ * @param w the vector to add to the product
+ * @return vec4 the sum of the product and w
+ */
+inline vec4 fma(const vec4& v, const vec4& u, const vec4& w) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    #if GLGE_MATH_ALLOW_FMA
+    return _mm_fmadd_ps(v.simd, u.simd, w.simd);
+    #else
+    return _mm_add_ps(_mm_mul_ps(v.simd, u.simd), w.simd);
+    #endif
+    #else
+    return vec4(glge::fma(v.x, u.x, w.x), glge::fma(v.y, u.y, w.y), glge::fma(v.z, u.z, w.z), glge::fma(v.w, u.w, w.w));
+    #endif
+}
+
+/**
+ * @brief compute the squareroot of every element of a vector
+ * 
+ * @param v the vector to compute the squareroots of
+ * @return vec4 the squareroots of the elements
+ */
+inline vec4 sqrt(const vec4& v) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    return glge::sqrt(v.simd);
+    #else
+    return vec4(glge::sqrt(v.x), glge::sqrt(v.y), glge::sqrt(v.z), glge::sqrt(v.w));
+    #endif
+}
+
 /**
  * @brief calculate the dot product of two 2D float vectors
  * 
+ * The fused version is only constexpr if the compiler can detect constant evaluation (see GLGE_MATH_SIMD_CONSTEXPR)
+ * 
  * @param v the first float vector
  * @param u the second float vector
  * @return const float the dot product of both vectors
  */
+#if GLGE_MATH_ALLOW_FMA
+inline GLGE_MATH_SIMD_CONSTEXPR float dot(const vec4& v, const vec4& u) noexcept {
+    //std::fma can't be evaluated at compile time, so constant evaluation uses the unfused sum
+    if (GLGE_MATH_IS_CONSTANT_EVALUATED()) {return v.x * u.x + v.y * u.y + v.z * u.z + v.w * u.w;}
+    return glge::fma(v.w, u.w, glge::fma(v.z, u.z, glge::fma(v.y, u.y, v.x * u.x)));
+}
+#else
 inline constexpr float dot(const vec4& v, const vec4& u) noexcept {return v.x * u.x + v.y * u.y + v.z * u.z + v.w * u.w;}
+#endif
 
 /**
  * @brief calculate the length of a 4D vector
  * 
+ * @tparam P the precision to use, Fast uses the approximate reciprocal square root (see glge::Precision)
  * @param v a constant reference to the vector to calculate the length of
- * @return constexpr float the length of the vector
+ * @return float the length of the vector
  */
-inline float length(const vec4& v) noexcept {return glge::sqrt(v.x*v.x + v.y*v.y + v.z*v.z + v.w*v.w);}
+template <glge::Precision P = glge::DefaultPrecision> inline float length(const vec4& v) noexcept {
+    float d = dot(v, v);
+    return (P == glge::Precision::Fast) ? d * glge::rsqrtFast(d) : glge::sqrt(d);
+}
 
 /**
  * @brief calculate a vector that points in the same direction 
  * 
+ * @tparam P the precision to use, Fast multiplies by the approximate reciprocal square root instead of dividing by the length (see glge::Precision)
  * @param v a vector to normalize
  * @return vec4 a vector pointing in the same direction as the input but with a length of 1
  */
-inline vec4 normalize(const vec4& v) noexcept {return v / length(v);}
+template <glge::Precision P = glge::DefaultPrecision> inline vec4 normalize(const vec4& v) noexcept {
+    #if GLGE_MATH_USE_SIMD
+    //keep the reciprocal square root in a register, it is needed for all elements
+    if (P == glge::Precision::Fast) {return _mm_mul_ps(v.simd, glge::rsqrtFast(_mm_set1_ps(dot(v, v))));}
+    #else
+    if (P == glge::Precision::Fast) {return v * glge::rsqrtFast(dot(v, v));}
+    #endif
+    return v / length<glge::Precision::Exact>(v);
+}
+
+/**
+ * @brief compute the lengths of an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors
+ * @param out a pointer to an array of count floats to write the lengths to
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(const vec4* in, float* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec4_lengthArrayFast(in, out, count);}
+    else {vec4_lengthArray(in, out, count);}
+}
+
+/**
+ * @brief normalize an array of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in a constant pointer to the vectors to normalize
+ * @param out a pointer to write the normalized vectors to (may be the same as in)
+ * @param count the amount of vectors
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(const vec4* in, vec4* out, size_t count) noexcept {
+    if (P == glge::Precision::Fast) {vec4_normalizeArrayFast(in, out, count);}
+    else {vec4_normalizeArray(in, out, count);}
+}
+
+/**
+ * @brief compute the sine and the cosine of every element of a vector at once (see vec4_sincos)
+ * 
+ * The C++ functions take the vectors by reference, a vector passed by value is split into two registers and has to be 
+ * reassembled in memory, which stalls independent calls
+ * 
+ * @param v the angles in radians
+ * @param s a reference to write the sines to
+ * @param c a reference to write the cosines to
+ */
+void sincos(const vec4& v, vec4& s, vec4& c) noexcept;
+
+/**
+ * @brief compute the sine of every element of a vector
+ */
+vec4 sin(const vec4& v) noexcept;
+
+/**
+ * @brief compute the cosine of every element of a vector
+ */
+vec4 cos(const vec4& v) noexcept;
+
+/**
+ * @brief compute the tangent of every element of a vector
+ */
+vec4 tan(const vec4& v) noexcept;
+
+/**
+ * @brief compute atan2 for every element of two vectors
+ */
+vec4 atan2(const vec4& y, const vec4& x) noexcept;
+
+/**
+ * @brief compute e to the power of every element of a vector
+ */
+vec4 exp(const vec4& v) noexcept;
+
+/**
+ * @brief compute the natural logarithm of every element of a vector
+ */
+vec4 log(const vec4& v) noexcept;
+
+/**
+ * @brief raise every element of a vector to the power of the element of another vector
+ */
+vec4 pow(const vec4& v, const vec4& u) noexcept;
+
+//spans are only available since C++20
+#if (__cplusplus >= 202002L) || (defined(_MSVC_LANG) && (_MSVC_LANG >= 202002L))
+
+//include spans for the span based interface
+#include <span>
+
+/**
+ * @brief compute the lengths of a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors
+ * @param out the span to write the lengths to, only as many elements as both spans hold are computed
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void length(std::span<const vec4> in, std::span<float> out) noexcept
+{length<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+/**
+ * @brief normalize a span of vectors
+ * 
+ * @tparam P the precision to use (see glge::Precision)
+ * @param in the vectors to normalize
+ * @param out the span to write the normalized vectors to, only as many elements as both spans hold are normalized
+ */
+template <glge::Precision P = glge::DefaultPrecision> inline void normalize(std::span<const vec4> in, std::span<vec4> out) noexcept
+{normalize<P>(in.data(), out.data(), (in.size() < out.size()) ? in.size() : out.size());}
+
+#endif
 
 #endif
 
@@ -0,0 +1,162 @@
+/**
+ * @file GLGE_vec4SoA.cpp
+ * @author DM8AT
+ * @brief implement the structure of arrays container for 4D float vectors
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//include the 4D float vector container
+#include "GLGE_vec4SoA.h"
+//include the batch kernels
+#include "../../Kernels/GLGE_KernelTable.hpp"
+//include memcpy and memset
+#include <string.h>
+
+//the amount of floats the capacity of a stream is rounded up to
+#define GLGE_SOA_PADDING (GLGE_MATH_SOA_ALIGNMENT / sizeof(float))
+
+s_vec4SoA::s_vec4SoA(size_t _size) noexcept
+ : s_vec4SoA()
+{vec4SoA_resize(this, _size);}
+
+s_vec4SoA::s_vec4SoA(const vec4* data, size_t count) noexcept
+ : s_vec4SoA()
+{vec4SoA_fromAoS(this, data, count);}
+
+s_vec4SoA::s_vec4SoA(const s_vec4SoA& other) noexcept
+ : s_vec4SoA()
+{*this = other;}
+
+s_vec4SoA::s_vec4SoA(s_vec4SoA&& other) noexcept
+ : s_vec4SoA()
+{*this = ((s_vec4SoA&&)other);}
+
+s_vec4SoA::~s_vec4SoA() noexcept
+{vec4SoA_free(this);}
+
+s_vec4SoA& s_vec4SoA::operator=(const s_vec4SoA& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    if (!vec4SoA_resize(this, other.size)) {return *this;}
+    for (size_t c = 0; c < 4; ++c) 
+    {memcpy(streams[c], other.streams[c], size * sizeof(float));}
+    return *this;
+}
+
+s_vec4SoA& s_vec4SoA::operator=(s_vec4SoA&& other) noexcept {
+    //self assignment is a no-op
+    if (this == &other) {return *this;}
+    vec4SoA_free(this);
+    x = other.x; y = other.y; z = other.z; w = other.w;
+    size = other.size;
+    capacity = other.capacity;
+    other.x = NULL; other.y = NULL; other.z = NULL; other.w = NULL;
+    other.size = 0;
+    other.capacity = 0;
+    return *this;
+}
+
+bool s_vec4SoA::resize(size_t _size) noexcept
+{return vec4SoA_resize(this, _size);}
+
+bool vec4SoA_resize(vec4SoA* soa, size_t size) {
+    //grow the streams if the new size does not fit
+    if (size > soa->capacity) {
+        //at least double the capacity to keep repeated growing cheap and pad it to full registers
+        size_t capacity = (soa->capacity * 2 > size) ? soa->capacity * 2 : size;
+        capacity = (capacity + GLGE_SOA_PADDING - 1) & ~(GLGE_SOA_PADDING - 1);
+        //all streams share a single allocation
+        float* block = (float*)glge_alignedAlloc(capacity * 4 * sizeof(float), GLGE_MATH_SOA_ALIGNMENT);
+        if (!block) {return false;}
+        //copy the old elements and zero the padding
+        for (size_t c = 0; c < 4; ++c) {
+            float* stream = block + c*capacity;
+            if (soa->size) {memcpy(stream, soa->streams[c], soa->size * sizeof(float));}
+            memset(stream + soa->size, 0, (capacity - soa->size) * sizeof(float));
+        }
+        glge_alignedFree(soa->streams[0]);
+        for (size_t c = 0; c < 4; ++c) 
+        {soa->streams[c] = block + c*capacity;}
+        soa->capacity = capacity;
+    }
+    //else, zero the new elements in case a kernel wrote to the padding
+    else if (size > soa->size) {
+        for (size_t c = 0; c < 4; ++c) 
+        {memset(soa->streams[c] + soa->size, 0, (size - soa->size) * sizeof(float));}
+    }
+    soa->size = size;
+    return true;
+}
+
+void vec4SoA_free(vec4SoA* soa) {
+    //all streams share the allocation of the first stream
+    glge_alignedFree(soa->streams[0]);
+    soa->x = NULL;
+    soa->y = NULL;
+    soa->z = NULL;
+    soa->w = NULL;
+    soa->size = 0;
+    soa->capacity = 0;
+}
+
+bool vec4SoA_fromAoS(vec4SoA* soa, const vec4* data, size_t n) {
+    if (!vec4SoA_resize(soa, n)) {return false;}
+    glge::kernel::table().soaFromAoS((const float*)data, soa->streams, 4, n);
+    return true;
+}
+
+void vec4SoA_toAoS(const vec4SoA* soa, vec4* data) 
+{glge::kernel::table().soaToAoS(soa->streams, (float*)data, 4, soa->size);}
+
+vec4 vec4SoA_get(const vec4SoA* soa, size_t i) {return (*soa)[i];}
+
+void vec4SoA_set(vec4SoA* soa, size_t i, vec4 v) {soa->set(i, v);}
+
+/**
+ * @brief get the amount of vectors a function with two inputs processes and resize the output to it
+ * 
+ * @return size_t the amount of vectors to process (0 if the output could not be resized)
+ */
+static size_t vec4SoA_binarySize(const vec4SoA* a, const vec4SoA* b, vec4SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    return vec4SoA_resize(out, n) ? n : 0;
+}
+
+void vec4SoA_add(const vec4SoA* a, const vec4SoA* b, vec4SoA* out) {
+    size_t n = vec4SoA_binarySize(a, b, out);
+    glge::kernel::table().soaAdd(a->streams, b->streams, out->streams, 4, n);
+}
+
+void vec4SoA_subtract(const vec4SoA* a, const vec4SoA* b, vec4SoA* out) {
+    size_t n = vec4SoA_binarySize(a, b, out);
+    glge::kernel::table().soaSubtract(a->streams, b->streams, out->streams, 4, n);
+}
+
+void vec4SoA_multiply(const vec4SoA* a, const vec4SoA* b, vec4SoA* out) {
+    size_t n = vec4SoA_binarySize(a, b, out);
+    glge::kernel::table().soaMultiply(a->streams, b->streams, out->streams, 4, n);
+}
+
+void vec4SoA_fma(const vec4SoA* a, const vec4SoA* b, const vec4SoA* c, vec4SoA* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    n = (n < c->size) ? n : c->size;
+    if (!vec4SoA_resize(out, n)) {return;}
+    glge::kernel::table().soaFma(a->streams, b->streams, c->streams, out->streams, 4, n);
+}
+
+void vec4SoA_dot(const vec4SoA* a, const vec4SoA* b, float* out) {
+    size_t n = (a->size < b->size) ? a->size : b->size;
+    glge::kernel::table().soaDot(a->streams, b->streams, out, 4, n);
+}
+
+void vec4SoA_length(const vec4SoA* a, float* out) 
+{glge::kernel::table().soaLength(a->streams, out, 4, a->size);}
+
+void vec4SoA_normalize(const vec4SoA* a, vec4SoA* out) {
+    if (!vec4SoA_resize(out, a->size)) {return;}
+    glge::kernel::table().soaNormalize(a->streams, out->streams, 4, a->size);
+}
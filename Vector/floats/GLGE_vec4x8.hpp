@@ -0,0 +1,253 @@
+/**
+ * @file GLGE_vec4x8.hpp
+ * @author DM8AT
+ * @brief define a C++ only wide 4D float vector that holds 8 vectors transposed (one wide float per axis)
+ * 
+ * The wide vector is meant for AoSoA (array of structures of arrays) programming: a loop processes 8 vectors per iteration 
+ * using the same operators and functions as for a single vec4. 
+ * 
+ * @version 0.1
+ * @date 2026-10-16
+ * 
+ * @copyright Copyright (c) 2026
+ * 
+ */
+
+//header guard
+#ifndef _GLGE_FLOAT_VEC4_X8_
+#define _GLGE_FLOAT_VEC4_X8_
+
+//only available for C++
+#if __cplusplus
+
+//include the float 4D vector
+#include "GLGE_vec4.h"
+//include the wide 3D vector for upcasting
+#include "GLGE_vec3x8.hpp"
+//include the wide float
+#include "GLGE_float8.hpp"
+//include the packs to convert from and to interleaved vectors
+#include "../../Kernels/GLGE_KernelPack.hpp"
+
+/**
+ * @brief store 8 4D float vectors with one wide float per axis
+ */
+typedef struct s_vec4x8 {
+
+    //the x values of all lanes
+    float8 x;
+    //the y values of all lanes
+    float8 y;
+    //the z values of all lanes
+    float8 z;
+    //the w values of all lanes
+    float8 w;
+
+    /**
+     * @brief Construct a new vec4x8
+     * all lanes are 0
+     */
+    inline s_vec4x8() noexcept {}
+
+    /**
+     * @brief Construct a new vec4x8
+     * 
+     * @param _x the values for the x axis
+     * @param _y the values for the y axis
+     * @param _z the values for the z axis
+     * @param _w the values for the w axis
+     */
+    inline s_vec4x8(const float8& _x, const float8& _y, const float8& _z, const float8& _w) noexcept : x(_x), y(_y), z(_z), w(_w) {}
+
+    /**
+     * @brief Construct a new vec4x8
+     * 
+     * @param v the vector to store in all lanes
+     */
+    inline s_vec4x8(const vec4& v) noexcept : x(v.x), y(v.y), z(v.z), w(v.w) {}
+
+    /**
+     * @brief Construct a new vec4x8
+     * 
+     * @param xyz the values for the x, y and z axis
+     * @param _w the values for the w axis
+     */
+    inline s_vec4x8(const vec3x8& xyz, const float8& _w) noexcept : x(xyz.x), y(xyz.y), z(xyz.z), w(_w) {}
+
+    /**
+     * @brief load 8 vectors from an array of 4D vectors
+     * 
+     * @param p a pointer to the 8 vectors
+     * @return s_vec4x8 the wide vector holding the 8 vectors
+     */
+    static inline s_vec4x8 load(const vec4* p) noexcept {
+        s_vec4x8 r;
+        //the pack width depends on the instruction set, so the vectors are converted one pack at a time
+        for (size_t k = 0; k < 8; k += glge::kernel::Pack::Width) {
+            glge::kernel::Pack px, py, pz, pw;
+            glge::kernel::loadInterleaved(p[k].vals, px, py, pz, pw);
+            glge::kernel::store(r.x.vals + k, px);
+            glge::kernel::store(r.y.vals + k, py);
+            glge::kernel::store(r.z.vals + k, pz);
+            glge::kernel::store(r.w.vals + k, pw);
+        }
+        return r;
+    }
+
+    /**
+     * @brief store the 8 vectors to an array of 4D vectors
+     * 
+     * @param p a pointer to write the 8 vectors to
+     */
+    inline void store(vec4* p) const noexcept {
+        for (size_t k = 0; k < 8; k += glge::kernel::Pack::Width) {
+            glge::kernel::storeInterleaved(p[k].vals, glge::kernel::load(x.vals + k), glge::kernel::load(y.vals + k), glge::kernel::load(z.vals + k), glge::kernel::load(w.vals + k));
+        }
+    }
+
+    /**
+     * @brief get a single vector
+     * 
+     * @param i the index of the lane
+     * @return vec4 the vector stored in the lane
+     */
+    inline vec4 operator[](int i) const noexcept {return vec4(x.vals[i], y.vals[i], z.vals[i], w.vals[i]);}
+
+    /**
+     * @brief set a single vector
+     * 
+     * @param i the index of the lane
+     * @param v the new vector for the lane
+     */
+    inline void set(int i, const vec4& v) noexcept {x.vals[i] = v.x; y.vals[i] = v.y; z.vals[i] = v.z; w.vals[i] = v.w;}
+
+    /**
+     * @brief add and assign another wide vector to this one
+     */
+    inline s_vec4x8& operator+=(const s_vec4x8& u) noexcept {x += u.x; y += u.y; z += u.z; w += u.w; return *this;}
+
+    /**
+     * @brief subtract and assign another wide vector from this one
+     */
+    inline s_vec4x8& operator-=(const s_vec4x8& u) noexcept {x -= u.x; y -= u.y; z -= u.z; w -= u.w; return *this;}
+
+    /**
+     * @brief multiply and assign another wide vector to this one
+     */
+    inline s_vec4x8& operator*=(const s_vec4x8& u) noexcept {x *= u.x; y *= u.y; z *= u.z; w *= u.w; return *this;}
+
+    /**
+     * @brief divide this wide vector by another one
+     */
+    inline s_vec4x8& operator/=(const s_vec4x8& u) noexcept {x /= u.x; y /= u.y; z /= u.z; w /= u.w; return *this;}
+
+    /**
+     * @brief multiply all axis with a wide float
+     */
+    inline s_vec4x8& operator*=(const float8& f) noexcept {x *= f; y *= f; z *= f; w *= f; return *this;}
+
+    /**
+     * @brief divide all axis by a wide float
+     */
+    inline s_vec4x8& operator/=(const float8& f) noexcept {x /= f; y /= f; z /= f; w /= f; return *this;}
+
+} vec4x8;
+
+/**
+ * @brief add two wide 4D vectors together
+ */
+inline vec4x8 operator+(const vec4x8& v, const vec4x8& u) noexcept {return vec4x8(v.x + u.x, v.y + u.y, v.z + u.z, v.w + u.w);}
+
+/**
+ * @brief subtract two wide 4D vectors
+ */
+inline vec4x8 operator-(const vec4x8& v, const vec4x8& u) noexcept {return vec4x8(v.x - u.x, v.y - u.y, v.z - u.z, v.w - u.w);}
+
+/**
+ * @brief multiply two wide 4D vectors together
+ */
+inline vec4x8 operator*(const vec4x8& v, const vec4x8& u) noexcept {return vec4x8(v.x * u.x, v.y * u.y, v.z * u.z, v.w * u.w);}
+
+/**
+ * @brief divide two wide 4D vectors
+ */
+inline vec4x8 operator/(const vec4x8& v, const vec4x8& u) noexcept {return vec4x8(v.x / u.x, v.y / u.y, v.z / u.z, v.w / u.w);}
+
+/**
+ * @brief scale a wide 4D vector
+ */
+inline vec4x8 operator*(const vec4x8& v, const float8& f) noexcept {return vec4x8(v.x * f, v.y * f, v.z * f, v.w * f);}
+
+/**
+ * @brief scale a wide 4D vector
+ */
+inline vec4x8 operator*(const float8& f, const vec4x8& v) noexcept {return vec4x8(f * v.x, f * v.y, f * v.z, f * v.w);}
+
+/**
+ * @brief divide a wide 4D vector by a wide float
+ */
+inline vec4x8 operator/(const vec4x8& v, const float8& f) noexcept {return vec4x8(v.x / f, v.y / f, v.z / f, v.w / f);}
+
+/**
+ * @brief negate a wide 4D vector
+ */
+inline vec4x8 operator-(const vec4x8& v) noexcept {return vec4x8(-v.x, -v.y, -v.z, -v.w);}
+
+/**
+ * @brief compute v * u + c for all axis of wide 4D vectors
+ * 
+ * A single rounding (fused multiply-add) is used if AVX2 is enabled
+ */
+inline vec4x8 fma(const vec4x8& v, const vec4x8& u, const vec4x8& c) noexcept {return vec4x8(fma(v.x, u.x, c.x), fma(v.y, u.y, c.y), fma(v.z, u.z, c.z), fma(v.w, u.w, c.w));}
+
+/**
+ * @brief calculate the dot products of two wide 4D vectors
+ * 
+ * @param v the first vectors
+ * @param u the second vectors
+ * @return float8 the dot products of all lanes
+ */
+inline float8 dot(const vec4x8& v, const vec4x8& u) noexcept {return fma(v.w, u.w, fma(v.z, u.z, fma(v.y, u.y, v.x * u.x)));}
+
+/**
+ * @brief calculate the lengths of a wide 4D vector
+ * 
+ * @param v the vectors to calculate the lengths of
+ * @return float8 the lengths of all lanes
+ */
+inline float8 length(const vec4x8& v) noexcept {return sqrt(dot(v, v));}
+
+/**
+ * @brief normalize all lanes of a wide 4D vector
+ * 
+ * @param v the vectors to normalize
+ * @return vec4x8 vectors pointing in the same directions as the inputs but with a length of 1
+ */
+inline vec4x8 normalize(const vec4x8& v) noexcept {return v / length(v);}
+
+/**
+ * @brief select the lanes of two wide 4D vectors using a mask
+ * 
+ * @param m the mask to select with
+ * @param v the vectors to use where the mask is set
+ * @param u the vectors to use where the mask is not set
+ * @return vec4x8 the selected vectors
+ */
+inline vec4x8 select(const mask8& m, const vec4x8& v, const vec4x8& u) noexcept {return vec4x8(select(m, v.x, u.x), select(m, v.y, u.y), select(m, v.z, u.z), select(m, v.w, u.w));}
+
+/**
+ * @brief print a wide 4D vector into an output stream
+ * 
+ * @param os the output stream to fill
+ * @param v the wide vector to put into the output stream
+ * @return std::ostream& the filled output stream
+ */
+inline std::ostream& operator<<(std::ostream& os, const vec4x8& v) noexcept {
+    os << "(" << v[0];
+    for (int i = 1; i < 8; ++i) {os << ", " << v[i];}
+    return os << ")";
+}
+
+#endif
+
+#endif
@@ -229,7 +229,7 @@ inline constexpr int32_t dot(const ivec3& v, const ivec3& u) noexcept {return v.
  * @param u the second vector
  * @return const ivec3 the cross product (vector product) of both vectors
  */
-inline constexpr ivec3 cross(const ivec3& v, const ivec3& u) noexcept {return ivec3(v.y*u.z - v.z*u.y, v.x*u.z - v.z*u.x, v.x*u.y - v.y*u.x);}
+inline constexpr ivec3 cross(const ivec3& v, const ivec3& u) noexcept {return ivec3(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);}
 
 /**
  * @brief calculate the length of a 3D vector
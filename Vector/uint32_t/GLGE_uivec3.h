@@ -230,7 +230,7 @@ inline constexpr uint32_t dot(const uivec3& v, const uivec3& u) noexcept {return
  * @param u the second vector
  * @return const uivec3 the cross product (vector product) of both vectors
  */
-inline constexpr uivec3 cross(const uivec3& v, const uivec3& u) noexcept {return uivec3(v.y*u.z - v.z*u.y, v.x*u.z - v.z*u.x, v.x*u.y - v.y*u.x);}
+inline constexpr uivec3 cross(const uivec3& v, const uivec3& u) noexcept {return uivec3(v.y*u.z - v.z*u.y, v.z*u.x - v.x*u.z, v.x*u.y - v.y*u.x);}
 
 /**
  * @brief calculate the length of a 3D vector